@@ -0,0 +1,144 @@
+#include "Commands/Batch/ExecuteBatchCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/StrongObjectPtr.h"
+
+FExecuteBatchCommand::FExecuteBatchCommand(FMCPBatchCommandExecutor InGameThreadExecutor, FMCPBatchCommandExecutor InAnyThreadExecutor, FMCPBatchGameThreadRunner InGameThreadRunner)
+    : GameThreadExecutor(MoveTemp(InGameThreadExecutor))
+    , AnyThreadExecutor(MoveTemp(InAnyThreadExecutor))
+    , GameThreadRunner(MoveTemp(InGameThreadRunner))
+{
+}
+
+FString FExecuteBatchCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    FJsonSerializer::Deserialize(Reader, JsonObject);
+    
+    TSharedPtr<FJsonObject> ResponseObj = ExecuteJson(JsonObject);
+    
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FExecuteBatchCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    return FJsonSerializer::Deserialize(Reader, JsonObject) && ValidateParamsJson(JsonObject);
+}
+
+bool FExecuteBatchCommand::ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const
+{
+    const TArray<TSharedPtr<FJsonValue>>* OperationsArray;
+    return Parameters.IsValid() && Parameters->TryGetArrayField(TEXT("operations"), OperationsArray);
+}
+
+TSharedPtr<FJsonObject> FExecuteBatchCommand::ExecuteJson(const TSharedPtr<FJsonObject>& Parameters)
+{
+    if (!ValidateParamsJson(Parameters))
+    {
+        return CreateErrorResponse(TEXT("Missing 'operations' array parameter"));
+    }
+    
+    TArray<FMCPBatchOperation> Operations = FMCPBatchOperationUtils::CreateOperationsFromJsonObject(Parameters);
+    if (Operations.Num() == 0)
+    {
+        return CreateErrorResponse(TEXT("Batch contains no operations"));
+    }
+    if (Operations.Num() != Parameters->GetArrayField(TEXT("operations")).Num())
+    {
+        return CreateErrorResponse(TEXT("Every entry in 'operations' must be an object"));
+    }
+    
+    // Reject the whole batch up front rather than running part of it
+    FString ValidationError;
+    for (const FMCPBatchOperation& Operation : Operations)
+    {
+        if (!FMCPBatchOperationUtils::ValidateBatchOperation(Operation, ValidationError))
+        {
+            return CreateErrorResponse(ValidationError);
+        }
+    }
+    if (!FMCPBatchOperationUtils::ValidateDependencies(Operations, ValidationError))
+    {
+        return CreateErrorResponse(ValidationError);
+    }
+    
+    int32 MaxParallel = 4;
+    const bool bHasMaxParallel = Parameters->TryGetNumberField(TEXT("max_parallel"), MaxParallel);
+    
+    bool bStopOnFailure = false;
+    const bool bHasStopOnFailure = Parameters->TryGetBoolField(TEXT("stop_on_failure"), bStopOnFailure);
+    
+    bool bRollbackOnFailure = false;
+    Parameters->TryGetBoolField(TEXT("rollback_on_failure"), bRollbackOnFailure);
+    
+    // The handler is a UObject, so it is created, set up and released on the game thread
+    TStrongObjectPtr<UMCPBatchOperationHandler> Handler;
+    auto SetUpHandler = [&]()
+    {
+        Handler.Reset(NewObject<UMCPBatchOperationHandler>());
+        Handler->Initialize(GetCommandName());
+        Handler->SetCommandExecutors(GameThreadExecutor, AnyThreadExecutor);
+        Handler->SetGameThreadRunner(GameThreadRunner);
+        // Compile and save what the batch modified, once per asset, before answering
+        Handler->SetFlushAssetsOnCompletion(true);
+        if (bHasMaxParallel)
+        {
+            Handler->SetMaxParallelOperations(MaxParallel);
+        }
+        if (bHasStopOnFailure)
+        {
+            Handler->SetStopOnFirstFailure(bStopOnFailure);
+        }
+        Handler->AddOperations(Operations);
+    };
+    if (!RunOnGameThread(SetUpHandler))
+    {
+        return CreateErrorResponse(TEXT("MCP server is shutting down"));
+    }
+    
+    if (bRollbackOnFailure)
+    {
+        Handler->ExecuteBatchWithRollback();
+    }
+    else
+    {
+        Handler->ExecuteBatch();
+    }
+    
+    TSharedPtr<FJsonObject> Response;
+    auto TearDownHandler = [&]()
+    {
+        Response = Handler->CreateBatchResponseJson();
+        Handler.Reset();
+    };
+    if (!RunOnGameThread(TearDownHandler))
+    {
+        return CreateErrorResponse(TEXT("MCP server is shutting down"));
+    }
+    return Response;
+}
+
+bool FExecuteBatchCommand::RunOnGameThread(TFunction<void()> Work) const
+{
+    if (IsInGameThread())
+    {
+        Work();
+        return true;
+    }
+    return GameThreadRunner(MoveTemp(Work)).Get();
+}
+
+TSharedPtr<FJsonObject> FExecuteBatchCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+    return ErrorObj;
+}
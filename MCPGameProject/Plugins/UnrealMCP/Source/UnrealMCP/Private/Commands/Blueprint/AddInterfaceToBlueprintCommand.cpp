@@ -1,4 +1,5 @@
 #include "Commands/Blueprint/AddInterfaceToBlueprintCommand.h"
+#include "Services/AssetDirtySet.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -101,7 +102,8 @@ FString FAddInterfaceToBlueprintCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(FString::Printf(TEXT("'%s' is not a Blueprint Interface"), *InterfaceName));
     }
     
-    // Check if interface is already implemented
+    // Check if interface is already implemented; the interface's functions must be compiled to be implemented
+    FAssetDirtySet::Get().EnsureCompiled(InterfaceBlueprint);
     UClass* InterfaceClass = InterfaceBlueprint->GeneratedClass;
     if (!InterfaceClass)
     {
@@ -9,6 +9,8 @@
 #include "EdGraph/EdGraphNode.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
+#include "MCPCommandHandle.h"
+#include "Services/BlueprintCompileCache.h"
 
 FCompileBlueprintCommand::FCompileBlueprintCommand(IBlueprintService& InBlueprintService)
     : BlueprintService(InBlueprintService)
@@ -20,9 +22,10 @@ FString FCompileBlueprintCommand::Execute(const FString& Parameters)
     UE_LOG(LogTemp, Warning, TEXT("CompileBlueprintCommand::Execute called with parameters: %s"), *Parameters);
     
     FString BlueprintName;
+    bool bForce = false;
     FString ParseError;
     
-    if (!ParseParameters(Parameters, BlueprintName, ParseError))
+    if (!ParseParameters(Parameters, BlueprintName, bForce, ParseError))
     {
         UE_LOG(LogTemp, Error, TEXT("CompileBlueprintCommand: Parameter parsing failed: %s"), *ParseError);
         return CreateErrorResponse(ParseError);
@@ -37,6 +40,23 @@ FString FCompileBlueprintCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
     }
     
+    // Agents compile after every step; repeating a compile nothing has invalidated only costs editor time
+    FBlueprintCompileRecord CachedCompile;
+    if (!bForce && FBlueprintCompileCache::Get().FindUpToDate(Blueprint, CachedCompile))
+    {
+        UE_LOG(LogTemp, Log, TEXT("CompileBlueprintCommand: '%s' is unchanged since its last compile, skipping"), *BlueprintName);
+        const bool bHasWarnings = CachedCompile.Status == BS_UpToDateWithWarnings;
+        return CreateSuccessResponse(BlueprintName, 0.0f, bHasWarnings ? TEXT("compiled with warnings") : TEXT("compiled successfully"),
+            CachedCompile.Warnings, true, CachedCompile.CompileMs);
+    }
+    
+    // Compilation can't be interrupted once started, so this is the last point to honour a cancel or timeout
+    if (FMCPCommandHandle::IsCurrentCancelled())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CompileBlueprintCommand: Cancelled before compiling blueprint: %s"), *BlueprintName);
+        return CreateErrorResponse(FString::Printf(TEXT("Compilation of %s was cancelled"), *BlueprintName));
+    }
+    
     // Record compilation start time
     double StartTime = FPlatformTime::Seconds();
     
@@ -92,12 +112,13 @@ FString FCompileBlueprintCommand::GetCommandName() const
 bool FCompileBlueprintCommand::ValidateParams(const FString& Parameters) const
 {
     FString BlueprintName;
+    bool bForce = false;
     FString ParseError;
     
-    return ParseParameters(Parameters, BlueprintName, ParseError);
+    return ParseParameters(Parameters, BlueprintName, bForce, ParseError);
 }
 
-bool FCompileBlueprintCommand::ParseParameters(const FString& JsonString, FString& OutBlueprintName, FString& OutError) const
+bool FCompileBlueprintCommand::ParseParameters(const FString& JsonString, FString& OutBlueprintName, bool& bOutForce, FString& OutError) const
 {
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
@@ -115,16 +136,25 @@ bool FCompileBlueprintCommand::ParseParameters(const FString& JsonString, FStrin
         return false;
     }
     
+    // Optional; compiles even if nothing changed since the last successful compile
+    bOutForce = false;
+    JsonObject->TryGetBoolField(TEXT("force"), bOutForce);
+    
     return true;
 }
 
-FString FCompileBlueprintCommand::CreateSuccessResponse(const FString& BlueprintName, float CompilationTime, const FString& Status, const TArray<FString>& Warnings) const
+FString FCompileBlueprintCommand::CreateSuccessResponse(const FString& BlueprintName, float CompilationTime, const FString& Status, const TArray<FString>& Warnings, bool bSkipped, double CachedCompileMs) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
     ResponseObj->SetStringField(TEXT("blueprint_name"), BlueprintName);
     ResponseObj->SetNumberField(TEXT("compilation_time_seconds"), CompilationTime);
     ResponseObj->SetStringField(TEXT("status"), Status);
+    ResponseObj->SetBoolField(TEXT("skipped"), bSkipped);
+    if (bSkipped)
+    {
+        ResponseObj->SetNumberField(TEXT("cached_compile_ms"), CachedCompileMs);
+    }
     
     // Add warnings if any
     if (Warnings.Num() > 0)
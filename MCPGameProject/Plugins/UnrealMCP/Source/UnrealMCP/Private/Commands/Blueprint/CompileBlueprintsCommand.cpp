@@ -0,0 +1,287 @@
+#include "Commands/Blueprint/CompileBlueprintsCommand.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "MCPCommandHandle.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "HAL/PlatformTime.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    const TCHAR* StatusToString(EBlueprintStatus Status)
+    {
+        switch (Status)
+        {
+            case BS_UpToDate: return TEXT("compiled");
+            case BS_UpToDateWithWarnings: return TEXT("compiled_with_warnings");
+            case BS_Error: return TEXT("error");
+            case BS_Dirty: return TEXT("dirty");
+            default: return TEXT("not_compiled");
+        }
+    }
+    
+    TArray<TSharedPtr<FJsonValue>> StringsToJsonArray(const TArray<FString>& Strings)
+    {
+        TArray<TSharedPtr<FJsonValue>> Array;
+        Array.Reserve(Strings.Num());
+        for (const FString& String : Strings)
+        {
+            Array.Add(MakeShared<FJsonValueString>(String));
+        }
+        return Array;
+    }
+}
+
+FCompileBlueprintsCommand::FCompileBlueprintsCommand(IBlueprintService& InBlueprintService)
+    : BlueprintService(InBlueprintService)
+{
+}
+
+FString FCompileBlueprintsCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonParams;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    FJsonSerializer::Deserialize(Reader, JsonParams);
+    
+    TSharedPtr<FJsonObject> ResponseObj = ExecuteJson(JsonParams);
+    
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+TSharedPtr<FJsonObject> FCompileBlueprintsCommand::ExecuteJson(const TSharedPtr<FJsonObject>& Parameters)
+{
+    if (!ValidateParamsJson(Parameters))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide 'blueprint_names' (array of names or paths) and/or 'folder' (folder path or glob)"));
+    }
+    
+    const double StartTime = FPlatformTime::Seconds();
+    
+    FBlueprintBatchCompileParams CompileParams;
+    TArray<FString> Missing;
+    FString Error;
+    if (!ResolveBlueprints(Parameters, CompileParams.Blueprints, Missing, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    if (CompileParams.Blueprints.Num() == 0)
+    {
+        TSharedPtr<FJsonObject> ErrorObj = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No blueprints matched"));
+        ErrorObj->SetArrayField(TEXT("missing"), StringsToJsonArray(Missing));
+        return ErrorObj;
+    }
+    
+    double BatchSize = 0.0;
+    if (Parameters->TryGetNumberField(TEXT("batch_size"), BatchSize))
+    {
+        CompileParams.WaveSize = FMath::Max(static_cast<int32>(BatchSize), 0);
+    }
+    Parameters->TryGetBoolField(TEXT("force"), CompileParams.bForce);
+    
+    const double ResolveMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    const int32 Total = CompileParams.Blueprints.Num();
+    
+    if (FMCPCommandHandle::WantsCurrentProgress())
+    {
+        TSharedRef<FJsonObject> Progress = MakeShared<FJsonObject>();
+        Progress->SetStringField(TEXT("event"), TEXT("queued"));
+        Progress->SetNumberField(TEXT("total"), Total);
+        Progress->SetArrayField(TEXT("missing"), StringsToJsonArray(Missing));
+        Progress->SetNumberField(TEXT("resolve_ms"), ResolveMs);
+        FMCPCommandHandle::ReportCurrentProgress(Progress);
+    }
+    
+    // Stream each result as soon as its wave has compiled
+    int32 Reported = 0;
+    FBlueprintBatchCompileResult BatchResult;
+    BlueprintService.CompileBlueprints(CompileParams, BatchResult, [&Reported, Total](const FBlueprintCompileResult& Result)
+    {
+        ++Reported;
+        if (FMCPCommandHandle::WantsCurrentProgress())
+        {
+            TSharedRef<FJsonObject> Progress = CompileResultToJson(Result);
+            Progress->SetStringField(TEXT("event"), TEXT("compiled"));
+            Progress->SetNumberField(TEXT("index"), Reported);
+            Progress->SetNumberField(TEXT("total"), Total);
+            FMCPCommandHandle::ReportCurrentProgress(Progress);
+        }
+    });
+    
+    int32 FailedCount = 0;
+    int32 WarningCount = 0;
+    TArray<TSharedPtr<FJsonValue>> ResultArray;
+    ResultArray.Reserve(BatchResult.Results.Num());
+    for (const FBlueprintCompileResult& Result : BatchResult.Results)
+    {
+        FailedCount += Result.Status == BS_Error ? 1 : 0;
+        WarningCount += Result.Status == BS_UpToDateWithWarnings ? 1 : 0;
+        ResultArray.Add(MakeShared<FJsonValueObject>(CompileResultToJson(Result)));
+    }
+    
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), FailedCount == 0 && Missing.Num() == 0 && !BatchResult.bCancelled);
+    ResponseObj->SetNumberField(TEXT("total"), Total);
+    ResponseObj->SetNumberField(TEXT("compiled"), Reported - BatchResult.SkippedCount);
+    ResponseObj->SetNumberField(TEXT("skipped"), BatchResult.SkippedCount);
+    ResponseObj->SetNumberField(TEXT("failed"), FailedCount);
+    ResponseObj->SetNumberField(TEXT("with_warnings"), WarningCount);
+    ResponseObj->SetBoolField(TEXT("cancelled"), BatchResult.bCancelled);
+    ResponseObj->SetArrayField(TEXT("missing"), StringsToJsonArray(Missing));
+    ResponseObj->SetArrayField(TEXT("results"), ResultArray);
+    
+    TSharedPtr<FJsonObject> TimingsObj = MakeShared<FJsonObject>();
+    TimingsObj->SetNumberField(TEXT("resolve_ms"), ResolveMs);
+    TimingsObj->SetNumberField(TEXT("compile_ms"), BatchResult.CompileMs);
+    TimingsObj->SetNumberField(TEXT("total_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    TimingsObj->SetNumberField(TEXT("waves"), BatchResult.WaveCount);
+    ResponseObj->SetObjectField(TEXT("timings"), TimingsObj);
+    
+    return ResponseObj;
+}
+
+FString FCompileBlueprintsCommand::GetCommandName() const
+{
+    return TEXT("compile_blueprints");
+}
+
+bool FCompileBlueprintsCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonParams;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    return FJsonSerializer::Deserialize(Reader, JsonParams) && ValidateParamsJson(JsonParams);
+}
+
+bool FCompileBlueprintsCommand::ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const
+{
+    return Parameters.IsValid() && (Parameters->HasTypedField<EJson::Array>(TEXT("blueprint_names")) || Parameters->HasTypedField<EJson::String>(TEXT("folder")));
+}
+
+bool FCompileBlueprintsCommand::ResolveBlueprints(const TSharedPtr<FJsonObject>& Parameters, TArray<UBlueprint*>& OutBlueprints, TArray<FString>& OutMissing, FString& OutError) const
+{
+    TSet<UBlueprint*> Seen;
+    
+    const TArray<TSharedPtr<FJsonValue>>* NameValues = nullptr;
+    if (Parameters->TryGetArrayField(TEXT("blueprint_names"), NameValues))
+    {
+        for (const TSharedPtr<FJsonValue>& NameValue : *NameValues)
+        {
+            FString BlueprintName;
+            if (!NameValue.IsValid() || !NameValue->TryGetString(BlueprintName) || BlueprintName.IsEmpty())
+            {
+                OutError = TEXT("Every entry in 'blueprint_names' must be a non-empty string");
+                return false;
+            }
+            
+            UBlueprint* Blueprint = BlueprintService.FindBlueprint(BlueprintName);
+            if (!Blueprint)
+            {
+                OutMissing.Add(BlueprintName);
+                continue;
+            }
+            
+            bool bAlreadySeen = false;
+            Seen.Add(Blueprint, &bAlreadySeen);
+            if (!bAlreadySeen)
+            {
+                OutBlueprints.Add(Blueprint);
+            }
+        }
+    }
+    
+    FString FolderGlob;
+    if (Parameters->TryGetStringField(TEXT("folder"), FolderGlob))
+    {
+        if (!FolderGlob.StartsWith(TEXT("/")))
+        {
+            OutError = FString::Printf(TEXT("'folder' must be a content path such as /Game/Generated, got '%s'"), *FolderGlob);
+            return false;
+        }
+        
+        TArray<UBlueprint*> FolderBlueprints;
+        FindBlueprintsInFolder(FolderGlob, FolderBlueprints);
+        for (UBlueprint* Blueprint : FolderBlueprints)
+        {
+            bool bAlreadySeen = false;
+            Seen.Add(Blueprint, &bAlreadySeen);
+            if (!bAlreadySeen)
+            {
+                OutBlueprints.Add(Blueprint);
+            }
+        }
+    }
+    
+    return true;
+}
+
+void FCompileBlueprintsCommand::FindBlueprintsInFolder(const FString& FolderGlob, TArray<UBlueprint*>& OutBlueprints)
+{
+    // Only the part before the first wildcard narrows the registry query
+    int32 WildcardIndex = INDEX_NONE;
+    for (int32 Index = 0; Index < FolderGlob.Len(); ++Index)
+    {
+        if (FolderGlob[Index] == TEXT('*') || FolderGlob[Index] == TEXT('?'))
+        {
+            WildcardIndex = Index;
+            break;
+        }
+    }
+    
+    FString RootPath = FolderGlob;
+    if (WildcardIndex != INDEX_NONE)
+    {
+        // "/Game/UI/WBP_*" and "/Game/UI/*/WBP_*" both search under /Game/UI
+        RootPath = FolderGlob.Left(WildcardIndex);
+        RootPath.LeftInline(RootPath.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromEnd));
+    }
+    RootPath.RemoveFromEnd(TEXT("/"));
+    if (RootPath.IsEmpty())
+    {
+        RootPath = TEXT("/Game");
+    }
+    
+    FARFilter Filter;
+    Filter.PackagePaths.Add(FName(*RootPath));
+    Filter.bRecursivePaths = true;
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
+    
+    TArray<FAssetData> Assets;
+    IAssetRegistry::GetChecked().GetAssets(Filter, Assets);
+    Assets.Sort([](const FAssetData& A, const FAssetData& B)
+    {
+        return A.PackageName.LexicalLess(B.PackageName);
+    });
+    
+    for (const FAssetData& Asset : Assets)
+    {
+        // Globs are matched against the package path, e.g. /Game/UI/Menus/WBP_Main; * also matches across folders
+        if (WildcardIndex != INDEX_NONE && !Asset.PackageName.ToString().MatchesWildcard(FolderGlob))
+        {
+            continue;
+        }
+        if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset()))
+        {
+            OutBlueprints.Add(Blueprint);
+        }
+    }
+}
+
+TSharedRef<FJsonObject> FCompileBlueprintsCommand::CompileResultToJson(const FBlueprintCompileResult& Result)
+{
+    TSharedRef<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("blueprint_name"), Result.Name);
+    ResultObj->SetStringField(TEXT("path"), Result.Path);
+    ResultObj->SetStringField(TEXT("status"), StatusToString(Result.Status));
+    ResultObj->SetArrayField(TEXT("errors"), StringsToJsonArray(Result.Errors));
+    ResultObj->SetArrayField(TEXT("warnings"), StringsToJsonArray(Result.Warnings));
+    ResultObj->SetNumberField(TEXT("completed_at_ms"), Result.CompletedAtMs);
+    ResultObj->SetBoolField(TEXT("skipped"), Result.bSkipped);
+    return ResultObj;
+}
@@ -1,5 +1,6 @@
 #include "Commands/Blueprint/SetComponentPropertyCommand.h"
 #include "Services/PropertyService.h"
+#include "Services/AssetDirtySet.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -139,9 +140,10 @@ bool FSetComponentPropertyCommand::SetComponentProperties(UBlueprint* Blueprint,
         }
     }
     
-    // If not found in construction script, search inherited components on the CDO
+    // If not found in construction script, search inherited components on the CDO, compiling first if a deferred compile is pending
     if (!ComponentTemplate)
     {
+        FAssetDirtySet::Get().EnsureCompiled(Blueprint);
         UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
         AActor* DefaultActor = Cast<AActor>(DefaultObject);
         if (DefaultActor)
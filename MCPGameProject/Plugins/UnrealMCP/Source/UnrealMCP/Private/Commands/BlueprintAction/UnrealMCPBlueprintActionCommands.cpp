@@ -53,6 +53,9 @@
 // Additional includes for node creation
 #include "Utils/UnrealMCPCommonUtils.h"
 #include "Commands/BlueprintNode/UnrealMCPNodeCreators.h"
+#include "Services/BlueprintActionSearchIndex.h"
+#include "Services/BlueprintActionResultCache.h"
+#include "Services/NodePinCatalog.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
@@ -253,6 +256,14 @@ void AddBlueprintVariableActions(UBlueprint* Blueprint, const FString& SearchFil
 
 FString UUnrealMCPBlueprintActionCommands::GetActionsForPin(const FString& PinType, const FString& PinSubCategory, const FString& SearchFilter, int32 MaxResults)
 {
+    // Results only change when the set of actions does, so repeated queries are served from the cache
+    const FString CacheKey = FBlueprintActionResultCache::MakeKey(TEXT("pin"), PinType + TEXT("/") + PinSubCategory, SearchFilter, MaxResults);
+    FString CachedResult;
+    if (FBlueprintActionResultCache::Get().Find(CacheKey, CachedResult))
+    {
+        return CachedResult;
+    }
+    
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     TArray<TSharedPtr<FJsonValue>> ActionsArray;
     
@@ -577,11 +588,21 @@ FString UUnrealMCPBlueprintActionCommands::GetActionsForPin(const FString& PinTy
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
     FJsonSerializer::Serialize(ResultObj.ToSharedRef(), Writer);
     
+    FBlueprintActionResultCache::Get().Store(CacheKey, OutputString);
+    
     return OutputString;
 }
 
 FString UUnrealMCPBlueprintActionCommands::GetActionsForClass(const FString& ClassName, const FString& SearchFilter, int32 MaxResults)
 {
+    // Results only change when the set of actions does, so repeated queries are served from the cache
+    const FString CacheKey = FBlueprintActionResultCache::MakeKey(TEXT("class"), ClassName, SearchFilter, MaxResults);
+    FString CachedResult;
+    if (FBlueprintActionResultCache::Get().Find(CacheKey, CachedResult))
+    {
+        return CachedResult;
+    }
+    
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     TArray<TSharedPtr<FJsonValue>> ActionsArray;
     
@@ -801,11 +822,25 @@ FString UUnrealMCPBlueprintActionCommands::GetActionsForClass(const FString& Cla
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
     FJsonSerializer::Serialize(ResultObj.ToSharedRef(), Writer);
     
+    // A class that is not loaded yet may be found later without any invalidation event
+    if (TargetClass)
+    {
+        FBlueprintActionResultCache::Get().Store(CacheKey, OutputString);
+    }
+    
     return OutputString;
 }
 
 FString UUnrealMCPBlueprintActionCommands::GetActionsForClassHierarchy(const FString& ClassName, const FString& SearchFilter, int32 MaxResults)
 {
+    // Results only change when the set of actions does, so repeated queries are served from the cache
+    const FString CacheKey = FBlueprintActionResultCache::MakeKey(TEXT("hierarchy"), ClassName, SearchFilter, MaxResults);
+    FString CachedResult;
+    if (FBlueprintActionResultCache::Get().Find(CacheKey, CachedResult))
+    {
+        return CachedResult;
+    }
+    
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     TArray<TSharedPtr<FJsonValue>> ActionsArray;
     TArray<TSharedPtr<FJsonValue>> HierarchyArray;
@@ -1075,6 +1110,12 @@ FString UUnrealMCPBlueprintActionCommands::GetActionsForClassHierarchy(const FSt
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
     FJsonSerializer::Serialize(ResultObj.ToSharedRef(), Writer);
     
+    // A class that is not loaded yet may be found later without any invalidation event
+    if (TargetClass)
+    {
+        FBlueprintActionResultCache::Get().Store(CacheKey, OutputString);
+    }
+    
     return OutputString;
 }
 
@@ -1082,328 +1123,46 @@ FString UUnrealMCPBlueprintActionCommands::GetNodePinInfo(const FString& NodeNam
 {
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     
-    UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Looking for pin '%s' on node '%s'"), *PinName, *NodeName);
-    
-    // Define known node pin information
-    TMap<FString, TMap<FString, TSharedPtr<FJsonObject>>> NodePinDatabase;
-    
-    // Create Widget node
-    TMap<FString, TSharedPtr<FJsonObject>> CreateWidgetPins;
-    
-    auto ClassPin = MakeShared<FJsonObject>();
-    ClassPin->SetStringField(TEXT("pin_type"), TEXT("class"));
-    ClassPin->SetStringField(TEXT("expected_type"), TEXT("Class<UserWidget>"));
-    ClassPin->SetStringField(TEXT("description"), TEXT("The widget class to instantiate"));
-    ClassPin->SetBoolField(TEXT("is_required"), true);
-    ClassPin->SetBoolField(TEXT("is_input"), true);
-    CreateWidgetPins.Add(TEXT("Class"), ClassPin);
-    
-    auto OwningPlayerPin = MakeShared<FJsonObject>();
-    OwningPlayerPin->SetStringField(TEXT("pin_type"), TEXT("object"));
-    OwningPlayerPin->SetStringField(TEXT("expected_type"), TEXT("PlayerController"));
-    OwningPlayerPin->SetStringField(TEXT("description"), TEXT("The player controller that owns this widget"));
-    OwningPlayerPin->SetBoolField(TEXT("is_required"), false);
-    OwningPlayerPin->SetBoolField(TEXT("is_input"), true);
-    CreateWidgetPins.Add(TEXT("Owning Player"), OwningPlayerPin);
-    CreateWidgetPins.Add(TEXT("OwningPlayer"), OwningPlayerPin); // Alternative name
-    
-    auto ReturnValuePin = MakeShared<FJsonObject>();
-    ReturnValuePin->SetStringField(TEXT("pin_type"), TEXT("object"));
-    ReturnValuePin->SetStringField(TEXT("expected_type"), TEXT("UserWidget"));
-    ReturnValuePin->SetStringField(TEXT("description"), TEXT("The created widget instance"));
-    ReturnValuePin->SetBoolField(TEXT("is_required"), false);
-    ReturnValuePin->SetBoolField(TEXT("is_input"), false);
-    CreateWidgetPins.Add(TEXT("Return Value"), ReturnValuePin);
-    
-    NodePinDatabase.Add(TEXT("Create Widget"), CreateWidgetPins);
-    NodePinDatabase.Add(TEXT("CreateWidget"), CreateWidgetPins);
-    
-    // Get Controller node
-    TMap<FString, TSharedPtr<FJsonObject>> GetControllerPins;
-    
-    auto TargetPin = MakeShared<FJsonObject>();
-    TargetPin->SetStringField(TEXT("pin_type"), TEXT("object"));
-    TargetPin->SetStringField(TEXT("expected_type"), TEXT("Pawn"));
-    TargetPin->SetStringField(TEXT("description"), TEXT("The pawn to get the controller from"));
-    TargetPin->SetBoolField(TEXT("is_required"), true);
-    TargetPin->SetBoolField(TEXT("is_input"), true);
-    GetControllerPins.Add(TEXT("Target"), TargetPin);
-    
-    auto ControllerReturnPin = MakeShared<FJsonObject>();
-    ControllerReturnPin->SetStringField(TEXT("pin_type"), TEXT("object"));
-    ControllerReturnPin->SetStringField(TEXT("expected_type"), TEXT("Controller"));
-    ControllerReturnPin->SetStringField(TEXT("description"), TEXT("The controller possessing this pawn"));
-    ControllerReturnPin->SetBoolField(TEXT("is_required"), false);
-    ControllerReturnPin->SetBoolField(TEXT("is_input"), false);
-    GetControllerPins.Add(TEXT("Return Value"), ControllerReturnPin);
-    
-    NodePinDatabase.Add(TEXT("Get Controller"), GetControllerPins);
-    NodePinDatabase.Add(TEXT("GetController"), GetControllerPins);
-    
-    // Cast To nodes
-    TMap<FString, TSharedPtr<FJsonObject>> CastToPins;
-    
-    auto ObjectPin = MakeShared<FJsonObject>();
-    ObjectPin->SetStringField(TEXT("pin_type"), TEXT("object"));
-    ObjectPin->SetStringField(TEXT("expected_type"), TEXT("Object"));
-    ObjectPin->SetStringField(TEXT("description"), TEXT("The object to cast"));
-    ObjectPin->SetBoolField(TEXT("is_required"), true);
-    ObjectPin->SetBoolField(TEXT("is_input"), true);
-    CastToPins.Add(TEXT("Object"), ObjectPin);
-    
-    auto CastSuccessPin = MakeShared<FJsonObject>();
-    CastSuccessPin->SetStringField(TEXT("pin_type"), TEXT("exec"));
-    CastSuccessPin->SetStringField(TEXT("expected_type"), TEXT("exec"));
-    CastSuccessPin->SetStringField(TEXT("description"), TEXT("Execution path if cast succeeds"));
-    CastSuccessPin->SetBoolField(TEXT("is_required"), false);
-    CastSuccessPin->SetBoolField(TEXT("is_input"), false);
-    CastToPins.Add(TEXT("Cast Success"), CastSuccessPin);
-    
-    auto CastFailPin = MakeShared<FJsonObject>();
-    CastFailPin->SetStringField(TEXT("pin_type"), TEXT("exec"));
-    CastFailPin->SetStringField(TEXT("expected_type"), TEXT("exec"));
-    CastFailPin->SetStringField(TEXT("description"), TEXT("Execution path if cast fails"));
-    CastFailPin->SetBoolField(TEXT("is_required"), false);
-    CastFailPin->SetBoolField(TEXT("is_input"), false);
-    CastToPins.Add(TEXT("Cast Failed"), CastFailPin);
-    
-    NodePinDatabase.Add(TEXT("Cast to PlayerController"), CastToPins);
-    NodePinDatabase.Add(TEXT("Cast to"), CastToPins);
-    
-    // SelectFloat node (KismetMathLibrary)
-    TMap<FString, TSharedPtr<FJsonObject>> SelectFloatPins;
-    
-    auto SelectFloatAPin = MakeShared<FJsonObject>();
-    SelectFloatAPin->SetStringField(TEXT("pin_type"), TEXT("real"));
-    SelectFloatAPin->SetStringField(TEXT("expected_type"), TEXT("float"));
-    SelectFloatAPin->SetStringField(TEXT("description"), TEXT("First float value option"));
-    SelectFloatAPin->SetBoolField(TEXT("is_required"), true);
-    SelectFloatAPin->SetBoolField(TEXT("is_input"), true);
-    SelectFloatPins.Add(TEXT("A"), SelectFloatAPin);
-    
-    auto SelectFloatBPin = MakeShared<FJsonObject>();
-    SelectFloatBPin->SetStringField(TEXT("pin_type"), TEXT("real"));
-    SelectFloatBPin->SetStringField(TEXT("expected_type"), TEXT("float"));
-    SelectFloatBPin->SetStringField(TEXT("description"), TEXT("Second float value option"));
-    SelectFloatBPin->SetBoolField(TEXT("is_required"), true);
-    SelectFloatBPin->SetBoolField(TEXT("is_input"), true);
-    SelectFloatPins.Add(TEXT("B"), SelectFloatBPin);
-    
-    auto SelectFloatPickAPin = MakeShared<FJsonObject>();
-    SelectFloatPickAPin->SetStringField(TEXT("pin_type"), TEXT("bool"));
-    SelectFloatPickAPin->SetStringField(TEXT("expected_type"), TEXT("boolean"));
-    SelectFloatPickAPin->SetStringField(TEXT("description"), TEXT("If true, returns A; if false, returns B"));
-    SelectFloatPickAPin->SetBoolField(TEXT("is_required"), true);
-    SelectFloatPickAPin->SetBoolField(TEXT("is_input"), true);
-    SelectFloatPins.Add(TEXT("bPickA"), SelectFloatPickAPin);
-    SelectFloatPins.Add(TEXT("Pick A"), SelectFloatPickAPin); // Alternative name
-    
-    auto SelectFloatReturnPin = MakeShared<FJsonObject>();
-    SelectFloatReturnPin->SetStringField(TEXT("pin_type"), TEXT("real"));
-    SelectFloatReturnPin->SetStringField(TEXT("expected_type"), TEXT("float"));
-    SelectFloatReturnPin->SetStringField(TEXT("description"), TEXT("The selected float value (A or B)"));
-    SelectFloatReturnPin->SetBoolField(TEXT("is_required"), false);
-    SelectFloatReturnPin->SetBoolField(TEXT("is_input"), false);
-    SelectFloatPins.Add(TEXT("ReturnValue"), SelectFloatReturnPin);
-    SelectFloatPins.Add(TEXT("Return Value"), SelectFloatReturnPin); // Alternative name
-    
-    NodePinDatabase.Add(TEXT("SelectFloat"), SelectFloatPins);
-    NodePinDatabase.Add(TEXT("Select Float"), SelectFloatPins);
-    
-    // RandomFloat node (KismetMathLibrary)
-    TMap<FString, TSharedPtr<FJsonObject>> RandomFloatPins;
+    UE_LOG(LogTemp, Verbose, TEXT("GetNodePinInfo: Looking for pin '%s' on node '%s'"), *PinName, *NodeName);
     
-    auto RandomFloatReturnPin = MakeShared<FJsonObject>();
-    RandomFloatReturnPin->SetStringField(TEXT("pin_type"), TEXT("real"));
-    RandomFloatReturnPin->SetStringField(TEXT("expected_type"), TEXT("float"));
-    RandomFloatReturnPin->SetStringField(TEXT("description"), TEXT("Random float value between 0.0 and 1.0"));
-    RandomFloatReturnPin->SetBoolField(TEXT("is_required"), false);
-    RandomFloatReturnPin->SetBoolField(TEXT("is_input"), false);
-    RandomFloatPins.Add(TEXT("ReturnValue"), RandomFloatReturnPin);
-    RandomFloatPins.Add(TEXT("Return Value"), RandomFloatReturnPin);
+    // Known nodes come from the static catalog; other nodes are described from their action database template
+    FNodePinCatalog& PinCatalog = FNodePinCatalog::Get();
+    bool bLookupTimedOut = false;
+    TSharedPtr<const FNodePinSet> NodePins = PinCatalog.FindNode(NodeName, bLookupTimedOut);
+    const FNodePinInfo* PinInfo = nullptr;
     
-    NodePinDatabase.Add(TEXT("RandomFloat"), RandomFloatPins);
-    NodePinDatabase.Add(TEXT("Random Float"), RandomFloatPins);
-    
-    // MultiplyByPi node (KismetMathLibrary)
-    TMap<FString, TSharedPtr<FJsonObject>> MultiplyByPiPins;
-    
-    auto MultiplyByPiValuePin = MakeShared<FJsonObject>();
-    MultiplyByPiValuePin->SetStringField(TEXT("pin_type"), TEXT("real"));
-    MultiplyByPiValuePin->SetStringField(TEXT("expected_type"), TEXT("float"));
-    MultiplyByPiValuePin->SetStringField(TEXT("description"), TEXT("Value to multiply by Pi"));
-    MultiplyByPiValuePin->SetBoolField(TEXT("is_required"), true);
-    MultiplyByPiValuePin->SetBoolField(TEXT("is_input"), true);
-    MultiplyByPiPins.Add(TEXT("Value"), MultiplyByPiValuePin);
-    
-    auto MultiplyByPiReturnPin = MakeShared<FJsonObject>();
-    MultiplyByPiReturnPin->SetStringField(TEXT("pin_type"), TEXT("real"));
-    MultiplyByPiReturnPin->SetStringField(TEXT("expected_type"), TEXT("float"));
-    MultiplyByPiReturnPin->SetStringField(TEXT("description"), TEXT("Value multiplied by Pi"));
-    MultiplyByPiReturnPin->SetBoolField(TEXT("is_required"), false);
-    MultiplyByPiReturnPin->SetBoolField(TEXT("is_input"), false);
-    MultiplyByPiPins.Add(TEXT("ReturnValue"), MultiplyByPiReturnPin);
-    MultiplyByPiPins.Add(TEXT("Return Value"), MultiplyByPiReturnPin);
-    
-    NodePinDatabase.Add(TEXT("MultiplyByPi"), MultiplyByPiPins);
-    NodePinDatabase.Add(TEXT("Multiply By Pi"), MultiplyByPiPins);
-    
-    // Get Hidden node (Actor property)
-    TMap<FString, TSharedPtr<FJsonObject>> GetHiddenPins;
-    
-    auto GetHiddenSelfPin = MakeShared<FJsonObject>();
-    GetHiddenSelfPin->SetStringField(TEXT("pin_type"), TEXT("object"));
-    GetHiddenSelfPin->SetStringField(TEXT("expected_type"), TEXT("Actor"));
-    GetHiddenSelfPin->SetStringField(TEXT("description"), TEXT("The actor to get the hidden property from"));
-    GetHiddenSelfPin->SetBoolField(TEXT("is_required"), true);
-    GetHiddenSelfPin->SetBoolField(TEXT("is_input"), true);
-    GetHiddenPins.Add(TEXT("self"), GetHiddenSelfPin);
-    GetHiddenPins.Add(TEXT("Target"), GetHiddenSelfPin); // Alternative name
-    
-    auto GetHiddenReturnPin = MakeShared<FJsonObject>();
-    GetHiddenReturnPin->SetStringField(TEXT("pin_type"), TEXT("bool"));
-    GetHiddenReturnPin->SetStringField(TEXT("expected_type"), TEXT("boolean"));
-    GetHiddenReturnPin->SetStringField(TEXT("description"), TEXT("Whether the actor is hidden"));
-    GetHiddenReturnPin->SetBoolField(TEXT("is_required"), false);
-    GetHiddenReturnPin->SetBoolField(TEXT("is_input"), false);
-    GetHiddenPins.Add(TEXT("bHidden"), GetHiddenReturnPin);
-    GetHiddenPins.Add(TEXT("Hidden"), GetHiddenReturnPin); // Alternative name
-    
-    NodePinDatabase.Add(TEXT("Get Hidden"), GetHiddenPins);
-    NodePinDatabase.Add(TEXT("GetHidden"), GetHiddenPins);
-    
-    // For Each Loop (Map) node
-    TMap<FString, TSharedPtr<FJsonObject>> ForEachMapPins;
-    
-    auto ForEachMapExecPin = MakeShared<FJsonObject>();
-    ForEachMapExecPin->SetStringField(TEXT("pin_type"), TEXT("exec"));
-    ForEachMapExecPin->SetStringField(TEXT("expected_type"), TEXT("exec"));
-    ForEachMapExecPin->SetStringField(TEXT("description"), TEXT("Execution input to start the loop"));
-    ForEachMapExecPin->SetBoolField(TEXT("is_required"), true);
-    ForEachMapExecPin->SetBoolField(TEXT("is_input"), true);
-    ForEachMapPins.Add(TEXT("execute"), ForEachMapExecPin);
-    ForEachMapPins.Add(TEXT("Exec"), ForEachMapExecPin); // Alternative name
-    
-    auto ForEachMapPin = MakeShared<FJsonObject>();
-    ForEachMapPin->SetStringField(TEXT("pin_type"), TEXT("wildcard"));
-    ForEachMapPin->SetStringField(TEXT("expected_type"), TEXT("Map"));
-    ForEachMapPin->SetStringField(TEXT("description"), TEXT("The map to iterate over"));
-    ForEachMapPin->SetBoolField(TEXT("is_required"), true);
-    ForEachMapPin->SetBoolField(TEXT("is_input"), true);
-    ForEachMapPins.Add(TEXT("MapPin"), ForEachMapPin);
-    ForEachMapPins.Add(TEXT("Map"), ForEachMapPin); // Alternative name
-    
-    auto ForEachMapThenPin = MakeShared<FJsonObject>();
-    ForEachMapThenPin->SetStringField(TEXT("pin_type"), TEXT("exec"));
-    ForEachMapThenPin->SetStringField(TEXT("expected_type"), TEXT("exec"));
-    ForEachMapThenPin->SetStringField(TEXT("description"), TEXT("Execution output for each iteration"));
-    ForEachMapThenPin->SetBoolField(TEXT("is_required"), false);
-    ForEachMapThenPin->SetBoolField(TEXT("is_input"), false);
-    ForEachMapPins.Add(TEXT("then"), ForEachMapThenPin);
-    ForEachMapPins.Add(TEXT("Loop Body"), ForEachMapThenPin); // Alternative name
-    
-    auto ForEachMapKeyPin = MakeShared<FJsonObject>();
-    ForEachMapKeyPin->SetStringField(TEXT("pin_type"), TEXT("wildcard"));
-    ForEachMapKeyPin->SetStringField(TEXT("expected_type"), TEXT("Key"));
-    ForEachMapKeyPin->SetStringField(TEXT("description"), TEXT("Current key in the iteration"));
-    ForEachMapKeyPin->SetBoolField(TEXT("is_required"), false);
-    ForEachMapKeyPin->SetBoolField(TEXT("is_input"), false);
-    ForEachMapPins.Add(TEXT("KeyPin"), ForEachMapKeyPin);
-    ForEachMapPins.Add(TEXT("Key"), ForEachMapKeyPin); // Alternative name
-    
-    auto ForEachMapValuePin = MakeShared<FJsonObject>();
-    ForEachMapValuePin->SetStringField(TEXT("pin_type"), TEXT("wildcard"));
-    ForEachMapValuePin->SetStringField(TEXT("expected_type"), TEXT("Value"));
-    ForEachMapValuePin->SetStringField(TEXT("description"), TEXT("Current value in the iteration"));
-    ForEachMapValuePin->SetBoolField(TEXT("is_required"), false);
-    ForEachMapValuePin->SetBoolField(TEXT("is_input"), false);
-    ForEachMapPins.Add(TEXT("ValuePin"), ForEachMapValuePin);
-    ForEachMapPins.Add(TEXT("Value"), ForEachMapValuePin); // Alternative name
-    
-    auto ForEachMapCompletedPin = MakeShared<FJsonObject>();
-    ForEachMapCompletedPin->SetStringField(TEXT("pin_type"), TEXT("exec"));
-    ForEachMapCompletedPin->SetStringField(TEXT("expected_type"), TEXT("exec"));
-    ForEachMapCompletedPin->SetStringField(TEXT("description"), TEXT("Execution output when loop completes"));
-    ForEachMapCompletedPin->SetBoolField(TEXT("is_required"), false);
-    ForEachMapCompletedPin->SetBoolField(TEXT("is_input"), false);
-    ForEachMapPins.Add(TEXT("CompletedPin"), ForEachMapCompletedPin);
-    ForEachMapPins.Add(TEXT("Completed"), ForEachMapCompletedPin); // Alternative name
-    
-    NodePinDatabase.Add(TEXT("For Each Loop (Map)"), ForEachMapPins);
-    NodePinDatabase.Add(TEXT("ForEachLoop(Map)"), ForEachMapPins);
-    NodePinDatabase.Add(TEXT("For Each Loop Map"), ForEachMapPins);
-    
-    // Look up the requested node and pin with flexible matching
-    FString NormalizedNodeName = NodeName;
-    NormalizedNodeName = NormalizedNodeName.Replace(TEXT(" "), TEXT(""));
-    
-    TSharedPtr<FJsonObject> PinInfo = nullptr;
-    FString FoundNodeKey;
-    TMap<FString, TSharedPtr<FJsonObject>>* FoundPinMap = nullptr;
-    
-    // Try exact match first
-    if (NodePinDatabase.Contains(NodeName))
+    if (bLookupTimedOut)
     {
-        FoundNodeKey = NodeName;
-        FoundPinMap = &NodePinDatabase[NodeName];
-    }
-    // Try normalized match (no spaces)
-    else if (NodePinDatabase.Contains(NormalizedNodeName))
-    {
-        FoundNodeKey = NormalizedNodeName;
-        FoundPinMap = &NodePinDatabase[NormalizedNodeName];
-    }
-    // Try case-insensitive match
-    else
-    {
-        for (const auto& NodeEntry : NodePinDatabase)
-        {
-            if (NodeEntry.Key.Equals(NodeName, ESearchCase::IgnoreCase) ||
-                NodeEntry.Key.Replace(TEXT(" "), TEXT("")).Equals(NormalizedNodeName, ESearchCase::IgnoreCase))
-            {
-                FoundNodeKey = NodeEntry.Key;
-                FoundPinMap = const_cast<TMap<FString, TSharedPtr<FJsonObject>>*>(&NodeEntry.Value);
-                break;
-            }
-        }
+        // The game thread was too busy to scan the action database; the node may well exist
+        ResultObj->SetBoolField(TEXT("success"), false);
+        ResultObj->SetStringField(TEXT("node_name"), NodeName);
+        ResultObj->SetStringField(TEXT("pin_name"), PinName);
+        ResultObj->SetStringField(TEXT("error_type"), TEXT("timeout"));
+        ResultObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Timed out waiting for the game thread to look up node '%s'; the editor is busy, retry the request"), *NodeName));
+        
+        FString OutputString;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+        FJsonSerializer::Serialize(ResultObj.ToSharedRef(), Writer);
+        return OutputString;
     }
     
-    // Look for the pin in the found node
-    if (FoundPinMap)
+    if (NodePins.IsValid())
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Found node '%s' (matched with '%s')"), *FoundNodeKey, *NodeName);
-        
-        // Try exact pin name match first
-        if (FoundPinMap->Contains(PinName))
-        {
-            PinInfo = (*FoundPinMap)[PinName];
-            UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Found exact pin match '%s'"), *PinName);
-        }
-        // Try case-insensitive pin match
-        else
-        {
-            for (const auto& PinEntry : *FoundPinMap)
-            {
-                if (PinEntry.Key.Equals(PinName, ESearchCase::IgnoreCase))
-                {
-                    PinInfo = PinEntry.Value;
-                    UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Found case-insensitive pin match '%s' -> '%s'"), *PinName, *PinEntry.Key);
-                    break;
-                }
-            }
-        }
+        UE_LOG(LogTemp, Verbose, TEXT("GetNodePinInfo: Found node '%s' (matched with '%s')"), *NodePins->NodeKey, *NodeName);
+        PinInfo = NodePins->FindPin(PinName);
     }
     else
     {
         UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Node '%s' not found in database"), *NodeName);
     }
     
-    if (PinInfo.IsValid())
+    if (PinInfo)
     {
         ResultObj->SetBoolField(TEXT("success"), true);
         ResultObj->SetStringField(TEXT("node_name"), NodeName);
         ResultObj->SetStringField(TEXT("pin_name"), PinName);
-        ResultObj->SetObjectField(TEXT("pin_info"), PinInfo);
+        ResultObj->SetObjectField(TEXT("pin_info"), PinInfo->ToJson());
+        ResultObj->SetStringField(TEXT("source"), NodePins->bFromTemplate ? TEXT("template") : TEXT("catalog"));
         ResultObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Found pin information for '%s' on node '%s'"), *PinName, *NodeName));
     }
     else
@@ -1415,26 +1174,27 @@ FString UUnrealMCPBlueprintActionCommands::GetNodePinInfo(const FString& NodeNam
         ResultObj->SetStringField(TEXT("error"), FString::Printf(TEXT("No pin information found for '%s' on node '%s'"), *PinName, *NodeName));
         
         // Provide available pins for this node if we know the node
-        if (FoundPinMap)
+        if (NodePins.IsValid())
         {
             TArray<TSharedPtr<FJsonValue>> AvailablePins;
-            for (const auto& Pin : *FoundPinMap)
+            AvailablePins.Reserve(NodePins->PinNames.Num());
+            for (const FString& AvailablePin : NodePins->PinNames)
             {
-                AvailablePins.Add(MakeShared<FJsonValueString>(Pin.Key));
+                AvailablePins.Add(MakeShared<FJsonValueString>(AvailablePin));
             }
             ResultObj->SetArrayField(TEXT("available_pins"), AvailablePins);
-            UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Provided %d available pins for node '%s'"), AvailablePins.Num(), *FoundNodeKey);
         }
         else
         {
             // Provide list of known nodes
+            const TArray<FString>& CatalogNodeNames = PinCatalog.GetCatalogNodeNames();
             TArray<TSharedPtr<FJsonValue>> AvailableNodes;
-            for (const auto& NodeEntry : NodePinDatabase)
+            AvailableNodes.Reserve(CatalogNodeNames.Num());
+            for (const FString& AvailableNode : CatalogNodeNames)
             {
-                AvailableNodes.Add(MakeShared<FJsonValueString>(NodeEntry.Key));
+                AvailableNodes.Add(MakeShared<FJsonValueString>(AvailableNode));
             }
             ResultObj->SetArrayField(TEXT("available_nodes"), AvailableNodes);
-            UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Provided %d available nodes"), AvailableNodes.Num());
         }
     }
     
@@ -1442,8 +1202,6 @@ FString UUnrealMCPBlueprintActionCommands::GetNodePinInfo(const FString& NodeNam
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
     FJsonSerializer::Serialize(ResultObj.ToSharedRef(), Writer);
     
-    UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Returning JSON response: %s"), *OutputString);
-    
     return OutputString;
 }
 
@@ -1569,155 +1327,33 @@ FString UUnrealMCPBlueprintActionCommands::SearchBlueprintActions(const FString&
         }
     }
     
-    // Get the blueprint action database
-    FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
-    FBlueprintActionDatabase::FActionRegistry const& ActionRegistry = ActionDatabase.GetAllActions();
+    // Query the prebuilt index instead of describing every action in the database
+    TArray<FBlueprintActionSearchEntry> Matches;
+    const int32 RemainingResults = FMath::Max(0, MaxResults - ActionsArray.Num());
+    FBlueprintActionSearchIndex::Get().Search(SearchQuery, Category, RemainingResults, Matches);
     
-    UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Searching for '%s' in category '%s'"), *SearchQuery, *Category);
-    UE_LOG(LogTemp, Warning, TEXT("Total actions in database: %d"), ActionRegistry.Num());
+    UE_LOG(LogTemp, Verbose, TEXT("SearchBlueprintActions: '%s' in category '%s' matched %d indexed actions"), *SearchQuery, *Category, Matches.Num());
     
-    // Search through all actions
-    for (const auto& ActionPair : ActionRegistry)
+    for (const FBlueprintActionSearchEntry& Match : Matches)
     {
-        for (const UBlueprintNodeSpawner* NodeSpawner : ActionPair.Value)
+        TSharedPtr<FJsonObject> ActionObj = MakeShared<FJsonObject>();
+        ActionObj->SetStringField(TEXT("title"), Match.Title);
+        ActionObj->SetStringField(TEXT("tooltip"), Match.Tooltip);
+        ActionObj->SetStringField(TEXT("category"), Match.Category);
+        ActionObj->SetStringField(TEXT("keywords"), Match.Keywords);
+        ActionObj->SetStringField(TEXT("node_type"), Match.NodeType);
+        
+        if (!Match.FunctionName.IsEmpty())
         {
-            if (NodeSpawner && IsValid(NodeSpawner))
+            ActionObj->SetStringField(TEXT("function_name"), Match.FunctionName);
+            ActionObj->SetStringField(TEXT("class_name"), Match.ClassName);
+            if (Match.bIsMathFunction)
             {
-                UEdGraphNode* TemplateNode = NodeSpawner->GetTemplateNode();
-                if (!TemplateNode)
-                {
-                    continue;
-                }
-                
-                FString ActionName = TEXT("Unknown Action");
-                FString ActionCategory = TEXT("Unknown");
-                FString Tooltip = TEXT("");
-                FString Keywords = TEXT("");
-                FString NodeType = TEXT("Unknown");
-                
-                // Determine node type and get information
-                if (TemplateNode->IsA<UK2Node_IfThenElse>())
-                {
-                    ActionName = TEXT("Branch");
-                    ActionCategory = TEXT("Flow Control");
-                    NodeType = TEXT("Branch");
-                    Tooltip = TEXT("Conditional execution based on boolean input");
-                    Keywords = TEXT("if then else conditional branch bool boolean");
-                }
-                else if (TemplateNode->IsA<UK2Node_ExecutionSequence>())
-                {
-                    ActionName = TEXT("Sequence");
-                    ActionCategory = TEXT("Flow Control");
-                    NodeType = TEXT("Sequence");
-                    Tooltip = TEXT("Execute multiple outputs in order");
-                    Keywords = TEXT("sequence multiple execution order flow");
-                }
-                else if (TemplateNode->IsA<UK2Node_DynamicCast>())
-                {
-                    ActionName = TEXT("Cast");
-                    ActionCategory = TEXT("Utilities");
-                    NodeType = TEXT("Cast");
-                    Tooltip = TEXT("Cast object to different type");
-                    Keywords = TEXT("cast convert type object class");
-                }
-                else if (TemplateNode->IsA<UK2Node_CustomEvent>())
-                {
-                    ActionName = TEXT("Custom Event");
-                    ActionCategory = TEXT("Events");
-                    NodeType = TEXT("CustomEvent");
-                    Tooltip = TEXT("Create custom event that can be called");
-                    Keywords = TEXT("custom event call dispatch");
-                }
-                else if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
-                {
-                    if (UFunction* Function = FunctionNode->GetTargetFunction())
-                    {
-                        ActionName = Function->GetName();
-                        UClass* OwnerClass = Function->GetOwnerClass();
-                        ActionCategory = OwnerClass->GetName();
-                        
-                        // Better categorization
-                        if (OwnerClass == UKismetMathLibrary::StaticClass())
-                        {
-                            ActionCategory = TEXT("Math");
-                            Keywords = TEXT("math mathematics calculation");
-                        }
-                        else if (OwnerClass == UKismetSystemLibrary::StaticClass())
-                        {
-                            ActionCategory = TEXT("Utilities");
-                            Keywords = TEXT("system utility helper");
-                        }
-                        else if (OwnerClass == UGameplayStatics::StaticClass())
-                        {
-                            ActionCategory = TEXT("Game");
-                            Keywords = TEXT("gameplay game static");
-                        }
-                        
-                        NodeType = TEXT("Function");
-                    }
-                }
-                else if (UK2Node* K2Node = Cast<UK2Node>(TemplateNode))
-                {
-                    ActionName = K2Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-                    if (ActionName.IsEmpty())
-                    {
-                        ActionName = K2Node->GetClass()->GetName();
-                    }
-                    NodeType = K2Node->GetClass()->GetName();
-                    ActionCategory = TEXT("Node");
-                }
-                
-                // Apply search and category filters
-                FString SearchLower = SearchQuery.ToLower();
-                FString ActionNameLower = ActionName.ToLower();
-                FString ActionCategoryLower = ActionCategory.ToLower();
-                FString TooltipLower = Tooltip.ToLower();
-                FString KeywordsLower = Keywords.ToLower();
-                
-                bool bMatchesSearch = ActionNameLower.Contains(SearchLower) ||
-                                     ActionCategoryLower.Contains(SearchLower) ||
-                                     TooltipLower.Contains(SearchLower) ||
-                                     KeywordsLower.Contains(SearchLower);
-                
-                bool bMatchesCategory = Category.IsEmpty() || ActionCategoryLower.Contains(Category.ToLower());
-                
-                if (bMatchesSearch && bMatchesCategory)
-                {
-                    TSharedPtr<FJsonObject> ActionObj = MakeShared<FJsonObject>();
-                    ActionObj->SetStringField(TEXT("title"), ActionName);
-                    ActionObj->SetStringField(TEXT("tooltip"), Tooltip);
-                    ActionObj->SetStringField(TEXT("category"), ActionCategory);
-                    ActionObj->SetStringField(TEXT("keywords"), Keywords);
-                    ActionObj->SetStringField(TEXT("node_type"), NodeType);
-                    
-                    if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
-                    {
-                        if (UFunction* Function = FunctionNode->GetTargetFunction())
-                        {
-                            ActionObj->SetStringField(TEXT("function_name"), Function->GetName());
-                            ActionObj->SetStringField(TEXT("class_name"), Function->GetOwnerClass()->GetName());
-                            if (Function->GetOwnerClass() == UKismetMathLibrary::StaticClass())
-                            {
-                                ActionObj->SetBoolField(TEXT("is_math_function"), true);
-                            }
-                        }
-                    }
-                    
-                    ActionsArray.Add(MakeShared<FJsonValueObject>(ActionObj));
-                    
-                    // Limit results
-                    if (ActionsArray.Num() >= MaxResults)
-                    {
-                        break;
-                    }
-                }
+                ActionObj->SetBoolField(TEXT("is_math_function"), true);
             }
         }
         
-        if (ActionsArray.Num() >= MaxResults)
-        {
-            break;
-        }
+        ActionsArray.Add(MakeShared<FJsonValueObject>(ActionObj));
     }
     
     ResultObj->SetBoolField(TEXT("success"), true);
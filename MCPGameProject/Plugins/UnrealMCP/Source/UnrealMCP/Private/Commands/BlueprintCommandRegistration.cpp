@@ -5,6 +5,7 @@
 #include "Commands/Blueprint/AddBlueprintVariableCommand.h"
 #include "Commands/Blueprint/SetComponentPropertyCommand.h"
 #include "Commands/Blueprint/CompileBlueprintCommand.h"
+#include "Commands/Blueprint/CompileBlueprintsCommand.h"
 #include "Commands/Blueprint/SetPhysicsPropertiesCommand.h"
 #include "Commands/Blueprint/SetBlueprintPropertyCommand.h"
 #include "Commands/Blueprint/ListBlueprintComponentsCommand.h"
@@ -32,6 +33,7 @@ void FBlueprintCommandRegistration::RegisterAllBlueprintCommands()
     RegisterAddBlueprintVariableCommand();
     RegisterSetComponentPropertyCommand();
     RegisterCompileBlueprintCommand();
+    RegisterCompileBlueprintsCommand();
     RegisterSetPhysicsPropertiesCommand();
     RegisterSetBlueprintPropertyCommand();
     RegisterListBlueprintComponentsCommand();
@@ -91,6 +93,12 @@ void FBlueprintCommandRegistration::RegisterCompileBlueprintCommand()
     RegisterAndTrackCommand(Command);
 }
 
+void FBlueprintCommandRegistration::RegisterCompileBlueprintsCommand()
+{
+    TSharedPtr<FCompileBlueprintsCommand> Command = MakeShared<FCompileBlueprintsCommand>(FBlueprintService::Get());
+    RegisterAndTrackCommand(Command);
+}
+
 void FBlueprintCommandRegistration::RegisterSetPhysicsPropertiesCommand()
 {
     TSharedPtr<FSetPhysicsPropertiesCommand> Command = MakeShared<FSetPhysicsPropertiesCommand>(FBlueprintService::Get());
@@ -0,0 +1,103 @@
+#include "Commands/DataTable/ExportDataTableRowsCommand.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "Engine/DataTable.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FExportDataTableRowsCommand::FExportDataTableRowsCommand(IDataTableService& InDataTableService)
+    : DataTableService(InDataTableService)
+{
+}
+
+FString FExportDataTableRowsCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonParams;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    FJsonSerializer::Deserialize(Reader, JsonParams);
+    
+    TSharedPtr<FJsonObject> ResponseObj = ExecuteJson(JsonParams);
+    
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+TSharedPtr<FJsonObject> FExportDataTableRowsCommand::ExecuteJson(const TSharedPtr<FJsonObject>& Parameters)
+{
+    if (!ValidateParamsJson(Parameters))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing required 'datatable_path' parameter"));
+    }
+    
+    FDataTableExportParams ExportParams;
+    FString FormatName = TEXT("jsonl");
+    Parameters->TryGetStringField(TEXT("format"), FormatName);
+    if (FormatName.Equals(TEXT("csv"), ESearchCase::IgnoreCase))
+    {
+        ExportParams.Format = EDataTableRowFormat::Csv;
+    }
+    else if (!FormatName.Equals(TEXT("jsonl"), ESearchCase::IgnoreCase) && !FormatName.Equals(TEXT("json_lines"), ESearchCase::IgnoreCase))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown format '%s'; expected 'jsonl' or 'csv'"), *FormatName));
+    }
+    Parameters->TryGetNumberField(TEXT("limit"), ExportParams.Limit);
+    Parameters->TryGetStringField(TEXT("cursor"), ExportParams.Cursor);
+    Parameters->TryGetStringField(TEXT("file_path"), ExportParams.FilePath);
+    
+    const FString DataTablePath = Parameters->GetStringField(TEXT("datatable_path"));
+    UDataTable* DataTable = DataTableService.FindDataTable(DataTablePath);
+    if (!DataTable)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath));
+    }
+    
+    FDataTableExportResult ExportResult;
+    FString Error;
+    if (!DataTableService.ExportDataTableRows(DataTable, ExportParams, ExportResult, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("command"), GetCommandName());
+    ResponseObj->SetStringField(TEXT("format"), ExportParams.Format == EDataTableRowFormat::Csv ? TEXT("csv") : TEXT("jsonl"));
+    if (ExportParams.FilePath.IsEmpty())
+    {
+        ResponseObj->SetStringField(TEXT("data"), ExportResult.Data);
+    }
+    else
+    {
+        ResponseObj->SetStringField(TEXT("file_path"), ExportParams.FilePath);
+    }
+    ResponseObj->SetNumberField(TEXT("count"), ExportResult.RowCount);
+    ResponseObj->SetNumberField(TEXT("total_rows"), ExportResult.TotalRows);
+    ResponseObj->SetBoolField(TEXT("has_more"), !ExportResult.NextCursor.IsEmpty());
+    if (!ExportResult.NextCursor.IsEmpty())
+    {
+        ResponseObj->SetStringField(TEXT("next_cursor"), ExportResult.NextCursor);
+    }
+    ResponseObj->SetNumberField(TEXT("duration_ms"), ExportResult.DurationMs);
+    ResponseObj->SetNumberField(TEXT("rows_per_second"), ExportResult.GetRowsPerSecond());
+    return ResponseObj;
+}
+
+FString FExportDataTableRowsCommand::GetCommandName() const
+{
+    return TEXT("export_datatable_rows");
+}
+
+bool FExportDataTableRowsCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonParams;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    return FJsonSerializer::Deserialize(Reader, JsonParams) && ValidateParamsJson(JsonParams);
+}
+
+bool FExportDataTableRowsCommand::ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const
+{
+    return Parameters.IsValid() && Parameters->HasTypedField<EJson::String>(TEXT("datatable_path"));
+}
@@ -0,0 +1,116 @@
+#include "Commands/DataTable/ImportDataTableRowsCommand.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "Engine/DataTable.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    /** @return false if Name is not a known row format */
+    bool ParseRowFormat(const FString& Name, EDataTableRowFormat& OutFormat)
+    {
+        if (Name.Equals(TEXT("jsonl"), ESearchCase::IgnoreCase) || Name.Equals(TEXT("json_lines"), ESearchCase::IgnoreCase))
+        {
+            OutFormat = EDataTableRowFormat::JsonLines;
+            return true;
+        }
+        if (Name.Equals(TEXT("csv"), ESearchCase::IgnoreCase))
+        {
+            OutFormat = EDataTableRowFormat::Csv;
+            return true;
+        }
+        return false;
+    }
+}
+
+FImportDataTableRowsCommand::FImportDataTableRowsCommand(IDataTableService& InDataTableService)
+    : DataTableService(InDataTableService)
+{
+}
+
+FString FImportDataTableRowsCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonParams;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    FJsonSerializer::Deserialize(Reader, JsonParams);
+    
+    TSharedPtr<FJsonObject> ResponseObj = ExecuteJson(JsonParams);
+    
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+TSharedPtr<FJsonObject> FImportDataTableRowsCommand::ExecuteJson(const TSharedPtr<FJsonObject>& Parameters)
+{
+    if (!ValidateParamsJson(Parameters))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide 'datatable_path' and either 'data' (JSON lines or CSV text) or 'file_path'"));
+    }
+    
+    FDataTableImportParams ImportParams;
+    FString FormatName = TEXT("jsonl");
+    Parameters->TryGetStringField(TEXT("format"), FormatName);
+    if (!ParseRowFormat(FormatName, ImportParams.Format))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown format '%s'; expected 'jsonl' or 'csv'"), *FormatName));
+    }
+    Parameters->TryGetStringField(TEXT("data"), ImportParams.Data);
+    Parameters->TryGetStringField(TEXT("file_path"), ImportParams.FilePath);
+    Parameters->TryGetBoolField(TEXT("replace"), ImportParams.bReplace);
+    
+    const FString DataTablePath = Parameters->GetStringField(TEXT("datatable_path"));
+    UDataTable* DataTable = DataTableService.FindDataTable(DataTablePath);
+    if (!DataTable)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath));
+    }
+    
+    FDataTableImportResult ImportResult;
+    FString Error;
+    if (!DataTableService.ImportDataTableRows(DataTable, ImportParams, ImportResult, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    
+    TArray<TSharedPtr<FJsonValue>> ErrorArray;
+    ErrorArray.Reserve(ImportResult.Errors.Num());
+    for (const FString& RowError : ImportResult.Errors)
+    {
+        ErrorArray.Add(MakeShared<FJsonValueString>(RowError));
+    }
+    
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), ImportResult.ErrorCount == 0 && !ImportResult.bCancelled);
+    ResponseObj->SetStringField(TEXT("command"), GetCommandName());
+    ResponseObj->SetNumberField(TEXT("imported"), ImportResult.ImportedCount);
+    ResponseObj->SetNumberField(TEXT("failed"), ImportResult.ErrorCount);
+    ResponseObj->SetArrayField(TEXT("errors"), ErrorArray);
+    ResponseObj->SetBoolField(TEXT("cancelled"), ImportResult.bCancelled);
+    ResponseObj->SetNumberField(TEXT("total_rows"), DataTable->GetRowMap().Num());
+    ResponseObj->SetNumberField(TEXT("duration_ms"), ImportResult.DurationMs);
+    ResponseObj->SetNumberField(TEXT("rows_per_second"), ImportResult.GetRowsPerSecond());
+    return ResponseObj;
+}
+
+FString FImportDataTableRowsCommand::GetCommandName() const
+{
+    return TEXT("import_datatable_rows");
+}
+
+bool FImportDataTableRowsCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonParams;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    return FJsonSerializer::Deserialize(Reader, JsonParams) && ValidateParamsJson(JsonParams);
+}
+
+bool FImportDataTableRowsCommand::ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const
+{
+    return Parameters.IsValid()
+        && Parameters->HasTypedField<EJson::String>(TEXT("datatable_path"))
+        && (Parameters->HasTypedField<EJson::String>(TEXT("data")) || Parameters->HasTypedField<EJson::String>(TEXT("file_path")));
+}
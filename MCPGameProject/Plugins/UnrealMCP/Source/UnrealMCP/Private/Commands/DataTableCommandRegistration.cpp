@@ -11,6 +11,8 @@
 #include "Commands/DataTable/DeleteDataTableRowsCommand.h"
 #include "Commands/DataTable/GetDataTableRowNamesCommand.h"
 #include "Commands/DataTable/GetDataTablePropertyMapCommand.h"
+#include "Commands/DataTable/ImportDataTableRowsCommand.h"
+#include "Commands/DataTable/ExportDataTableRowsCommand.h"
 
 TArray<TSharedPtr<IUnrealMCPCommand>> FDataTableCommandRegistration::RegisteredCommands;
 
@@ -32,6 +34,8 @@ void FDataTableCommandRegistration::RegisterAllCommands()
     RegisterAndTrackCommand(MakeShared<FDeleteDataTableRowsCommand>(DataTableServicePtr)); // NEW ARCHITECTURE
     RegisterAndTrackCommand(MakeShared<FGetDataTableRowNamesCommand>(DataTableServiceRef));
     RegisterAndTrackCommand(MakeShared<FGetDataTablePropertyMapCommand>(DataTableServiceRef));
+    RegisterAndTrackCommand(MakeShared<FImportDataTableRowsCommand>(DataTableServiceRef));
+    RegisterAndTrackCommand(MakeShared<FExportDataTableRowsCommand>(DataTableServiceRef));
     
     UE_LOG(LogTemp, Log, TEXT("Registered %d DataTable commands"), RegisteredCommands.Num());
 }
@@ -0,0 +1,73 @@
+#include "Commands/Editor/FlushCommand.h"
+#include "Services/AssetDirtySet.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    TArray<TSharedPtr<FJsonValue>> PathsToJsonArray(const TArray<FString>& Paths)
+    {
+        TArray<TSharedPtr<FJsonValue>> Array;
+        Array.Reserve(Paths.Num());
+        for (const FString& Path : Paths)
+        {
+            Array.Add(MakeShared<FJsonValueString>(Path));
+        }
+        return Array;
+    }
+}
+
+FString FFlushCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonParams;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    FJsonSerializer::Deserialize(Reader, JsonParams);
+    
+    TSharedPtr<FJsonObject> ResponseObj = ExecuteJson(JsonParams);
+    
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+TSharedPtr<FJsonObject> FFlushCommand::ExecuteJson(const TSharedPtr<FJsonObject>& Parameters)
+{
+    FAssetDirtySet& DirtySet = FAssetDirtySet::Get();
+    
+    // Flush before switching, so turning immediate mode on doesn't report an empty result
+    const FAssetFlushResult Result = DirtySet.Flush();
+    
+    bool bImmediateMode = false;
+    if (Parameters.IsValid() && Parameters->TryGetBoolField(TEXT("immediate_mode"), bImmediateMode))
+    {
+        DirtySet.SetImmediateMode(bImmediateMode);
+    }
+    
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), Result.FailedSaves.Num() == 0);
+    ResponseObj->SetArrayField(TEXT("compiled"), PathsToJsonArray(Result.Compiled));
+    ResponseObj->SetArrayField(TEXT("saved"), PathsToJsonArray(Result.Saved));
+    ResponseObj->SetArrayField(TEXT("failed_saves"), PathsToJsonArray(Result.FailedSaves));
+    ResponseObj->SetNumberField(TEXT("skipped"), Result.SkippedCount);
+    ResponseObj->SetNumberField(TEXT("duration_ms"), Result.DurationMs);
+    ResponseObj->SetBoolField(TEXT("immediate_mode"), DirtySet.IsImmediateMode());
+    if (Result.FailedSaves.Num() > 0)
+    {
+        ResponseObj->SetStringField(TEXT("error"), FString::Printf(TEXT("%d asset(s) failed to save"), Result.FailedSaves.Num()));
+    }
+    return ResponseObj;
+}
+
+bool FFlushCommand::ValidateParams(const FString& Parameters) const
+{
+    // All parameters are optional
+    return true;
+}
+
+bool FFlushCommand::ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const
+{
+    return true;
+}
@@ -1,9 +1,69 @@
 #include "Commands/Editor/GetActorsInLevelCommand.h"
 #include "Utils/UnrealMCPCommonUtils.h"
 #include "Dom/JsonObject.h"
+#include "Algo/Find.h"
+#include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 
+namespace
+{
+    /** Fields that can be requested through the fields parameter */
+    enum EActorField : uint32
+    {
+        Field_Name      = 1 << 0,
+        Field_Label     = 1 << 1,
+        Field_Class     = 1 << 2,
+        Field_Location  = 1 << 3,
+        Field_Rotation  = 1 << 4,
+        Field_Scale     = 1 << 5,
+        Field_Folder    = 1 << 6,
+        Field_Tags      = 1 << 7,
+    
+        /** What get_actors_in_level reported before fields could be selected */
+        Field_Default   = Field_Name | Field_Class | Field_Location | Field_Rotation | Field_Scale
+    };
+
+    struct FActorFieldName
+    {
+        const TCHAR* Name;
+        EActorField Field;
+    };
+
+    const FActorFieldName ActorFieldNames[] =
+    {
+        { TEXT("name"), Field_Name },
+        { TEXT("label"), Field_Label },
+        { TEXT("class"), Field_Class },
+        { TEXT("location"), Field_Location },
+        { TEXT("rotation"), Field_Rotation },
+        { TEXT("scale"), Field_Scale },
+        { TEXT("folder"), Field_Folder },
+        { TEXT("tags"), Field_Tags }
+    };
+
+    TArray<TSharedPtr<FJsonValue>> VectorToJsonArray(double X, double Y, double Z)
+    {
+        TArray<TSharedPtr<FJsonValue>> Array;
+        Array.Reserve(3);
+        Array.Add(MakeShared<FJsonValueNumber>(X));
+        Array.Add(MakeShared<FJsonValueNumber>(Y));
+        Array.Add(MakeShared<FJsonValueNumber>(Z));
+        return Array;
+    }
+
+    bool ParseVectorField(const TSharedPtr<FJsonObject>& Parameters, const TCHAR* FieldName, FVector& OutVector, FString& OutError)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+        if (!Parameters->TryGetArrayField(FieldName, Array) || !FUnrealMCPCommonUtils::ParseVector(*Array, OutVector))
+        {
+            OutError = FString::Printf(TEXT("%s must be an array of 3 numbers"), FieldName);
+            return false;
+        }
+        return true;
+    }
+}
+
 FGetActorsInLevelCommand::FGetActorsInLevelCommand(IEditorService& InEditorService)
     : EditorService(InEditorService)
 {
@@ -11,9 +71,37 @@ FGetActorsInLevelCommand::FGetActorsInLevelCommand(IEditorService& InEditorServi
 
 FString FGetActorsInLevelCommand::Execute(const FString& Parameters)
 {
-    // This command doesn't need parameters, just get all actors
-    TArray<AActor*> Actors = EditorService.GetActorsInLevel();
-    return CreateSuccessResponse(Actors);
+    TSharedPtr<FJsonObject> JsonParams;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    FJsonSerializer::Deserialize(Reader, JsonParams);
+    
+    TSharedPtr<FJsonObject> ResponseObj = ExecuteJson(JsonParams);
+    
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    
+    return OutputString;
+}
+
+TSharedPtr<FJsonObject> FGetActorsInLevelCommand::ExecuteJson(const TSharedPtr<FJsonObject>& Parameters)
+{
+    FActorQueryParams QueryParams;
+    uint32 Fields = Field_Default;
+    FString Error;
+    if (!ParseParameters(Parameters, QueryParams, Fields, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    
+    // Only the requested page is collected and serialized
+    FActorQueryResult Result;
+    if (!EditorService.QueryActorsInLevel(QueryParams, Result, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    
+    return CreateSuccessResponse(Result, Fields);
 }
 
 FString FGetActorsInLevelCommand::GetCommandName() const
@@ -23,42 +111,147 @@ FString FGetActorsInLevelCommand::GetCommandName() const
 
 bool FGetActorsInLevelCommand::ValidateParams(const FString& Parameters) const
 {
-    // This command doesn't require any parameters
+    // All parameters are optional; malformed ones are reported by Execute
     return true;
 }
 
-FString FGetActorsInLevelCommand::CreateSuccessResponse(const TArray<AActor*>& Actors) const
+bool FGetActorsInLevelCommand::ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const
 {
-    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
-    TArray<TSharedPtr<FJsonValue>> ActorArray;
+    return true;
+}
+
+bool FGetActorsInLevelCommand::ParseParameters(const TSharedPtr<FJsonObject>& Parameters, FActorQueryParams& OutParams, uint32& OutFields, FString& OutError) const
+{
+    OutFields = Field_Default;
+    if (!Parameters.IsValid())
+    {
+        return true;
+    }
+    
+    double Limit = 0.0;
+    if (Parameters->TryGetNumberField(TEXT("limit"), Limit))
+    {
+        OutParams.Limit = static_cast<int32>(Limit);
+    }
+    
+    Parameters->TryGetStringField(TEXT("cursor"), OutParams.Cursor);
+    Parameters->TryGetStringField(TEXT("class"), OutParams.ClassName);
+    Parameters->TryGetStringField(TEXT("tag"), OutParams.Tag);
+    Parameters->TryGetStringField(TEXT("name_pattern"), OutParams.NamePattern);
     
-    for (AActor* Actor : Actors)
+    if (Parameters->TryGetStringField(TEXT("folder"), OutParams.FolderPath))
     {
-        if (Actor)
+        OutParams.FolderPath.RemoveFromStart(TEXT("/"));
+        OutParams.FolderPath.RemoveFromEnd(TEXT("/"));
+    }
+    
+    const bool bHasMin = Parameters->HasField(TEXT("bounds_min"));
+    const bool bHasMax = Parameters->HasField(TEXT("bounds_max"));
+    if (bHasMin != bHasMax)
+    {
+        OutError = TEXT("bounds_min and bounds_max must be given together");
+        return false;
+    }
+    if (bHasMin)
+    {
+        FVector Min;
+        FVector Max;
+        if (!ParseVectorField(Parameters, TEXT("bounds_min"), Min, OutError) ||
+            !ParseVectorField(Parameters, TEXT("bounds_max"), Max, OutError))
         {
-            ActorArray.Add(FUnrealMCPCommonUtils::ActorToJson(Actor));
+            return false;
         }
+        OutParams.Bounds = FBox(Min, Max);
+        OutParams.bHasBounds = true;
     }
     
-    ResponseObj->SetArrayField(TEXT("actors"), ActorArray);
-    
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    const TArray<TSharedPtr<FJsonValue>>* FieldValues = nullptr;
+    if (Parameters->TryGetArrayField(TEXT("fields"), FieldValues))
+    {
+        OutFields = 0;
+        for (const TSharedPtr<FJsonValue>& FieldValue : *FieldValues)
+        {
+            const FString FieldName = FieldValue.IsValid() ? FieldValue->AsString() : FString();
+            const FActorFieldName* Known = Algo::FindByPredicate(ActorFieldNames, [&FieldName](const FActorFieldName& Candidate)
+            {
+                return FieldName == Candidate.Name;
+            });
+            if (!Known)
+            {
+                OutError = FString::Printf(TEXT("Unknown field '%s'; valid fields are name, label, class, location, rotation, scale, folder and tags"), *FieldName);
+                return false;
+            }
+            OutFields |= Known->Field;
+        }
+        if (OutFields == 0)
+        {
+            OutFields = Field_Default;
+        }
+    }
     
-    return OutputString;
+    return OutParams.IsValid(OutError);
 }
 
-FString FGetActorsInLevelCommand::CreateErrorResponse(const FString& ErrorMessage) const
+TSharedPtr<FJsonObject> FGetActorsInLevelCommand::CreateSuccessResponse(const FActorQueryResult& Result, uint32 Fields) const
 {
-    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
-    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
-    ErrorObj->SetBoolField(TEXT("success"), false);
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    TArray<TSharedPtr<FJsonValue>> ActorArray;
+    ActorArray.Reserve(Result.Actors.Num());
     
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    for (AActor* Actor : Result.Actors)
+    {
+        TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
+        if (Fields & Field_Name)
+        {
+            ActorObject->SetStringField(TEXT("name"), Actor->GetName());
+        }
+        if (Fields & Field_Label)
+        {
+            ActorObject->SetStringField(TEXT("label"), Actor->GetActorLabel());
+        }
+        if (Fields & Field_Class)
+        {
+            ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+        }
+        if (Fields & Field_Location)
+        {
+            const FVector Location = Actor->GetActorLocation();
+            ActorObject->SetArrayField(TEXT("location"), VectorToJsonArray(Location.X, Location.Y, Location.Z));
+        }
+        if (Fields & Field_Rotation)
+        {
+            const FRotator Rotation = Actor->GetActorRotation();
+            ActorObject->SetArrayField(TEXT("rotation"), VectorToJsonArray(Rotation.Pitch, Rotation.Yaw, Rotation.Roll));
+        }
+        if (Fields & Field_Scale)
+        {
+            const FVector Scale = Actor->GetActorScale3D();
+            ActorObject->SetArrayField(TEXT("scale"), VectorToJsonArray(Scale.X, Scale.Y, Scale.Z));
+        }
+        if (Fields & Field_Folder)
+        {
+            ActorObject->SetStringField(TEXT("folder"), Actor->GetFolderPath().ToString());
+        }
+        if (Fields & Field_Tags)
+        {
+            TArray<TSharedPtr<FJsonValue>> TagArray;
+            TagArray.Reserve(Actor->Tags.Num());
+            for (const FName& Tag : Actor->Tags)
+            {
+                TagArray.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+            }
+            ActorObject->SetArrayField(TEXT("tags"), TagArray);
+        }
+        ActorArray.Add(MakeShared<FJsonValueObject>(ActorObject));
+    }
     
-    return OutputString;
+    ResponseObj->SetArrayField(TEXT("actors"), ActorArray);
+    ResponseObj->SetNumberField(TEXT("count"), Result.Actors.Num());
+    ResponseObj->SetBoolField(TEXT("has_more"), !Result.NextCursor.IsEmpty());
+    if (!Result.NextCursor.IsEmpty())
+    {
+        ResponseObj->SetStringField(TEXT("next_cursor"), Result.NextCursor);
+    }
+    
+    return ResponseObj;
 }
-
@@ -0,0 +1,165 @@
+#include "Commands/Editor/GetCacheStatsCommand.h"
+#include "UnrealMCPBridge.h"
+#include "MCPGameThreadDispatcher.h"
+#include "Editor.h"
+#include "Services/ObjectResolutionCache.h"
+#include "Services/BlueprintActionResultCache.h"
+#include "Services/AssetNameIndex.h"
+#include "Services/LevelActorIndex.h"
+#include "Services/AssetDirtySet.h"
+#include "Services/BlueprintCompileCache.h"
+#include "Services/StructSchemaCache.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    TSharedPtr<FJsonObject> KindStatsToJson(const FObjectResolutionKindStats& Stats)
+    {
+        TSharedPtr<FJsonObject> StatsObj = MakeShared<FJsonObject>();
+        StatsObj->SetNumberField(TEXT("total_requests"), Stats.TotalRequests);
+        StatsObj->SetNumberField(TEXT("cache_hits"), Stats.CacheHits);
+        StatsObj->SetNumberField(TEXT("cache_misses"), Stats.CacheMisses);
+        StatsObj->SetNumberField(TEXT("cached_count"), Stats.CachedCount);
+        StatsObj->SetNumberField(TEXT("invalidated_count"), Stats.InvalidatedCount);
+        StatsObj->SetNumberField(TEXT("hit_ratio"), Stats.GetHitRatio());
+        return StatsObj;
+    }
+}
+
+FString FGetCacheStatsCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonParams;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    FJsonSerializer::Deserialize(Reader, JsonParams);
+    
+    TSharedPtr<FJsonObject> ResponseObj = ExecuteJson(JsonParams);
+    
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+TSharedPtr<FJsonObject> FGetCacheStatsCommand::ExecuteJson(const TSharedPtr<FJsonObject>& Parameters)
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    
+    // Object resolution cache, per kind
+    FObjectResolutionCache& ResolutionCache = FObjectResolutionCache::Get();
+    const FObjectResolutionCacheStats ResolutionStats = ResolutionCache.GetStats();
+    TSharedPtr<FJsonObject> ResolutionObj = KindStatsToJson(ResolutionStats.GetTotals());
+    ResolutionObj->SetNumberField(TEXT("generation"), static_cast<double>(ResolutionStats.Generation));
+    TSharedPtr<FJsonObject> KindsObj = MakeShared<FJsonObject>();
+    for (int32 KindIndex = 0; KindIndex < static_cast<int32>(EResolvedObjectKind::Count); ++KindIndex)
+    {
+        KindsObj->SetObjectField(FObjectResolutionCache::GetKindName(static_cast<EResolvedObjectKind>(KindIndex)), KindStatsToJson(ResolutionStats.Kinds[KindIndex]));
+    }
+    ResolutionObj->SetObjectField(TEXT("kinds"), KindsObj);
+    ResponseObj->SetObjectField(TEXT("resolution_cache"), ResolutionObj);
+    
+    // Memoized blueprint action queries
+    FBlueprintActionResultCache& ActionResultCache = FBlueprintActionResultCache::Get();
+    const FBlueprintActionResultCacheStats ActionStats = ActionResultCache.GetCacheStats();
+    TSharedPtr<FJsonObject> ActionObj = MakeShared<FJsonObject>();
+    ActionObj->SetNumberField(TEXT("total_requests"), ActionStats.TotalRequests);
+    ActionObj->SetNumberField(TEXT("cache_hits"), ActionStats.CacheHits);
+    ActionObj->SetNumberField(TEXT("cache_misses"), ActionStats.CacheMisses);
+    ActionObj->SetNumberField(TEXT("cached_count"), ActionStats.CachedCount);
+    ActionObj->SetNumberField(TEXT("invalidated_count"), ActionStats.InvalidatedCount);
+    ActionObj->SetNumberField(TEXT("flush_count"), ActionStats.FlushCount);
+    ActionObj->SetNumberField(TEXT("hit_ratio"), ActionStats.GetHitRatio());
+    ResponseObj->SetObjectField(TEXT("action_result_cache"), ActionObj);
+    
+    // Asset name index
+    const FAssetNameIndexStats IndexStats = FAssetNameIndex::Get().GetStats();
+    TSharedPtr<FJsonObject> IndexObj = MakeShared<FJsonObject>();
+    IndexObj->SetNumberField(TEXT("indexed_assets"), IndexStats.IndexedAssets);
+    IndexObj->SetNumberField(TEXT("distinct_names"), IndexStats.DistinctNames);
+    IndexObj->SetNumberField(TEXT("lookups"), IndexStats.Lookups);
+    IndexObj->SetNumberField(TEXT("hits"), IndexStats.Hits);
+    IndexObj->SetNumberField(TEXT("assets_added"), IndexStats.AssetsAdded);
+    IndexObj->SetNumberField(TEXT("assets_removed"), IndexStats.AssetsRemoved);
+    IndexObj->SetNumberField(TEXT("assets_renamed"), IndexStats.AssetsRenamed);
+    IndexObj->SetNumberField(TEXT("initial_build_ms"), IndexStats.InitialBuildMs);
+    ResponseObj->SetObjectField(TEXT("asset_name_index"), IndexObj);
+    
+    // Level actor index
+    const FLevelActorIndexStats ActorStats = FLevelActorIndex::Get().GetStats();
+    TSharedPtr<FJsonObject> ActorIndexObj = MakeShared<FJsonObject>();
+    ActorIndexObj->SetNumberField(TEXT("indexed_worlds"), ActorStats.IndexedWorlds);
+    ActorIndexObj->SetNumberField(TEXT("indexed_actors"), ActorStats.IndexedActors);
+    ActorIndexObj->SetNumberField(TEXT("lookups"), ActorStats.Lookups);
+    ActorIndexObj->SetNumberField(TEXT("hits"), ActorStats.Hits);
+    ActorIndexObj->SetNumberField(TEXT("builds"), ActorStats.Builds);
+    ActorIndexObj->SetNumberField(TEXT("last_build_ms"), ActorStats.LastBuildMs);
+    ResponseObj->SetObjectField(TEXT("actor_index"), ActorIndexObj);
+    
+    // Deferred compiles and saves
+    const FAssetDirtySetStats DirtyStats = FAssetDirtySet::Get().GetStats();
+    TSharedPtr<FJsonObject> DirtySetObj = MakeShared<FJsonObject>();
+    DirtySetObj->SetBoolField(TEXT("immediate_mode"), FAssetDirtySet::Get().IsImmediateMode());
+    DirtySetObj->SetNumberField(TEXT("pending"), DirtyStats.PendingCount);
+    DirtySetObj->SetNumberField(TEXT("marks"), DirtyStats.MarkCount);
+    DirtySetObj->SetNumberField(TEXT("coalesced"), DirtyStats.CoalescedCount);
+    DirtySetObj->SetNumberField(TEXT("flushes"), DirtyStats.FlushCount);
+    DirtySetObj->SetNumberField(TEXT("compiles"), DirtyStats.CompileCount);
+    DirtySetObj->SetNumberField(TEXT("saves"), DirtyStats.SaveCount);
+    DirtySetObj->SetNumberField(TEXT("last_flush_ms"), DirtyStats.LastFlushMs);
+    ResponseObj->SetObjectField(TEXT("dirty_set"), DirtySetObj);
+    
+    // Compiles skipped because the blueprint was unchanged
+    const FBlueprintCompileCacheStats CompileStats = FBlueprintCompileCache::Get().GetStats();
+    TSharedPtr<FJsonObject> CompileCacheObj = MakeShared<FJsonObject>();
+    CompileCacheObj->SetNumberField(TEXT("tracked_blueprints"), CompileStats.TrackedBlueprints);
+    CompileCacheObj->SetNumberField(TEXT("lookups"), CompileStats.Lookups);
+    CompileCacheObj->SetNumberField(TEXT("skips"), CompileStats.Skips);
+    CompileCacheObj->SetNumberField(TEXT("skip_ratio"), CompileStats.GetSkipRatio());
+    CompileCacheObj->SetNumberField(TEXT("invalidations"), CompileStats.Invalidations);
+    CompileCacheObj->SetNumberField(TEXT("saved_ms"), CompileStats.SavedMs);
+    ResponseObj->SetObjectField(TEXT("compile_cache"), CompileCacheObj);
+    
+    // Struct reflection shared by the DataTable and struct commands
+    const FStructSchemaCacheStats SchemaStats = FStructSchemaCache::Get().GetStats();
+    TSharedPtr<FJsonObject> SchemaCacheObj = MakeShared<FJsonObject>();
+    SchemaCacheObj->SetNumberField(TEXT("cached_structs"), SchemaStats.CachedStructs);
+    SchemaCacheObj->SetNumberField(TEXT("lookups"), SchemaStats.Lookups);
+    SchemaCacheObj->SetNumberField(TEXT("builds"), SchemaStats.Builds);
+    SchemaCacheObj->SetNumberField(TEXT("hit_ratio"), SchemaStats.GetHitRatio());
+    SchemaCacheObj->SetNumberField(TEXT("invalidations"), SchemaStats.Invalidations);
+    ResponseObj->SetObjectField(TEXT("struct_schema_cache"), SchemaCacheObj);
+    
+    // Command scheduling: the game-thread queue and the worker lane running this command
+    if (UUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UUnrealMCPBridge>() : nullptr)
+    {
+        ResponseObj->SetObjectField(TEXT("game_thread_dispatcher"), Bridge->GetGameThreadDispatcherStats().ToJson());
+        TSharedPtr<FJsonObject> WorkerLaneObj = MakeShared<FJsonObject>();
+        WorkerLaneObj->SetNumberField(TEXT("in_flight"), Bridge->GetWorkerLaneInFlight());
+        ResponseObj->SetObjectField(TEXT("worker_lane"), WorkerLaneObj);
+    }
+    
+    bool bReset = false;
+    if (Parameters.IsValid() && Parameters->TryGetBoolField(TEXT("reset"), bReset) && bReset)
+    {
+        ResolutionCache.ResetStats();
+        ActionResultCache.ResetCacheStats();
+        FBlueprintCompileCache::Get().ResetStats();
+        FStructSchemaCache::Get().ResetStats();
+    }
+    
+    return ResponseObj;
+}
+
+bool FGetCacheStatsCommand::ValidateParams(const FString& Parameters) const
+{
+    // All parameters are optional
+    return true;
+}
+
+bool FGetCacheStatsCommand::ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const
+{
+    return true;
+}
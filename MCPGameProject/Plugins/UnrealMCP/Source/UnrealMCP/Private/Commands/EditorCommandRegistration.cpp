@@ -12,6 +12,8 @@
 #include "Commands/Editor/GetActorPropertiesCommand.h"
 #include "Commands/Editor/SetActorPropertyCommand.h"
 #include "Commands/Editor/SetLightPropertyCommand.h"
+#include "Commands/Editor/GetCacheStatsCommand.h"
+#include "Commands/Editor/FlushCommand.h"
 
 TArray<TSharedPtr<IUnrealMCPCommand>> FEditorCommandRegistration::RegisteredCommands;
 
@@ -33,6 +35,12 @@ void FEditorCommandRegistration::RegisterAllCommands()
     RegisterAndTrackCommand(MakeShared<FSetActorPropertyCommand>(EditorService));
     RegisterAndTrackCommand(MakeShared<FSetLightPropertyCommand>(EditorService));
     
+    // Register diagnostics commands
+    RegisterAndTrackCommand(MakeShared<FGetCacheStatsCommand>());
+    
+    // Register the deferred compile and save flush
+    RegisterAndTrackCommand(MakeShared<FFlushCommand>());
+    
     // Note: Additional editor commands are handled by legacy command system
     // and will be migrated to the new architecture in future iterations:
     // - SetActorTransformCommand, GetActorPropertiesCommand, etc.
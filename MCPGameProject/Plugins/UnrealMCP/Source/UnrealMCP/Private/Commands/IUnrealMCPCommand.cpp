@@ -0,0 +1,35 @@
+#include "Commands/IUnrealMCPCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    FString SerializeParameters(const TSharedPtr<FJsonObject>& Parameters)
+    {
+        FString ParamsString;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ParamsString);
+        FJsonSerializer::Serialize(Parameters.IsValid() ? Parameters.ToSharedRef() : MakeShared<FJsonObject>(), Writer);
+        return ParamsString;
+    }
+}
+
+TSharedPtr<FJsonObject> IUnrealMCPCommand::ExecuteJson(const TSharedPtr<FJsonObject>& Parameters)
+{
+    // Adapter for commands that only implement the string API
+    FString Result = Execute(SerializeParameters(Parameters));
+
+    TSharedPtr<FJsonObject> ResultObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result);
+    if (!FJsonSerializer::Deserialize(Reader, ResultObject))
+    {
+        return nullptr;
+    }
+    return ResultObject;
+}
+
+bool IUnrealMCPCommand::ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const
+{
+    return ValidateParams(SerializeParameters(Parameters));
+}
@@ -1,6 +1,7 @@
 #include "Commands/UnrealMCPCommandRegistry.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
 #include "Serialization/JsonWriter.h"
 
 FUnrealMCPCommandRegistry& FUnrealMCPCommandRegistry::Get()
@@ -9,6 +10,68 @@ FUnrealMCPCommandRegistry& FUnrealMCPCommandRegistry::Get()
     return Instance;
 }
 
+FUnrealMCPCommandRegistry::FUnrealMCPCommandRegistry()
+    : CurrentSnapshot(nullptr)
+    , BatchDepth(0)
+{
+    FScopeLock Lock(&RegistryLock);
+    PublishSnapshot(MakeUnique<FCommandSnapshot>());
+}
+
+void FUnrealMCPCommandRegistry::PublishSnapshot(TUniquePtr<FCommandSnapshot> NewSnapshot)
+{
+    CurrentSnapshot.store(NewSnapshot.Get(), std::memory_order_release);
+    Snapshots.Add(MoveTemp(NewSnapshot));
+}
+
+FUnrealMCPCommandRegistry::FCommandSnapshot& FUnrealMCPCommandRegistry::BeginWrite()
+{
+    if (!PendingSnapshot.IsValid())
+    {
+        PendingSnapshot = MakeUnique<FCommandSnapshot>(GetSnapshot());
+    }
+    return *PendingSnapshot;
+}
+
+void FUnrealMCPCommandRegistry::CommitWrite()
+{
+    if (BatchDepth == 0 && PendingSnapshot.IsValid())
+    {
+        PublishSnapshot(MoveTemp(PendingSnapshot));
+    }
+}
+
+void FUnrealMCPCommandRegistry::BeginBatch()
+{
+    FScopeLock Lock(&RegistryLock);
+    ++BatchDepth;
+}
+
+void FUnrealMCPCommandRegistry::EndBatch()
+{
+    FScopeLock Lock(&RegistryLock);
+    if (!ensure(BatchDepth > 0))
+    {
+        return;
+    }
+    
+    --BatchDepth;
+    CommitWrite();
+}
+
+TSharedPtr<IUnrealMCPCommand> FUnrealMCPCommandRegistry::FindCommand(const FString& CommandName) const
+{
+    // FNAME_Find keeps unknown names out of the name table
+    const FName CommandKey(*CommandName, FNAME_Find);
+    if (CommandKey.IsNone())
+    {
+        return nullptr;
+    }
+    
+    const TSharedPtr<IUnrealMCPCommand>* CommandPtr = GetSnapshot().Commands.Find(CommandKey);
+    return CommandPtr ? *CommandPtr : nullptr;
+}
+
 bool FUnrealMCPCommandRegistry::RegisterCommand(TSharedPtr<IUnrealMCPCommand> Command)
 {
     if (!Command.IsValid())
@@ -26,13 +89,17 @@ bool FUnrealMCPCommandRegistry::RegisterCommand(TSharedPtr<IUnrealMCPCommand> Co
     
     FScopeLock Lock(&RegistryLock);
     
+    FCommandSnapshot& NewSnapshot = BeginWrite();
+    const FName CommandKey(*CommandName);
+    
     // Check if command is already registered
-    if (RegisteredCommands.Contains(CommandName))
+    if (NewSnapshot.Commands.Contains(CommandKey))
     {
         UE_LOG(LogTemp, Warning, TEXT("FUnrealMCPCommandRegistry::RegisterCommand: Command '%s' is already registered, replacing"), *CommandName);
     }
     
-    RegisteredCommands.Add(CommandName, Command);
+    NewSnapshot.Commands.Add(CommandKey, Command);
+    CommitWrite();
     UE_LOG(LogTemp, Log, TEXT("FUnrealMCPCommandRegistry::RegisterCommand: Successfully registered command '%s'"), *CommandName);
     
     return true;
@@ -48,9 +115,12 @@ bool FUnrealMCPCommandRegistry::UnregisterCommand(const FString& CommandName)
     
     FScopeLock Lock(&RegistryLock);
     
-    int32 RemovedCount = RegisteredCommands.Remove(CommandName);
-    if (RemovedCount > 0)
+    const FName CommandKey(*CommandName, FNAME_Find);
+    if (!CommandKey.IsNone() && GetLatestSnapshot().Commands.Contains(CommandKey))
     {
+        BeginWrite().Commands.Remove(CommandKey);
+        CommitWrite();
+        
         UE_LOG(LogTemp, Log, TEXT("FUnrealMCPCommandRegistry::UnregisterCommand: Successfully unregistered command '%s'"), *CommandName);
         return true;
     }
@@ -68,15 +138,10 @@ FString FUnrealMCPCommandRegistry::ExecuteCommand(const FString& CommandName, co
         return CreateErrorResponse(TEXT("Empty command name"));
     }
     
-    TSharedPtr<IUnrealMCPCommand> Command;
+    TSharedPtr<IUnrealMCPCommand> Command = FindCommand(CommandName);
+    if (!Command.IsValid())
     {
-        FScopeLock Lock(&RegistryLock);
-        TSharedPtr<IUnrealMCPCommand>* CommandPtr = RegisteredCommands.Find(CommandName);
-        if (!CommandPtr || !CommandPtr->IsValid())
-        {
-            return CreateErrorResponse(FString::Printf(TEXT("Command '%s' not found"), *CommandName));
-        }
-        Command = *CommandPtr;
+        return CreateErrorResponse(FString::Printf(TEXT("Command '%s' not found"), *CommandName));
     }
     
     // Validate parameters before execution
@@ -106,18 +171,102 @@ FString FUnrealMCPCommandRegistry::ExecuteCommand(const FString& CommandName, co
     }
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPCommandRegistry::ExecuteCommandJson(const FString& CommandName, const TSharedPtr<FJsonObject>& Parameters)
+{
+    if (CommandName.IsEmpty())
+    {
+        return CreateErrorObject(TEXT("Empty command name"));
+    }
+    
+    TSharedPtr<IUnrealMCPCommand> Command = FindCommand(CommandName);
+    if (!Command.IsValid())
+    {
+        return CreateErrorObject(FString::Printf(TEXT("Command '%s' not found"), *CommandName));
+    }
+    
+    return ExecuteCommandJson(Command, Parameters);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommandRegistry::ExecuteCommandJson(const TSharedPtr<IUnrealMCPCommand>& Command, const TSharedPtr<FJsonObject>& Parameters)
+{
+    if (!Command.IsValid())
+    {
+        return CreateErrorObject(TEXT("Invalid command"));
+    }
+    
+    const FString CommandName = Command->GetCommandName();
+    
+    try
+    {
+        TSharedPtr<FJsonObject> Result;
+        if (Command->SupportsJsonExecution())
+        {
+            if (!Command->ValidateParamsJson(Parameters))
+            {
+                return CreateErrorObject(FString::Printf(TEXT("Invalid parameters for command '%s'"), *CommandName));
+            }
+            Result = Command->ExecuteJson(Parameters);
+        }
+        else
+        {
+            // String-only command: serialize once for both validation and execution
+            FString ParamsString;
+            TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ParamsString);
+            FJsonSerializer::Serialize(Parameters.IsValid() ? Parameters.ToSharedRef() : MakeShared<FJsonObject>(), Writer);
+            
+            if (!Command->ValidateParams(ParamsString))
+            {
+                return CreateErrorObject(FString::Printf(TEXT("Invalid parameters for command '%s'"), *CommandName));
+            }
+            
+            FString ResultString = Command->Execute(ParamsString);
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResultString);
+            FJsonSerializer::Deserialize(Reader, Result);
+        }
+        
+        if (!Result.IsValid())
+        {
+            return CreateErrorObject(TEXT("Failed to parse command result"));
+        }
+        
+        UE_LOG(LogTemp, Verbose, TEXT("FUnrealMCPCommandRegistry::ExecuteCommandJson: Successfully executed command '%s'"), *CommandName);
+        return Result;
+    }
+    catch (const std::exception& e)
+    {
+        FString ErrorMessage = FString::Printf(TEXT("Exception during command execution: %s"), ANSI_TO_TCHAR(e.what()));
+        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry::ExecuteCommandJson: %s"), *ErrorMessage);
+        return CreateErrorObject(ErrorMessage);
+    }
+    catch (...)
+    {
+        FString ErrorMessage = TEXT("Unknown exception during command execution");
+        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry::ExecuteCommandJson: %s"), *ErrorMessage);
+        return CreateErrorObject(ErrorMessage);
+    }
+}
+
 bool FUnrealMCPCommandRegistry::IsCommandRegistered(const FString& CommandName) const
 {
-    FScopeLock Lock(&RegistryLock);
-    return RegisteredCommands.Contains(CommandName);
+    return FindCommand(CommandName).IsValid();
+}
+
+EMCPCommandThreadAffinity FUnrealMCPCommandRegistry::GetCommandThreadAffinity(const FString& CommandName) const
+{
+    TSharedPtr<IUnrealMCPCommand> Command = FindCommand(CommandName);
+    return Command.IsValid() ? Command->GetThreadAffinity() : EMCPCommandThreadAffinity::GameThread;
 }
 
 TArray<FString> FUnrealMCPCommandRegistry::GetRegisteredCommandNames() const
 {
-    FScopeLock Lock(&RegistryLock);
+    const FCommandSnapshot& Snapshot = GetSnapshot();
     
     TArray<FString> CommandNames;
-    RegisteredCommands.GetKeys(CommandNames);
+    CommandNames.Reserve(Snapshot.Commands.Num());
+    for (const TPair<FName, TSharedPtr<IUnrealMCPCommand>>& Entry : Snapshot.Commands)
+    {
+        CommandNames.Add(Entry.Key.ToString());
+    }
     
     // Sort alphabetically for consistent output
     CommandNames.Sort();
@@ -132,10 +281,7 @@ FString FUnrealMCPCommandRegistry::GetCommandHelp(const FString& CommandName) co
         return CreateErrorResponse(TEXT("Empty command name"));
     }
     
-    FScopeLock Lock(&RegistryLock);
-    
-    const TSharedPtr<IUnrealMCPCommand>* CommandPtr = RegisteredCommands.Find(CommandName);
-    if (!CommandPtr || !CommandPtr->IsValid())
+    if (!FindCommand(CommandName).IsValid())
     {
         return CreateErrorResponse(FString::Printf(TEXT("Command '%s' not found"), *CommandName));
     }
@@ -163,19 +309,15 @@ FString FUnrealMCPCommandRegistry::GetCommandHelp(const FString& CommandName) co
 
 FString FUnrealMCPCommandRegistry::GetAllCommandsHelp() const
 {
-    FScopeLock Lock(&RegistryLock);
+    TArray<FString> CommandNames = GetRegisteredCommandNames();
     
     TSharedPtr<FJsonObject> HelpObj = MakeShared<FJsonObject>();
     HelpObj->SetBoolField(TEXT("success"), true);
-    HelpObj->SetNumberField(TEXT("command_count"), RegisteredCommands.Num());
+    HelpObj->SetNumberField(TEXT("command_count"), CommandNames.Num());
     
     // Create array of command information
     TArray<TSharedPtr<FJsonValue>> CommandsArray;
     
-    TArray<FString> CommandNames;
-    RegisteredCommands.GetKeys(CommandNames);
-    CommandNames.Sort();
-    
     for (const FString& CommandName : CommandNames)
     {
         TSharedPtr<FJsonObject> CommandInfo = MakeShared<FJsonObject>();
@@ -200,8 +342,9 @@ void FUnrealMCPCommandRegistry::ClearRegistry()
 {
     FScopeLock Lock(&RegistryLock);
     
-    int32 ClearedCount = RegisteredCommands.Num();
-    RegisteredCommands.Empty();
+    int32 ClearedCount = GetLatestSnapshot().Commands.Num();
+    BeginWrite().Commands.Empty();
+    CommitWrite();
     
     UE_LOG(LogTemp, Log, TEXT("FUnrealMCPCommandRegistry::ClearRegistry: Cleared %d registered commands"), ClearedCount);
 }
@@ -219,6 +362,14 @@ FString FUnrealMCPCommandRegistry::CreateErrorResponse(const FString& ErrorMessa
     return OutputString;
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPCommandRegistry::CreateErrorObject(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+    return ResponseObj;
+}
+
 FString FUnrealMCPCommandRegistry::CreateSuccessResponse(const FString& Message) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
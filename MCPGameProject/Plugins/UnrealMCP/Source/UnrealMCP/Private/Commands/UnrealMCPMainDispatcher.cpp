@@ -82,6 +82,9 @@ void FUnrealMCPMainDispatcher::RegisterAllCommands()
     
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
     
+    // Publish the whole command set once instead of once per command
+    Registry.BeginBatch();
+    
     // Register Blueprint commands
     FBlueprintCommandRegistration::RegisterAllBlueprintCommands();
     
@@ -105,6 +108,8 @@ void FUnrealMCPMainDispatcher::RegisterAllCommands()
     // Register UMG commands
     FUMGCommandRegistration::RegisterAllUMGCommands();
     
+    Registry.EndBatch();
+    
     UE_LOG(LogTemp, Log, TEXT("FUnrealMCPMainDispatcher::RegisterAllCommands: All command types registered"));
 }
 
@@ -139,6 +144,7 @@ void FUnrealMCPMainDispatcher::Shutdown()
     UE_LOG(LogTemp, Log, TEXT("FUnrealMCPMainDispatcher::Shutdown: Shutting down command dispatcher"));
     
     // Unregister all command types
+    FUnrealMCPCommandRegistry::Get().BeginBatch();
     FBlueprintCommandRegistration::UnregisterAllBlueprintCommands();
     FBlueprintNodeCommandRegistration::UnregisterAllBlueprintNodeCommands();
     FBlueprintActionCommandRegistration::UnregisterAllBlueprintActionCommands();
@@ -148,6 +154,7 @@ void FUnrealMCPMainDispatcher::Shutdown()
     
     // Clear the entire registry
     FUnrealMCPCommandRegistry::Get().ClearRegistry();
+    FUnrealMCPCommandRegistry::Get().EndBatch();
     
     bIsInitialized = false;
     
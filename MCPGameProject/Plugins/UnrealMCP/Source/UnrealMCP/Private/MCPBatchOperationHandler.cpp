@@ -1,18 +1,172 @@
 #include "MCPBatchOperationHandler.h"
+#include "MCPCommandHandle.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
+#include "Services/AssetDirtySet.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Misc/Guid.h"
-#include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/Event.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Editor.h"
+#include "Editor/Transactor.h"
+#include "EditorAssetLibrary.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "HAL/PlatformTime.h"
 #include "Logging/LogMacros.h"
+#include <atomic>
 
 DEFINE_LOG_CATEGORY_STATIC(LogMCPBatchOperations, Log, All);
 
+namespace
+{
+    /** Default executor: run the operation directly through the command registry */
+    TSharedRef<FJsonObject> ExecuteThroughRegistry(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+    {
+        TSharedRef<FJsonObject> Envelope = MakeShared<FJsonObject>();
+        TSharedPtr<FJsonObject> ResultJson = FUnrealMCPCommandRegistry::Get().ExecuteCommandJson(CommandType, Params);
+        
+        bool bSuccess = ResultJson.IsValid();
+        if (bSuccess)
+        {
+            ResultJson->TryGetBoolField(TEXT("success"), bSuccess);
+        }
+        
+        if (bSuccess)
+        {
+            Envelope->SetStringField(TEXT("status"), TEXT("success"));
+            Envelope->SetObjectField(TEXT("result"), ResultJson);
+        }
+        else
+        {
+            FString ErrorMessage = TEXT("Command produced no result");
+            if (ResultJson.IsValid())
+            {
+                ResultJson->TryGetStringField(TEXT("error"), ErrorMessage);
+            }
+            Envelope->SetStringField(TEXT("status"), TEXT("error"));
+            Envelope->SetStringField(TEXT("error"), ErrorMessage);
+        }
+        return Envelope;
+    }
+    
+    /** Envelope recorded for an operation that was skipped because the batch was cancelled */
+    TSharedRef<FJsonObject> MakeCancelledEnvelope()
+    {
+        TSharedRef<FJsonObject> Envelope = MakeShared<FJsonObject>();
+        Envelope->SetStringField(TEXT("status"), TEXT("error"));
+        Envelope->SetStringField(TEXT("error"), TEXT("Batch was cancelled before the operation ran"));
+        Envelope->SetStringField(TEXT("error_type"), TEXT("cancelled"));
+        return Envelope;
+    }
+    
+    /** Envelope recorded for game-thread operations the game thread dropped without running, e.g. during shutdown */
+    TSharedRef<FJsonObject> MakeGameThreadUnavailableEnvelope()
+    {
+        TSharedRef<FJsonObject> Envelope = MakeShared<FJsonObject>();
+        Envelope->SetStringField(TEXT("status"), TEXT("error"));
+        Envelope->SetStringField(TEXT("error"), TEXT("Game thread stopped accepting work before the operation ran"));
+        return Envelope;
+    }
+    
+    /** @return True if the envelope reports success */
+    bool IsSuccessEnvelope(const TSharedPtr<FJsonObject>& Envelope)
+    {
+        FString Status;
+        return Envelope.IsValid() && Envelope->TryGetStringField(TEXT("status"), Status) && Status == TEXT("success");
+    }
+    
+    /**
+     * Pool operations of one wave, claimed one at a time by whichever worker is free
+     * Shared with the pool tasks, which may only start after every operation was claimed.
+     */
+    struct FPoolWaveQueue
+    {
+        explicit FPoolWaveQueue(int32 InCount)
+            : Count(InCount)
+            , NextSlot(0)
+            , Remaining(InCount)
+            , Done(EEventMode::ManualReset)
+        {
+        }
+        
+        const int32 Count;
+        std::atomic<int32> NextSlot;
+        std::atomic<int32> Remaining;
+        FEventRef Done;
+    };
+    
+    /**
+     * Wait until every pool operation of a wave has finished
+     * On the game thread, game-thread tasks keep being processed meanwhile, so a pool
+     * operation that hops to the game thread finishes instead of waiting on it.
+     */
+    void WaitForPoolOperations(FPoolWaveQueue& Queue)
+    {
+        if (!IsInGameThread() || FTaskGraphInterface::Get().IsThreadProcessingTasks(ENamedThreads::GameThread))
+        {
+            Queue.Done->Wait();
+            return;
+        }
+        
+        while (!Queue.Done->Wait(1))
+        {
+            FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        }
+    }
+    
+    /** @return True if the operation's command declared itself safe to run on a pool thread right now */
+    bool CanRunOffGameThread(const FString& CommandType)
+    {
+        switch (FUnrealMCPCommandRegistry::Get().GetCommandThreadAffinity(CommandType))
+        {
+        case EMCPCommandThreadAffinity::AnyThread:
+            return true;
+        case EMCPCommandThreadAffinity::AssetRegistrySafe:
+        {
+            // During the initial scan the registry is still being filled from the game thread
+            IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+            return AssetRegistry && !AssetRegistry->IsLoadingAssets();
+        }
+        default:
+            return false;
+        }
+    }
+    
+    /** @return The operation's parameters, parsing the JSON string only if the caller did not supply an object */
+    TSharedPtr<FJsonObject> ResolveParameters(const FMCPBatchOperation& Operation)
+    {
+        if (Operation.ParsedParameters.IsValid())
+        {
+            return Operation.ParsedParameters;
+        }
+        
+        TSharedPtr<FJsonObject> Parameters;
+        if (!Operation.Parameters.IsEmpty())
+        {
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Operation.Parameters);
+            FJsonSerializer::Deserialize(Reader, Parameters);
+        }
+        return Parameters.IsValid() ? Parameters : MakeShared<FJsonObject>();
+    }
+}
+
 UMCPBatchOperationHandler::UMCPBatchOperationHandler()
     : BatchContext(nullptr)
     , bStopOnFirstFailure(false)
     , MaxParallelOperations(4)
     , bBatchExecuted(false)
+    , GameThreadExecutor(&ExecuteThroughRegistry)
+    , AnyThreadExecutor(&ExecuteThroughRegistry)
+    , WaveCount(0)
+    , ActiveDirtiedPackages(nullptr)
+    , bBatchTransactionOpen(false)
+    , bHasBatchTransaction(false)
+    , bFlushAssetsOnCompletion(false)
+    , bRolledBack(false)
 {
     BatchContext = NewObject<UMCPOperationContext>(this, TEXT("BatchContext"));
 }
@@ -26,7 +180,14 @@ void UMCPBatchOperationHandler::Initialize(const FString& BatchName, const FStri
     
     Operations.Empty();
     Results.Empty();
+    OperationOutcomes.Empty();
+    FinishedOperations.Empty();
+    TrackedPackages.Empty();
+    RevertedPackages.Empty();
     bBatchExecuted = false;
+    bHasBatchTransaction = false;
+    bRolledBack = false;
+    WaveCount = 0;
     
     UE_LOG(LogMCPBatchOperations, Log, TEXT("Initialized batch operation handler: %s"), *BatchName);
 }
@@ -80,98 +241,276 @@ void UMCPBatchOperationHandler::AddOperations(const TArray<FMCPBatchOperation>&
 }
 
 bool UMCPBatchOperationHandler::ExecuteBatch()
+{
+    return ExecuteBatchInternal(false);
+}
+
+bool UMCPBatchOperationHandler::ExecuteBatchWithRollback()
+{
+    return ExecuteBatchInternal(true);
+}
+
+bool UMCPBatchOperationHandler::ExecuteBatchInternal(bool bRollbackOnFailure)
 {
     if (bBatchExecuted)
     {
-        if (BatchContext)
+        RunOnGameThread([this]()
         {
-            BatchContext->AddWarning(TEXT("Batch already executed"), TEXT("Cannot execute batch multiple times"));
-        }
+            if (BatchContext)
+            {
+                BatchContext->AddWarning(TEXT("Batch already executed"), TEXT("Cannot execute batch multiple times"));
+            }
+        });
         return false;
     }
     
     if (Operations.Num() == 0)
     {
-        if (BatchContext)
+        RunOnGameThread([this]()
         {
-            BatchContext->AddWarning(TEXT("No operations to execute"), TEXT("Batch contains no operations"));
-        }
+            if (BatchContext)
+            {
+                BatchContext->AddWarning(TEXT("No operations to execute"), TEXT("Batch contains no operations"));
+            }
+        });
         return true;
     }
     
     // Validate dependencies
-    if (!ValidateDependencies())
+    FString DependencyError;
+    if (!ValidateDependencies(DependencyError))
     {
-        if (BatchContext)
+        RunOnGameThread([this, &DependencyError]()
         {
-            BatchContext->AddError(
-                FMCPError(EMCPErrorType::ValidationFailed, 0, TEXT("Invalid operation dependencies")),
-                EMCPErrorSeverity::Error
-            );
+            if (BatchContext)
+            {
+                BatchContext->AddError(
+                    FMCPError(EMCPErrorType::ValidationFailed, 0, TEXT("Invalid operation dependencies"), DependencyError),
+                    EMCPErrorSeverity::Error
+                );
+            }
+        });
+        return false;
+    }
+    
+    bBatchExecuted = true;
+    bool bOverallSuccess = true;
+    bool bStopRequested = false;
+    OperationOutcomes.Empty(Operations.Num());
+    FinishedOperations.Empty(Operations.Num());
+    WaveCount = 0;
+    
+    UE_LOG(LogMCPBatchOperations, Log, TEXT("Starting batch execution with %d operations (up to %d in parallel)"), 
+           Operations.Num(), MaxParallelOperations);
+    
+    if (!RunOnGameThread([this]() { BeginBatchOnGameThread(); }))
+    {
+        UE_LOG(LogMCPBatchOperations, Warning, TEXT("Batch not started: the game thread is no longer accepting work"));
+        return false;
+    }
+    
+    // Execute one topological wave at a time
+    while (!bStopRequested && OperationOutcomes.Num() < Operations.Num())
+    {
+        if (FMCPCommandHandle::IsCurrentCancelled())
+        {
+            UE_LOG(LogMCPBatchOperations, Warning, TEXT("Batch cancelled with %d operations not run"), 
+                   Operations.Num() - OperationOutcomes.Num());
+            RunOnGameThread([this]()
+            {
+                if (BatchContext)
+                {
+                    BatchContext->AddWarning(TEXT("Batch cancelled"), 
+                                           FString::Printf(TEXT("%d operations were not run"), Operations.Num() - OperationOutcomes.Num()));
+                }
+            });
+            bOverallSuccess = false;
+            break;
+        }
+    
+        TArray<FMCPBatchOperation> ReadyOperations = GetExecutableOperations();
+        if (ReadyOperations.Num() == 0)
+        {
+            // Unreachable once dependencies are validated; guards against spinning forever
+            break;
+        }
+    
+        const int32 WaveIndex = WaveCount++;
+        TArray<FMCPBatchOperation> Wave;
+        Wave.Reserve(ReadyOperations.Num());
+    
+        for (const FMCPBatchOperation& Operation : ReadyOperations)
+        {
+            // A dependency failed, so this operation cannot run
+            if (!AreDependenciesSatisfied(Operation))
+            {
+                FFinishedOperation& Skipped = FinishedOperations.AddDefaulted_GetRef();
+                Skipped.Operation = Operation;
+                Skipped.bDependencyFailed = true;
+                Skipped.Wave = WaveIndex;
+    
+                OperationOutcomes.Add(Operation.OperationId, false);
+                bOverallSuccess = false;
+    
+                if (bStopOnFirstFailure && !Operation.bContinueOnFailure)
+                {
+                    bStopRequested = true;
+                }
+                continue;
+            }
+    
+            Wave.Add(Operation);
         }
+    
+        // Execute the wave
+        for (FFinishedOperation& Finished : ExecuteWave(Wave, WaveIndex))
+        {
+            const bool bSuccess = IsSuccessEnvelope(Finished.Envelope);
+            OperationOutcomes.Add(Finished.Operation.OperationId, bSuccess);
+    
+            if (!bSuccess)
+            {
+                bOverallSuccess = false;
+    
+                if (bStopOnFirstFailure && !Finished.Operation.bContinueOnFailure)
+                {
+                    UE_LOG(LogMCPBatchOperations, Warning, TEXT("Stopping batch execution after wave %d due to failure in operation: %s"), 
+                           WaveIndex, *Finished.Operation.OperationId);
+                    bStopRequested = true;
+                }
+            }
+    
+            FinishedOperations.Add(MoveTemp(Finished));
+        }
+    }
+    
+    const bool bRollback = bRollbackOnFailure && !bOverallSuccess;
+    if (bRollback)
+    {
+        UE_LOG(LogMCPBatchOperations, Warning, TEXT("Batch execution failed, initiating rollback"));
+    }
+    
+    if (!RunOnGameThread([this, bOverallSuccess, bRollback]() { EndBatchOnGameThread(bOverallSuccess, bRollback); }))
+    {
+        UE_LOG(LogMCPBatchOperations, Error, TEXT("Batch not finished: the game thread stopped accepting work, the batch transaction is left open"));
         return false;
     }
     
-    // Sort operations by priority and dependencies
+    UE_LOG(LogMCPBatchOperations, Log, TEXT("Batch execution completed. Success: %s, Operations: %d, Waves: %d"), 
+           bOverallSuccess ? TEXT("true") : TEXT("false"), Results.Num(), WaveCount);
+    
+    return bOverallSuccess;
+}
+
+TFuture<bool> UMCPBatchOperationHandler::StartOnGameThread(TFunction<void()> Work) const
+{
+    if (IsInGameThread())
+    {
+        Work();
+        return MakeFulfilledPromise<bool>(true).GetFuture();
+    }
+    
+    if (GameThreadRunner)
+    {
+        return GameThreadRunner(MoveTemp(Work));
+    }
+    
+    TSharedRef<TPromise<bool>, ESPMode::ThreadSafe> WorkDone = MakeShared<TPromise<bool>, ESPMode::ThreadSafe>();
+    TFuture<bool> Future = WorkDone->GetFuture();
+    AsyncTask(ENamedThreads::GameThread, [Work = MoveTemp(Work), WorkDone]()
+    {
+        Work();
+        WorkDone->SetValue(true);
+    });
+    return Future;
+}
+
+bool UMCPBatchOperationHandler::RunOnGameThread(TFunction<void()> Work) const
+{
+    return StartOnGameThread(MoveTemp(Work)).Get();
+}
+
+void UMCPBatchOperationHandler::BeginBatchOnGameThread()
+{
+    check(IsInGameThread());
+    
+    // Sort operations by priority; waves keep this order, so higher priorities start first within a wave
     SortOperationsByPriorityAndDependencies();
     
-    bBatchExecuted = true;
-    bool bOverallSuccess = true;
+    TrackedPackages.Empty();
+    RevertedPackages.Empty();
+    bHasBatchTransaction = false;
+    bRolledBack = false;
     
-    UE_LOG(LogMCPBatchOperations, Log, TEXT("Starting batch execution with %d operations"), Operations.Num());
+    // Nothing the batch touches is saved before the batch knows whether it rolls back
+    FAssetDirtySet::Get().SuspendFlushes();
+    PendingSavesBeforeBatch = FAssetDirtySet::Get().GetPendingSavePackages();
     
-    // Execute operations
-    for (const FMCPBatchOperation& Operation : Operations)
+    // Watch packages for the duration of the batch so a rollback knows what to revert
+    PackageDirtyHandle = UPackage::PackageMarkedDirtyEvent.AddUObject(this, &UMCPBatchOperationHandler::OnPackageMarkedDirty);
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddUObject(this, &UMCPBatchOperationHandler::OnPackageSaved);
+    
+    // Every change made by the batch lands in one undo transaction; transactions opened by the commands nest inside it
+    PreviousUndoTransactionId = GEditor && GEditor->Trans ? GEditor->Trans->GetUndoContext(false).TransactionId : FGuid();
+    bBatchTransactionOpen = GEditor && GEditor->CanTransact() && !GIsTransacting;
+    if (bBatchTransactionOpen)
+    {
+        GEditor->BeginTransaction(TEXT("UnrealMCP"), 
+                                  FText::FromString(FString::Printf(TEXT("MCP Batch (%d operations)"), Operations.Num())), 
+                                  nullptr);
+    }
+}
+
+void UMCPBatchOperationHandler::EndBatchOnGameThread(bool bOverallSuccess, bool bRollback)
+{
+    check(IsInGameThread());
+    
+    if (bBatchTransactionOpen)
     {
-        // Check if dependencies are satisfied
-        if (!AreDependenciesSatisfied(Operation))
+        GEditor->EndTransaction();
+        bBatchTransactionOpen = false;
+    }
+    
+    // An empty transaction is discarded, in which case there is nothing to undo
+    bHasBatchTransaction = GEditor && GEditor->Trans && GEditor->Trans->GetUndoContext(false).TransactionId != PreviousUndoTransactionId;
+    
+    UPackage::PackageMarkedDirtyEvent.Remove(PackageDirtyHandle);
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+    
+    // Results own operation contexts, which are UObjects, so they are only built here
+    Results.Reserve(Results.Num() + FinishedOperations.Num());
+    for (FFinishedOperation& Finished : FinishedOperations)
+    {
+        if (Finished.bDependencyFailed)
         {
             FMCPBatchOperationResult FailedResult;
-            FailedResult.Operation = Operation;
+            FailedResult.Operation = Finished.Operation;
             FailedResult.bSuccess = false;
             FailedResult.ResultData = TEXT("Dependencies not satisfied");
+            FailedResult.Wave = Finished.Wave;
             FailedResult.OperationContext = NewObject<UMCPOperationContext>(this);
-            FailedResult.OperationContext->Initialize(Operation.OperationType, Operation.OperationId);
+            FailedResult.OperationContext->Initialize(Finished.Operation.OperationType, Finished.Operation.OperationId);
             FailedResult.OperationContext->AddError(
                 FMCPError(EMCPErrorType::ExecutionFailed, 0, TEXT("Operation dependencies not satisfied")),
                 EMCPErrorSeverity::Error
             );
-            
-            Results.Add(FailedResult);
-            bOverallSuccess = false;
-            
-            if (bStopOnFirstFailure && !Operation.bContinueOnFailure)
-            {
-                break;
-            }
+            Results.Add(MoveTemp(FailedResult));
             continue;
         }
-        
-        // Execute the operation
-        FMCPBatchOperationResult Result = ExecuteSingleOperation(Operation);
-        Results.Add(Result);
-        
-        if (!Result.bSuccess)
-        {
-            bOverallSuccess = false;
-            
-            if (bStopOnFirstFailure && !Operation.bContinueOnFailure)
-            {
-                UE_LOG(LogMCPBatchOperations, Warning, TEXT("Stopping batch execution due to failure in operation: %s"), 
-                       *Operation.OperationId);
-                break;
-            }
-        }
+    
+        FMCPBatchOperationResult& Result = Results.Add_GetRef(MakeOperationResult(Finished.Operation, Finished.Envelope, Finished.ExecutionSeconds, Finished.Wave));
+        Result.DirtiedPackages = MoveTemp(Finished.DirtiedPackages);
     }
+    FinishedOperations.Empty();
     
     if (BatchContext)
     {
         BatchContext->CompleteOperation();
-        
+    
         if (bOverallSuccess)
         {
             BatchContext->AddInfo(TEXT("Batch execution completed successfully"), 
-                                FString::Printf(TEXT("Executed %d operations"), Results.Num()));
+                                FString::Printf(TEXT("Executed %d operations in %d waves"), Results.Num(), WaveCount));
         }
         else
         {
@@ -182,23 +521,18 @@ bool UMCPBatchOperationHandler::ExecuteBatch()
         }
     }
     
-    UE_LOG(LogMCPBatchOperations, Log, TEXT("Batch execution completed. Success: %s, Operations: %d"), 
-           bOverallSuccess ? TEXT("true") : TEXT("false"), Results.Num());
-    
-    return bOverallSuccess;
-}
-
-bool UMCPBatchOperationHandler::ExecuteBatchWithRollback()
-{
-    bool bSuccess = ExecuteBatch();
-    
-    if (!bSuccess)
+    if (bRollback)
     {
-        UE_LOG(LogMCPBatchOperations, Warning, TEXT("Batch execution failed, initiating rollback"));
         RollbackOperations();
     }
     
-    return bSuccess;
+    FAssetDirtySet::Get().ResumeFlushes();
+    
+    // Compile and save what the batch modified, once per asset, before the batch answers
+    if (bFlushAssetsOnCompletion)
+    {
+        FAssetDirtySet::Get().Flush();
+    }
 }
 
 TArray<FMCPBatchOperationResult> UMCPBatchOperationHandler::GetResults() const
@@ -284,6 +618,73 @@ FString UMCPBatchOperationHandler::CreateBatchResponse() const
     return OutputString;
 }
 
+TSharedPtr<FJsonObject> UMCPBatchOperationHandler::CreateBatchResponseJson() const
+{
+    TSharedPtr<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+    
+    // "success" reports that the batch ran; individual failures are reported per operation
+    int32 FailedOperations = 0;
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    ResultsArray.Reserve(Results.Num());
+    
+    for (const FMCPBatchOperationResult& Result : Results)
+    {
+        TSharedPtr<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+        ResultObject->SetStringField(TEXT("operationId"), Result.Operation.OperationId);
+        ResultObject->SetStringField(TEXT("operationType"), Result.Operation.OperationType);
+        ResultObject->SetBoolField(TEXT("success"), Result.bSuccess);
+        ResultObject->SetNumberField(TEXT("wave"), Result.Wave);
+        ResultObject->SetNumberField(TEXT("executionTime"), Result.ExecutionTime);
+        
+        if (Result.DirtiedPackages.Num() > 0)
+        {
+            TArray<TSharedPtr<FJsonValue>> PackagesArray;
+            for (const FName& PackageName : Result.DirtiedPackages)
+            {
+                PackagesArray.Add(MakeShared<FJsonValueString>(PackageName.ToString()));
+            }
+            ResultObject->SetArrayField(TEXT("dirtiedPackages"), PackagesArray);
+        }
+        
+        if (Result.bSuccess)
+        {
+            ResultObject->SetObjectField(TEXT("result"), Result.ResultJson.IsValid() ? Result.ResultJson : MakeShared<FJsonObject>());
+        }
+        else
+        {
+            ResultObject->SetStringField(TEXT("error"), Result.ResultData);
+            ++FailedOperations;
+        }
+        
+        ResultsArray.Add(MakeShared<FJsonValueObject>(ResultObject));
+    }
+    
+    ResponseObject->SetBoolField(TEXT("success"), bBatchExecuted);
+    ResponseObject->SetBoolField(TEXT("allSucceeded"), IsBatchSuccessful() && Results.Num() == Operations.Num());
+    ResponseObject->SetNumberField(TEXT("totalOperations"), Operations.Num());
+    ResponseObject->SetNumberField(TEXT("executedOperations"), Results.Num());
+    ResponseObject->SetNumberField(TEXT("failedOperations"), FailedOperations);
+    ResponseObject->SetNumberField(TEXT("waves"), WaveCount);
+    ResponseObject->SetNumberField(TEXT("maxParallelOperations"), MaxParallelOperations);
+    ResponseObject->SetBoolField(TEXT("rolledBack"), bRolledBack);
+    if (bRolledBack)
+    {
+        TArray<TSharedPtr<FJsonValue>> RevertedArray;
+        for (const FName& PackageName : RevertedPackages)
+        {
+            RevertedArray.Add(MakeShared<FJsonValueString>(PackageName.ToString()));
+        }
+        ResponseObject->SetArrayField(TEXT("revertedPackages"), RevertedArray);
+    }
+    if (BatchContext)
+    {
+        ResponseObject->SetNumberField(TEXT("batchDuration"), BatchContext->GetOperationDuration());
+    }
+    ResponseObject->SetArrayField(TEXT("results"), ResultsArray);
+    
+    return ResponseObject;
+}
+
 bool UMCPBatchOperationHandler::IsBatchSuccessful() const
 {
     if (!bBatchExecuted)
@@ -347,7 +748,14 @@ void UMCPBatchOperationHandler::Clear()
 {
     Operations.Empty();
     Results.Empty();
+    OperationOutcomes.Empty();
+    FinishedOperations.Empty();
+    TrackedPackages.Empty();
+    RevertedPackages.Empty();
     bBatchExecuted = false;
+    bHasBatchTransaction = false;
+    bRolledBack = false;
+    WaveCount = 0;
     
     if (BatchContext)
     {
@@ -365,10 +773,21 @@ void UMCPBatchOperationHandler::SetMaxParallelOperations(int32 MaxParallel)
     MaxParallelOperations = FMath::Max(1, MaxParallel);
 }
 
+void UMCPBatchOperationHandler::SetCommandExecutors(FMCPBatchCommandExecutor InGameThreadExecutor, FMCPBatchCommandExecutor InAnyThreadExecutor)
+{
+    GameThreadExecutor = InGameThreadExecutor ? MoveTemp(InGameThreadExecutor) : FMCPBatchCommandExecutor(&ExecuteThroughRegistry);
+    AnyThreadExecutor = InAnyThreadExecutor ? MoveTemp(InAnyThreadExecutor) : FMCPBatchCommandExecutor(&ExecuteThroughRegistry);
+}
+
+void UMCPBatchOperationHandler::SetGameThreadRunner(FMCPBatchGameThreadRunner InGameThreadRunner)
+{
+    GameThreadRunner = MoveTemp(InGameThreadRunner);
+}
+
 void UMCPBatchOperationHandler::SortOperationsByPriorityAndDependencies()
 {
-    // Priority-based sorting - topological sorting for dependencies would be a future enhancement
-    Operations.Sort([](const FMCPBatchOperation& A, const FMCPBatchOperation& B) {
+    // Dependencies are honoured by the wave scheduler; the stable sort keeps submission order between equal priorities
+    Operations.StableSort([](const FMCPBatchOperation& A, const FMCPBatchOperation& B) {
         return A.Priority > B.Priority;
     });
 }
@@ -377,17 +796,21 @@ bool UMCPBatchOperationHandler::AreDependenciesSatisfied(const FMCPBatchOperatio
 {
     for (const FString& DependencyId : Operation.Dependencies)
     {
-        bool bDependencyFound = false;
-        for (const FMCPBatchOperationResult& Result : Results)
+        const bool* bDependencySucceeded = OperationOutcomes.Find(DependencyId);
+        if (!bDependencySucceeded || !*bDependencySucceeded)
         {
-            if (Result.Operation.OperationId == DependencyId && Result.bSuccess)
-            {
-                bDependencyFound = true;
-                break;
-            }
+            return false;
         }
-        
-        if (!bDependencyFound)
+    }
+    
+    return true;
+}
+
+bool UMCPBatchOperationHandler::AreDependenciesFinished(const FMCPBatchOperation& Operation) const
+{
+    for (const FString& DependencyId : Operation.Dependencies)
+    {
+        if (!OperationOutcomes.Contains(DependencyId))
         {
             return false;
         }
@@ -396,59 +819,267 @@ bool UMCPBatchOperationHandler::AreDependenciesSatisfied(const FMCPBatchOperatio
     return true;
 }
 
-FMCPBatchOperationResult UMCPBatchOperationHandler::ExecuteSingleOperation(const FMCPBatchOperation& Operation)
+TArray<UMCPBatchOperationHandler::FFinishedOperation> UMCPBatchOperationHandler::ExecuteWave(const TArray<FMCPBatchOperation>& Wave, int32 WaveIndex)
+{
+    // Parse parameters and split the wave by thread affinity up front, on the scheduling thread
+    TArray<FFinishedOperation> Runs;
+    Runs.SetNum(Wave.Num());
+    TArray<TSharedPtr<FJsonObject>> Parameters;
+    Parameters.SetNum(Wave.Num());
+    TArray<int32> PoolIndices;
+    TArray<int32> GameThreadIndices;
+    
+    for (int32 Index = 0; Index < Wave.Num(); ++Index)
+    {
+        Runs[Index].Operation = Wave[Index];
+        Runs[Index].Wave = WaveIndex;
+        Parameters[Index] = ResolveParameters(Wave[Index]);
+        (CanRunOffGameThread(Wave[Index].OperationType) ? PoolIndices : GameThreadIndices).Add(Index);
+    }
+    
+    UE_LOG(LogMCPBatchOperations, Verbose, TEXT("Wave %d: %d pool operations, %d game-thread operations"), 
+           WaveIndex, PoolIndices.Num(), GameThreadIndices.Num());
+    
+    auto RunOperation = [&Wave, &Runs, &Parameters](int32 Index, const FMCPBatchCommandExecutor& Executor)
+    {
+        FFinishedOperation& Run = Runs[Index];
+        if (FMCPCommandHandle::IsCurrentCancelled())
+        {
+            Run.Envelope = MakeCancelledEnvelope();
+            return;
+        }
+    
+        const double StartSeconds = FPlatformTime::Seconds();
+        Run.Envelope = Executor(Wave[Index].OperationType, Parameters[Index]);
+        Run.ExecutionSeconds = FPlatformTime::Seconds() - StartSeconds;
+    };
+    
+    // Thread-safe operations are pulled by up to MaxParallelOperations workers; each run writes only its own slot.
+    // A worker that starts after every operation was claimed leaves without touching this frame
+    TSharedRef<FPoolWaveQueue, ESPMode::ThreadSafe> PoolQueue = MakeShared<FPoolWaveQueue, ESPMode::ThreadSafe>(PoolIndices.Num());
+    auto RunPoolOperations = [this, PoolQueue, &PoolIndices, &RunOperation]()
+    {
+        for (int32 Slot = PoolQueue->NextSlot++; Slot < PoolQueue->Count; Slot = PoolQueue->NextSlot++)
+        {
+            RunOperation(PoolIndices[Slot], AnyThreadExecutor);
+            if (--PoolQueue->Remaining == 0)
+            {
+                PoolQueue->Done->Trigger();
+            }
+        }
+    };
+    
+    // Work handed to other threads re-enters the batch command's scope so operations still see its cancellation and deadline
+    const FMCPCommandHandle* BatchHandle = FMCPCommandHandle::GetCurrent();
+    const bool bOnGameThread = IsInGameThread();
+    
+    // Off the game thread the scheduling thread is one of the workers, so the wave progresses even when the pool is busy
+    const int32 WorkerCount = FMath::Min(MaxParallelOperations, PoolIndices.Num());
+    const int32 PoolWorkerCount = bOnGameThread ? WorkerCount : WorkerCount - 1;
+    
+    for (int32 WorkerIndex = 0; WorkerIndex < PoolWorkerCount; ++WorkerIndex)
+    {
+        Async(EAsyncExecution::ThreadPool, [BatchHandle, RunPoolOperations]()
+        {
+            TOptional<FMCPCommandHandle::FExecutionScope> ExecutionScope;
+            if (BatchHandle)
+            {
+                ExecutionScope.Emplace(*BatchHandle);
+            }
+            
+            RunPoolOperations();
+        });
+    }
+    
+    // The wave's game-thread operations go to the game thread as one work item while the pool works through the rest;
+    // only these can dirty packages, so each dirty notification belongs to the operation running at the time
+    TFuture<bool> GameThreadWork;
+    if (GameThreadIndices.Num() > 0)
+    {
+        GameThreadWork = StartOnGameThread([this, BatchHandle, &GameThreadIndices, &Runs, &RunOperation]()
+        {
+            TOptional<FMCPCommandHandle::FExecutionScope> ExecutionScope;
+            if (BatchHandle)
+            {
+                ExecutionScope.Emplace(*BatchHandle);
+            }
+    
+            for (int32 Index : GameThreadIndices)
+            {
+                ActiveDirtiedPackages = &Runs[Index].DirtiedPackages;
+                RunOperation(Index, GameThreadExecutor);
+                ActiveDirtiedPackages = nullptr;
+            }
+        });
+    }
+    
+    if (!bOnGameThread)
+    {
+        RunPoolOperations();
+    }
+    
+    if (PoolQueue->Count > 0)
+    {
+        WaitForPoolOperations(*PoolQueue);
+    }
+    
+    if (GameThreadWork.IsValid() && !GameThreadWork.Get())
+    {
+        for (int32 Index : GameThreadIndices)
+        {
+            Runs[Index].Envelope = MakeGameThreadUnavailableEnvelope();
+        }
+    }
+    
+    return Runs;
+}
+
+FMCPBatchOperationResult UMCPBatchOperationHandler::MakeOperationResult(const FMCPBatchOperation& Operation, const TSharedPtr<FJsonObject>& Envelope, double ExecutionSeconds, int32 WaveIndex)
 {
     FMCPBatchOperationResult Result;
     Result.Operation = Operation;
+    Result.Wave = WaveIndex;
+    Result.ExecutionTime = static_cast<float>(ExecutionSeconds);
     Result.OperationContext = NewObject<UMCPOperationContext>(this);
     Result.OperationContext->Initialize(Operation.OperationType, Operation.OperationId);
     
-    FDateTime StartTime = FDateTime::Now();
-    
-    // Operation execution is delegated to the command registry system
-    // This is a placeholder for future batch operation integration
-    UE_LOG(LogMCPBatchOperations, Verbose, TEXT("Executing operation: %s [%s]"), 
-           *Operation.OperationType, *Operation.OperationId);
-    
-    // Simulate operation execution
-    Result.bSuccess = true;
-    Result.ResultData = FString::Printf(TEXT("Operation %s completed successfully"), *Operation.OperationId);
+    if (IsSuccessEnvelope(Envelope))
+    {
+        Result.bSuccess = true;
+        
+        const TSharedPtr<FJsonObject>* ResultObject = nullptr;
+        if (Envelope->TryGetObjectField(TEXT("result"), ResultObject))
+        {
+            Result.ResultJson = *ResultObject;
+        }
+        Result.OperationContext->AddInfo(TEXT("Operation executed"), FString::Printf(TEXT("Wave %d"), WaveIndex));
+    }
+    else
+    {
+        Result.bSuccess = false;
+        Result.ResultData = TEXT("Operation produced no response");
+        if (Envelope.IsValid())
+        {
+            Envelope->TryGetStringField(TEXT("error"), Result.ResultData);
+        }
+        Result.OperationContext->AddError(
+            FMCPError(EMCPErrorType::ExecutionFailed, 0, TEXT("Operation failed"), Result.ResultData),
+            EMCPErrorSeverity::Error
+        );
+    }
     
-    Result.OperationContext->AddInfo(TEXT("Operation executed"), TEXT("Placeholder execution"));
     Result.OperationContext->CompleteOperation();
     
-    FDateTime EndTime = FDateTime::Now();
-    Result.ExecutionTime = (EndTime - StartTime).GetTotalSeconds();
+    UE_LOG(LogMCPBatchOperations, Verbose, TEXT("Operation %s [%s] finished in wave %d: %s"), 
+           *Operation.OperationType, *Operation.OperationId, WaveIndex, Result.bSuccess ? TEXT("success") : *Result.ResultData);
     
     return Result;
 }
 
 void UMCPBatchOperationHandler::RollbackOperations()
 {
-    UE_LOG(LogMCPBatchOperations, Warning, TEXT("Starting rollback of %d operations"), Results.Num());
+    check(IsInGameThread());
+    
+    UE_LOG(LogMCPBatchOperations, Warning, TEXT("Starting rollback of %d operations (%d packages dirtied)"), 
+           Results.Num(), TrackedPackages.Num());
     
-    // Rollback in reverse order
-    for (int32 i = Results.Num() - 1; i >= 0; --i)
+    // Undo restores every object the commands modified inside the batch transaction
+    if (bHasBatchTransaction && GEditor)
     {
-        const FMCPBatchOperationResult& Result = Results[i];
-        if (Result.bSuccess)
+        if (!GEditor->UndoTransaction(false))
         {
-            // Rollback logic would be operation-specific and is a future enhancement
-            UE_LOG(LogMCPBatchOperations, Verbose, TEXT("Rolling back operation: %s"), 
-                   *Result.Operation.OperationId);
+            UE_LOG(LogMCPBatchOperations, Warning, TEXT("Could not undo the batch transaction"));
         }
+        bHasBatchTransaction = false;
     }
     
+    // Saves the batch queued would write the rolled-back state; saves queued before the batch still stand
+    TSet<FName> DiscardedSaves;
+    for (const TPair<FName, FTrackedPackage>& Tracked : TrackedPackages)
+    {
+        if (!PendingSavesBeforeBatch.Contains(Tracked.Key))
+        {
+            DiscardedSaves.Add(Tracked.Key);
+        }
+    }
+    FAssetDirtySet::Get().DiscardPendingSaves(DiscardedSaves);
+    
+    // Undo does not cover package state: delete what the batch created and clear the dirty flag it left behind
+    RevertedPackages.Reset();
+    for (const TPair<FName, FTrackedPackage>& Tracked : TrackedPackages)
+    {
+        const FString PackageName = Tracked.Key.ToString();
+        
+        if (!Tracked.Value.bExistedOnDisk)
+        {
+            if (UEditorAssetLibrary::DeleteAsset(PackageName))
+            {
+                RevertedPackages.Add(Tracked.Key);
+            }
+            else
+            {
+                UE_LOG(LogMCPBatchOperations, Warning, TEXT("Could not delete package created by the batch: %s"), *PackageName);
+            }
+        }
+        else if (!Tracked.Value.bWasDirty && !Tracked.Value.bSavedDuringBatch)
+        {
+            // The in-memory state matches disk again, so there is nothing left to save
+            UPackage* Package = FindPackage(nullptr, *PackageName);
+            if (Package && Package->IsDirty())
+            {
+                Package->SetDirtyFlag(false);
+                RevertedPackages.Add(Tracked.Key);
+            }
+        }
+    }
+    
+    bRolledBack = true;
+    
     if (BatchContext)
     {
         BatchContext->AddInfo(TEXT("Rollback completed"), 
-                            FString::Printf(TEXT("Rolled back %d operations"), Results.Num()));
+                            FString::Printf(TEXT("Rolled back %d operations, reverted %d packages"), Results.Num(), RevertedPackages.Num()));
     }
+    
+    UE_LOG(LogMCPBatchOperations, Log, TEXT("Rollback completed, reverted %d packages"), RevertedPackages.Num());
 }
 
-bool UMCPBatchOperationHandler::ValidateDependencies() const
+void UMCPBatchOperationHandler::OnPackageMarkedDirty(UPackage* Package, bool bWasDirty)
 {
-    return !FMCPBatchOperationUtils::HasCircularDependencies(Operations);
+    // Packages dirtied between operations belong to whatever else ran on the game thread meanwhile
+    if (!Package || !IsInGameThread() || !ActiveDirtiedPackages)
+    {
+        return;
+    }
+    
+    const FName PackageName = Package->GetFName();
+    if (!TrackedPackages.Contains(PackageName))
+    {
+        // A package that is not on disk yet was created by the batch
+        FTrackedPackage& Tracked = TrackedPackages.Add(PackageName);
+        Tracked.bExistedOnDisk = FPackageName::DoesPackageExist(PackageName.ToString());
+        Tracked.bWasDirty = bWasDirty;
+    }
+    
+    ActiveDirtiedPackages->AddUnique(PackageName);
+}
+
+void UMCPBatchOperationHandler::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+    if (!Package)
+    {
+        return;
+    }
+    
+    if (FTrackedPackage* Tracked = TrackedPackages.Find(Package->GetFName()))
+    {
+        Tracked->bSavedDuringBatch = true;
+    }
+}
+
+bool UMCPBatchOperationHandler::ValidateDependencies(FString& OutError) const
+{
+    return FMCPBatchOperationUtils::ValidateDependencies(Operations, OutError);
 }
 
 TArray<FMCPBatchOperation> UMCPBatchOperationHandler::GetExecutableOperations() const
@@ -457,7 +1088,7 @@ TArray<FMCPBatchOperation> UMCPBatchOperationHandler::GetExecutableOperations()
     
     for (const FMCPBatchOperation& Operation : Operations)
     {
-        if (AreDependenciesSatisfied(Operation))
+        if (!OperationOutcomes.Contains(Operation.OperationId) && AreDependenciesFinished(Operation))
         {
             ExecutableOps.Add(Operation);
         }
@@ -483,31 +1114,51 @@ FMCPBatchOperation FMCPBatchOperationUtils::CreateOperation(const FString& Opera
 
 TArray<FMCPBatchOperation> FMCPBatchOperationUtils::CreateOperationsFromJson(const FString& JsonString)
 {
-    TArray<FMCPBatchOperation> Operations;
-    
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
     
     if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
     {
-        return Operations;
+        return TArray<FMCPBatchOperation>();
     }
     
+    return CreateOperationsFromJsonObject(JsonObject);
+}
+
+TArray<FMCPBatchOperation> FMCPBatchOperationUtils::CreateOperationsFromJsonObject(const TSharedPtr<FJsonObject>& JsonObject)
+{
+    TArray<FMCPBatchOperation> Operations;
+    
     const TArray<TSharedPtr<FJsonValue>>* OperationsArray;
-    if (JsonObject->TryGetArrayField(TEXT("operations"), OperationsArray))
+    if (JsonObject.IsValid() && JsonObject->TryGetArrayField(TEXT("operations"), OperationsArray))
     {
-        for (const TSharedPtr<FJsonValue>& OpValue : *OperationsArray)
+        Operations.Reserve(OperationsArray->Num());
+        
+        for (int32 Index = 0; Index < OperationsArray->Num(); ++Index)
         {
             const TSharedPtr<FJsonObject>* OpObject;
-            if (OpValue->TryGetObject(OpObject) && OpObject->IsValid())
+            if ((*OperationsArray)[Index]->TryGetObject(OpObject) && OpObject->IsValid())
             {
                 FMCPBatchOperation Operation;
-                (*OpObject)->TryGetStringField(TEXT("operationId"), Operation.OperationId);
+                if (!(*OpObject)->TryGetStringField(TEXT("operationId"), Operation.OperationId))
+                {
+                    Operation.OperationId = FString::FromInt(Index);
+                }
                 (*OpObject)->TryGetStringField(TEXT("operationType"), Operation.OperationType);
-                (*OpObject)->TryGetStringField(TEXT("parameters"), Operation.Parameters);
                 (*OpObject)->TryGetNumberField(TEXT("priority"), Operation.Priority);
                 (*OpObject)->TryGetBoolField(TEXT("continueOnFailure"), Operation.bContinueOnFailure);
                 
+                // Parameters may be inlined as an object, which is kept as-is instead of being re-serialized
+                const TSharedPtr<FJsonObject>* ParametersObject;
+                if ((*OpObject)->TryGetObjectField(TEXT("parameters"), ParametersObject))
+                {
+                    Operation.ParsedParameters = *ParametersObject;
+                }
+                else
+                {
+                    (*OpObject)->TryGetStringField(TEXT("parameters"), Operation.Parameters);
+                }
+                
                 const TArray<TSharedPtr<FJsonValue>>* DependenciesArray;
                 if ((*OpObject)->TryGetArrayField(TEXT("dependencies"), DependenciesArray))
                 {
@@ -543,8 +1194,15 @@ bool FMCPBatchOperationUtils::ValidateBatchOperation(const FMCPBatchOperation& O
         return false;
     }
     
+    // A nested batch would block the game thread inside another batch's wave
+    if (Operation.OperationType == TEXT("execute_batch"))
+    {
+        OutError = FString::Printf(TEXT("Operation %s: execute_batch cannot be nested"), *Operation.OperationId);
+        return false;
+    }
+    
     // Validate JSON parameters if provided
-    if (!Operation.Parameters.IsEmpty())
+    if (!Operation.ParsedParameters.IsValid() && !Operation.Parameters.IsEmpty())
     {
         TSharedPtr<FJsonObject> JsonObject;
         TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Operation.Parameters);
@@ -571,6 +1229,43 @@ TMap<FString, TArray<FString>> FMCPBatchOperationUtils::CreateDependencyGraph(co
     return DependencyGraph;
 }
 
+bool FMCPBatchOperationUtils::ValidateDependencies(const TArray<FMCPBatchOperation>& Operations, FString& OutError)
+{
+    TSet<FString> OperationIds;
+    OperationIds.Reserve(Operations.Num());
+    
+    for (const FMCPBatchOperation& Operation : Operations)
+    {
+        bool bAlreadyInSet = false;
+        OperationIds.Add(Operation.OperationId, &bAlreadyInSet);
+        if (bAlreadyInSet)
+        {
+            OutError = FString::Printf(TEXT("Duplicate operation id: %s"), *Operation.OperationId);
+            return false;
+        }
+    }
+    
+    for (const FMCPBatchOperation& Operation : Operations)
+    {
+        for (const FString& Dependency : Operation.Dependencies)
+        {
+            if (!OperationIds.Contains(Dependency))
+            {
+                OutError = FString::Printf(TEXT("Operation %s depends on unknown operation %s"), *Operation.OperationId, *Dependency);
+                return false;
+            }
+        }
+    }
+    
+    if (HasCircularDependencies(Operations))
+    {
+        OutError = TEXT("Operation dependencies contain a cycle");
+        return false;
+    }
+    
+    return true;
+}
+
 bool FMCPBatchOperationUtils::HasCircularDependencies(const TArray<FMCPBatchOperation>& Operations)
 {
     TMap<FString, TArray<FString>> DependencyGraph = CreateDependencyGraph(Operations);
@@ -643,7 +1338,8 @@ TArray<FString> FMCPBatchOperationUtils::GenerateExecutionOrder(const TArray<FMC
             }
         }
         
-        ExecutionOrder.Insert(Node, 0);
+        // Post-order: every dependency has been appended before the node itself
+        ExecutionOrder.Add(Node);
     };
     
     for (const FMCPBatchOperation& Operation : Operations)
@@ -0,0 +1,647 @@
+#include "MCPClientConnection.h"
+#include "UnrealMCPBridge.h"
+#include "MCPLogging.h"
+#include "MCPWireTrace.h"
+#include "Services/AssetDirtySet.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Event.h"
+#include "Async/Async.h"
+
+namespace
+{
+    /** SendBuffer is released after a response leaves it larger than this */
+    constexpr int32 MaxRetainedSendBufferBytes = 1024 * 1024;
+}
+
+/**
+ * Progress and the final response are each sent from their own background task, and those
+ * tasks may run in any order. Whichever task runs first sends everything queued so far, so
+ * a frame never overtakes one produced before it and nothing follows the response.
+ */
+struct FMCPClientConnection::FPipelinedOutbox
+{
+    /** Queue a frame; returns false once the response has been queued */
+    bool Push(const TSharedRef<FJsonObject>& Frame, bool bIsResponse)
+    {
+        FScopeLock Lock(&QueueLock);
+        if (bClosed)
+        {
+            return false;
+        }
+        Queued.Add(Frame);
+        bClosed = bIsResponse;
+        return true;
+    }
+
+    /** @return The oldest queued frame, or null */
+    TSharedPtr<FJsonObject> Pop()
+    {
+        FScopeLock Lock(&QueueLock);
+        if (Queued.Num() == 0)
+        {
+            return nullptr;
+        }
+        TSharedRef<FJsonObject> Frame = Queued[0];
+        Queued.RemoveAt(0, EAllowShrinking::No);
+        return Frame;
+    }
+
+    /** Held while draining so only one task sends at a time */
+    FCriticalSection SendOrderLock;
+
+private:
+    FCriticalSection QueueLock;
+    TArray<TSharedRef<FJsonObject>, TInlineAllocator<4>> Queued;
+    bool bClosed = false;
+};
+
+FMCPClientConnection::FMCPClientConnection(UUnrealMCPBridge* InBridge, FSocket* InSocket, int32 InConnectionId, const FMCPServerConfig& InConfig)
+    : Bridge(InBridge)
+    , Socket(InSocket)
+    , ConnectionId(InConnectionId)
+    , Config(InConfig)
+    , Decoder(InConfig.MaxFrameBytes)
+    , InFlightRequests(0)
+    , InFlightDrained(FPlatformProcess::GetSynchEventFromPool(false))
+    , BytesReceived(0)
+    , FramesReceived(0)
+    , BytesSent(0)
+    , ResponsesSent(0)
+    , SendFailures(0)
+    , ConnectionStartTime(FPlatformTime::Seconds())
+    , LastSummaryTime(ConnectionStartTime)
+    , FramesAtLastSummary(0)
+    , bRunning(true)
+    , bFinished(false)
+{
+}
+
+FMCPClientConnection::~FMCPClientConnection()
+{
+    if (Socket)
+    {
+        Socket->Close();
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+        Socket = nullptr;
+    }
+
+    FPlatformProcess::ReturnSynchEventToPool(InFlightDrained);
+    InFlightDrained = nullptr;
+}
+
+bool FMCPClientConnection::Init()
+{
+    ConfigureSocket();
+    return true;
+}
+
+void FMCPClientConnection::ConfigureSocket()
+{
+    // Log client connection details
+    TSharedRef<FInternetAddr> ClientAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+    if (Socket->GetPeerAddress(*ClientAddr))
+    {
+        UE_LOG(LogMCPNetwork, Log, TEXT("[NET] Connection %d: Client connected from: %s"), ConnectionId, *ClientAddr->ToString(true));
+    }
+    else
+    {
+        UE_LOG(LogMCPNetwork, Warning, TEXT("[NET] Connection %d: Could not get client address"), ConnectionId);
+    }
+
+    // Set socket options to improve connection stability
+#if MCP_NETWORK_TRACE_LOGGING
+    bool bNoDelayResult = Socket->SetNoDelay(true);
+    UE_LOG_MCP_NETWORK_VERBOSE(TEXT("Connection %d: SetNoDelay result: %s"), ConnectionId, bNoDelayResult ? TEXT("Success") : TEXT("Failed"));
+#else
+    Socket->SetNoDelay(true);
+#endif
+
+    int32 ActualSendBufferSize = 0;
+    int32 ActualReceiveBufferSize = 0;
+
+    bool bSendBufferResult = Socket->SetSendBufferSize(Config.SocketBufferSize, ActualSendBufferSize);
+    bool bReceiveBufferResult = Socket->SetReceiveBufferSize(Config.SocketBufferSize, ActualReceiveBufferSize);
+
+    UE_LOG(LogMCPNetwork, Log, TEXT("[NET] Connection %d: Buffer setup - SendBuffer: %s (requested: %d, actual: %d), ReceiveBuffer: %s (requested: %d, actual: %d)"),
+           ConnectionId,
+           bSendBufferResult ? TEXT("Success") : TEXT("Failed"), Config.SocketBufferSize, ActualSendBufferSize,
+           bReceiveBufferResult ? TEXT("Success") : TEXT("Failed"), Config.SocketBufferSize, ActualReceiveBufferSize);
+
+    // Blocking reads; the receive loop waits for readability with a timeout so Stop() stays responsive
+#if MCP_NETWORK_TRACE_LOGGING
+    bool bBlockingResult = Socket->SetNonBlocking(false);
+    UE_LOG_MCP_NETWORK_VERBOSE(TEXT("Connection %d: SetNonBlocking(false) result: %s"), ConnectionId, bBlockingResult ? TEXT("Success") : TEXT("Failed"));
+#else
+    Socket->SetNonBlocking(false);
+#endif
+}
+
+uint32 FMCPClientConnection::Run()
+{
+    const FTimespan ReadWait = FTimespan::FromMilliseconds(Config.ReadWaitMs);
+
+    while (bRunning)
+    {
+        // Wait for readability so an idle client doesn't pin the thread inside Recv
+        const bool bReadable = Socket->Wait(ESocketWaitConditions::WaitForRead, ReadWait);
+
+        // Deadlines are enforced here rather than by the lanes, so a command stuck on a busy game thread still times out
+        CheckInFlightDeadlines();
+
+        if (Config.NetworkSummaryIntervalSec > 0 && FPlatformTime::Seconds() - LastSummaryTime >= Config.NetworkSummaryIntervalSec)
+        {
+            LogTrafficSummary(false);
+        }
+
+        if (!bReadable)
+        {
+            if (Socket->GetConnectionState() == SCS_ConnectionError)
+            {
+                UE_LOG(LogMCPNetwork, Warning, TEXT("[NET] Connection %d: Connection error while waiting for data"), ConnectionId);
+                break;
+            }
+            continue;
+        }
+
+        int32 BytesRead = 0;
+
+        // Size the read to whatever is already queued so a large frame arrives in as few reads as possible
+        uint32 PendingDataSize = 0;
+        Socket->HasPendingData(PendingDataSize);
+        const int32 ReadSize = FMath::Clamp<int32>(static_cast<int32>(PendingDataSize), Config.ReceiveChunkBytes, Config.MaxFrameBytes);
+
+        // Receive straight into the decoder's buffer, no intermediate copy
+        uint8* WritePtr = Decoder.PrepareWrite(ReadSize);
+        bool bRecvResult = Socket->Recv(WritePtr, ReadSize, BytesRead);
+
+        UE_LOG_MCP_NETWORK_VERBOSE(TEXT("Connection %d: Recv %s, %d bytes (%u pending)"),
+                                   ConnectionId, bRecvResult ? TEXT("ok") : TEXT("failed"), BytesRead, PendingDataSize);
+
+        if (bRecvResult)
+        {
+            if (BytesRead == 0)
+            {
+                UE_LOG(LogMCPNetwork, Log, TEXT("[NET] Connection %d: Client disconnected"), ConnectionId);
+                break;
+            }
+
+            FMCPWireTrace::Get().Record(ConnectionId, FMCPWireTrace::EDirection::Received, WritePtr, BytesRead);
+            BytesReceived += BytesRead;
+            Decoder.CommitWrite(BytesRead);
+
+            if (!DrainFrames())
+            {
+                break;
+            }
+        }
+        else
+        {
+            int32 LastError = (int32)ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+
+            // "Would block" and interrupted reads are transient, anything else ends the connection
+            if (LastError == SE_EWOULDBLOCK || LastError == SE_EINTR)
+            {
+                UE_LOG_MCP_NETWORK_VERBOSE(TEXT("Connection %d: Transient socket error %d, continuing..."), ConnectionId, LastError);
+                continue;
+            }
+
+            FString ErrorDescription;
+            switch (LastError)
+            {
+                case 0: ErrorDescription = TEXT("Graceful disconnection (no error)"); break;
+                case SE_ECONNRESET: ErrorDescription = TEXT("Connection reset by peer"); break;
+                case SE_ECONNABORTED: ErrorDescription = TEXT("Connection aborted"); break;
+                case SE_ENETDOWN: ErrorDescription = TEXT("Network is down"); break;
+                case SE_ENETUNREACH: ErrorDescription = TEXT("Network unreachable"); break;
+                case SE_ENOTCONN: ErrorDescription = TEXT("Socket not connected"); break;
+                case SE_ESHUTDOWN: ErrorDescription = TEXT("Socket shutdown"); break;
+                case SE_ETIMEDOUT: ErrorDescription = TEXT("Connection timed out"); break;
+                default: ErrorDescription = FString::Printf(TEXT("Unknown error code %d"), LastError); break;
+            }
+
+            UE_LOG(LogMCPNetwork, Log, TEXT("[NET] Connection %d: Client disconnected: %s"), ConnectionId, *ErrorDescription);
+            break;
+        }
+    }
+
+    LogTrafficSummary(true);
+
+    // The client is gone; commit what it modified on the next game thread tick
+    FAssetDirtySet::Get().RequestFlush();
+
+    bFinished = true;
+    return 0;
+}
+
+bool FMCPClientConnection::DrainFrames()
+{
+    FUtf8StringView Frame;
+    while (bRunning)
+    {
+        EMCPFrameResult Result = Decoder.NextFrame(Frame);
+        if (Result == EMCPFrameResult::NeedMoreData)
+        {
+            return true;
+        }
+
+        if (Result == EMCPFrameResult::Error)
+        {
+            // Framing is lost, there is no reliable way to find the next message boundary
+            UE_LOG(LogMCPNetwork, Error, TEXT("[NET] Connection %d: Framing error, closing connection: %s"), ConnectionId, *Decoder.GetLastError());
+            SendError(FString::Printf(TEXT("Protocol error: %s"), *Decoder.GetLastError()));
+            return false;
+        }
+
+        ++FramesReceived;
+        ProcessFrame(Frame);
+    }
+    return true;
+}
+
+void FMCPClientConnection::Stop()
+{
+    bRunning = false;
+
+    // Release a reader parked on a full pipeline
+    InFlightDrained->Trigger();
+}
+
+void FMCPClientConnection::Exit()
+{
+    bFinished = true;
+}
+
+void FMCPClientConnection::ProcessFrame(FUtf8StringView Frame)
+{
+    UE_LOG_MCP_NETWORK_VERBOSE(TEXT("Connection %d: Received %d byte frame"), ConnectionId, Frame.Len());
+
+    // Parse the frame in place from the receive buffer
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(Frame);
+
+    double ParseStartTime = FPlatformTime::Seconds();
+    bool bParseSuccess = FJsonSerializer::Deserialize(Reader, JsonObject);
+    double ParseDuration = FPlatformTime::Seconds() - ParseStartTime;
+
+    if (!bParseSuccess || !JsonObject.IsValid())
+    {
+        UE_LOG(LogMCPNetwork, Error, TEXT("[NET] Connection %d: Failed to parse JSON in %.3f seconds: %s"), ConnectionId, ParseDuration, *Reader->GetErrorMessage());
+        SendError(FString::Printf(TEXT("Invalid JSON: %s"), *Reader->GetErrorMessage()));
+        return;
+    }
+
+    // Optional request id; string or number, echoed back verbatim
+    TSharedPtr<FJsonValue> RequestId = JsonObject->TryGetField(TEXT("id"));
+    if (RequestId.IsValid() && RequestId->Type != EJson::String && RequestId->Type != EJson::Number)
+    {
+        SendError(TEXT("Request 'id' must be a string or a number"));
+        return;
+    }
+
+    UE_LOG_MCP_NETWORK_VERBOSE(TEXT("Connection %d: JSON parsed in %.3f ms"), ConnectionId, ParseDuration * 1000.0);
+
+    // Get command type
+    FString CommandType;
+    if (!JsonObject->TryGetStringField(TEXT("type"), CommandType))
+    {
+        UE_LOG(LogMCPNetwork, Warning, TEXT("[NET] Connection %d: Missing 'type' field in command JSON"), ConnectionId);
+
+        // Log available fields for debugging
+        TArray<FString> FieldNames;
+        JsonObject->Values.GetKeys(FieldNames);
+        FString FieldList = FString::Join(FieldNames, TEXT(", "));
+        UE_LOG(LogMCPNetwork, Warning, TEXT("[NET] Connection %d: Available fields: %s"), ConnectionId, *FieldList);
+
+        SendError(TEXT("Missing 'type' field in command JSON"), RequestId);
+        return;
+    }
+
+    // Parameters are optional
+    const TSharedPtr<FJsonObject>* ParamsPtr = nullptr;
+    TSharedPtr<FJsonObject> Params = JsonObject->TryGetObjectField(TEXT("params"), ParamsPtr) ? *ParamsPtr : MakeShared<FJsonObject>();
+
+    // Per-request deadline; 0 disables it for this request
+    double TimeoutMs = Config.CommandTimeoutMs;
+    if (JsonObject->HasField(TEXT("timeout_ms")) && (!JsonObject->TryGetNumberField(TEXT("timeout_ms"), TimeoutMs) || TimeoutMs < 0.0))
+    {
+        SendError(TEXT("'timeout_ms' must be a non-negative number"), RequestId);
+        return;
+    }
+    const double TimeoutSeconds = TimeoutMs / 1000.0;
+
+    if (CommandType == TEXT("handshake"))
+    {
+        HandleHandshake(Params, RequestId);
+        return;
+    }
+
+    if (CommandType == TEXT("cancel"))
+    {
+        HandleCancel(Params, RequestId);
+        return;
+    }
+
+    if (RequestId.IsValid())
+    {
+        DispatchPipelined(RequestId, CommandType, Params, TimeoutSeconds);
+        return;
+    }
+
+    // Execute command, timed only when network tracing is compiled in
+#if MCP_NETWORK_TRACE_LOGGING
+    double ExecuteStartTime = FPlatformTime::Seconds();
+#endif
+    TSharedRef<FJsonObject> Response = Bridge->ExecuteCommandJson(CommandType, Params, TimeoutSeconds);
+    UE_LOG_MCP_NETWORK_VERBOSE(TEXT("Connection %d: %s executed in %.3f ms"), ConnectionId, *CommandType, (FPlatformTime::Seconds() - ExecuteStartTime) * 1000.0);
+
+    SendJson(Response);
+}
+
+void FMCPClientConnection::DispatchPipelined(const TSharedPtr<FJsonValue>& RequestId, const FString& CommandType, const TSharedPtr<FJsonObject>& Params, double TimeoutSeconds)
+{
+    // Backpressure: stop reading new requests while the pipeline is full
+    while (bRunning && InFlightRequests.load() >= Config.MaxPipelinedRequests)
+    {
+        InFlightDrained->Wait(Config.ReadWaitMs);
+        CheckInFlightDeadlines();
+    }
+    if (!bRunning)
+    {
+        return;
+    }
+
+    // Ids must be unique among in-flight requests, otherwise cancel and responses would be ambiguous
+    const FString RequestKey = MakeRequestKey(RequestId);
+    {
+        FScopeLock Lock(&InFlightLock);
+        if (InFlightHandles.Contains(RequestKey))
+        {
+            SendError(FString::Printf(TEXT("Request id '%s' is already in flight"), *RequestId->AsString()), RequestId);
+            return;
+        }
+    }
+
+    ++InFlightRequests;
+    UE_LOG_MCP_NETWORK_VERBOSE(TEXT("Connection %d: Dispatching pipelined command %s (%d in flight)"),
+                               ConnectionId, *CommandType, InFlightRequests.load());
+
+    // Completions may outlive the connection, so they only hold a weak reference
+    TWeakPtr<FMCPClientConnection, ESPMode::ThreadSafe> WeakConnection = AsShared();
+    TSharedRef<FPipelinedOutbox, ESPMode::ThreadSafe> Outbox = MakeShared<FPipelinedOutbox, ESPMode::ThreadSafe>();
+
+    // Hold the lock across dispatch so a command that completes immediately can't remove its entry before it is added
+    FScopeLock Lock(&InFlightLock);
+    FMCPCommandHandleRef Handle = Bridge->ExecuteCommandAsync(CommandType, Params, [WeakConnection, RequestId, RequestKey, Outbox](const TSharedRef<FJsonObject>& Response)
+    {
+        Outbox->Push(Response, true);
+
+        // Serialize and send off the game thread so a slow client can't stall it
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakConnection, RequestId, RequestKey, Outbox]()
+        {
+            if (TSharedPtr<FMCPClientConnection, ESPMode::ThreadSafe> Connection = WeakConnection.Pin())
+            {
+                Connection->SendOutbox(*Outbox, RequestId);
+                Connection->OnPipelinedRequestCompleted(RequestKey);
+            }
+        });
+    }, TimeoutSeconds, [WeakConnection, RequestId, Outbox](const TSharedRef<FJsonObject>& Progress)
+    {
+        TSharedRef<FJsonObject> Frame = MakeShared<FJsonObject>();
+        Frame->SetStringField(TEXT("status"), TEXT("progress"));
+        Frame->SetObjectField(TEXT("result"), Progress);
+        if (!Outbox->Push(Frame, false))
+        {
+            return;
+        }
+
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakConnection, RequestId, Outbox]()
+        {
+            if (TSharedPtr<FMCPClientConnection, ESPMode::ThreadSafe> Connection = WeakConnection.Pin())
+            {
+                Connection->SendOutbox(*Outbox, RequestId);
+            }
+        });
+    });
+
+    if (!Handle->IsCompleted())
+    {
+        InFlightHandles.Add(RequestKey, Handle);
+    }
+}
+
+void FMCPClientConnection::OnPipelinedRequestCompleted(const FString& RequestKey)
+{
+    {
+        FScopeLock Lock(&InFlightLock);
+        InFlightHandles.Remove(RequestKey);
+    }
+
+    --InFlightRequests;
+    InFlightDrained->Trigger();
+}
+
+void FMCPClientConnection::SendOutbox(FPipelinedOutbox& Outbox, const TSharedPtr<FJsonValue>& RequestId)
+{
+    FScopeLock Lock(&Outbox.SendOrderLock);
+    while (TSharedPtr<FJsonObject> Frame = Outbox.Pop())
+    {
+        SendJson(Frame.ToSharedRef(), RequestId);
+    }
+}
+
+void FMCPClientConnection::CheckInFlightDeadlines()
+{
+    // Complete outside the lock; the completion itself takes InFlightLock later on another thread
+    TArray<FMCPCommandHandleRef, TInlineAllocator<16>> Handles;
+    {
+        FScopeLock Lock(&InFlightLock);
+        for (const TPair<FString, FMCPCommandHandleRef>& Entry : InFlightHandles)
+        {
+            Handles.Add(Entry.Value);
+        }
+    }
+
+    for (const FMCPCommandHandleRef& Handle : Handles)
+    {
+        Handle->CheckDeadline();
+    }
+}
+
+FString FMCPClientConnection::MakeRequestKey(const TSharedPtr<FJsonValue>& RequestId)
+{
+    return FString::Printf(TEXT("%s:%s"), RequestId->Type == EJson::String ? TEXT("s") : TEXT("n"), *RequestId->AsString());
+}
+
+void FMCPClientConnection::HandleCancel(const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonValue>& RequestId)
+{
+    TSharedPtr<FJsonValue> TargetId = Params->TryGetField(TEXT("id"));
+    if (!TargetId.IsValid() || (TargetId->Type != EJson::String && TargetId->Type != EJson::Number))
+    {
+        SendError(TEXT("cancel requires 'id' of the request to cancel"), RequestId);
+        return;
+    }
+
+    TSharedPtr<FMCPCommandHandle, ESPMode::ThreadSafe> Handle;
+    {
+        FScopeLock Lock(&InFlightLock);
+        if (const FMCPCommandHandleRef* Found = InFlightHandles.Find(MakeRequestKey(TargetId)))
+        {
+            Handle = *Found;
+        }
+    }
+
+    // The cancelled request gets its own "cancelled" error response through its completion
+    const bool bCancelled = Handle.IsValid() && Handle->Cancel();
+
+    UE_LOG(LogMCPNetwork, Log, TEXT("[NET] Connection %d: Cancel request for id %s: %s"),
+           ConnectionId, *TargetId->AsString(), bCancelled ? TEXT("cancelled") : TEXT("not in flight"));
+
+    TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("cancelled"), bCancelled);
+    Result->SetField(TEXT("id"), TargetId);
+
+    TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetStringField(TEXT("status"), TEXT("success"));
+    Response->SetObjectField(TEXT("result"), Result);
+    SendJson(Response, RequestId);
+}
+
+void FMCPClientConnection::HandleHandshake(const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonValue>& RequestId)
+{
+    FString RequestedFraming;
+    Params->TryGetStringField(TEXT("framing"), RequestedFraming);
+
+    EMCPFramingMode NewMode = Decoder.GetMode();
+    if (!RequestedFraming.IsEmpty() && !FMCPFrameDecoder::ModeFromString(RequestedFraming, NewMode))
+    {
+        SendError(FString::Printf(TEXT("Unsupported framing '%s'; expected json, newline or length_prefixed"), *RequestedFraming), RequestId);
+        return;
+    }
+
+    TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("framing"), FMCPFrameDecoder::ModeToString(NewMode));
+    Result->SetNumberField(TEXT("max_frame_bytes"), Config.MaxFrameBytes);
+
+    TArray<TSharedPtr<FJsonValue>> SupportedFramings;
+    SupportedFramings.Add(MakeShared<FJsonValueString>(FMCPFrameDecoder::ModeToString(EMCPFramingMode::Json)));
+    SupportedFramings.Add(MakeShared<FJsonValueString>(FMCPFrameDecoder::ModeToString(EMCPFramingMode::NewlineDelimited)));
+    SupportedFramings.Add(MakeShared<FJsonValueString>(FMCPFrameDecoder::ModeToString(EMCPFramingMode::LengthPrefixed)));
+    Result->SetArrayField(TEXT("supported_framings"), SupportedFramings);
+
+    TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetStringField(TEXT("status"), TEXT("success"));
+    Response->SetObjectField(TEXT("result"), Result);
+
+    // The acknowledgement still uses the old framing; everything after it uses the new one.
+    // Hold the send lock so no pipelined response slips in between the two.
+    {
+        FScopeLock Lock(&SendLock);
+        SendJson(Response, RequestId);
+        Decoder.SetMode(NewMode);
+    }
+
+    UE_LOG(LogMCPNetwork, Log, TEXT("[NET] Connection %d: Negotiated %s framing"), ConnectionId, FMCPFrameDecoder::ModeToString(NewMode));
+}
+
+void FMCPClientConnection::SendJson(const TSharedRef<FJsonObject>& Response, const TSharedPtr<FJsonValue>& RequestId)
+{
+    if (RequestId.IsValid())
+    {
+        Response->SetField(TEXT("id"), RequestId);
+    }
+
+    // Pipelined completions send from worker threads; one frame is staged and sent at a time
+    FScopeLock Lock(&SendLock);
+    if (!bRunning || !Socket)
+    {
+        return;
+    }
+
+    FMCPFrameEncoder::EncodeJson(Response, Decoder.GetMode(), SendBuffer);
+    SendStagedFrame();
+}
+
+void FMCPClientConnection::SendError(const FString& ErrorMessage, const TSharedPtr<FJsonValue>& RequestId)
+{
+    TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetStringField(TEXT("status"), TEXT("error"));
+    Response->SetStringField(TEXT("error"), ErrorMessage);
+    SendJson(Response, RequestId);
+}
+
+void FMCPClientConnection::SendStagedFrame()
+{
+    FMCPWireTrace::Get().Record(ConnectionId, FMCPWireTrace::EDirection::Sent, SendBuffer.GetData(), SendBuffer.Num());
+
+    double SendStartTime = FPlatformTime::Seconds();
+    bool bSendSuccess = SendAll(SendBuffer.GetData(), SendBuffer.Num());
+    double SendDuration = FPlatformTime::Seconds() - SendStartTime;
+
+    if (!bSendSuccess)
+    {
+        ++SendFailures;
+        int32 SendErrorCode = (int32)ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+        UE_LOG(LogMCPNetwork, Error, TEXT("[NET] Connection %d: Failed to send response. Error: %d, Duration: %.3f seconds"), ConnectionId, SendErrorCode, SendDuration);
+    }
+    else
+    {
+        ++ResponsesSent;
+        BytesSent += SendBuffer.Num();
+        UE_LOG_MCP_NETWORK_VERBOSE(TEXT("Connection %d: Sent %d bytes in %.3f ms"), ConnectionId, SendBuffer.Num(), SendDuration * 1000.0);
+    }
+
+    // Keep the allocation for typical responses, but don't pin one huge response's worth of memory per idle connection
+    if (SendBuffer.Max() > MaxRetainedSendBufferBytes)
+    {
+        SendBuffer.Empty();
+    }
+}
+
+void FMCPClientConnection::LogTrafficSummary(bool bClosing)
+{
+    const double Now = FPlatformTime::Seconds();
+    const int64 Frames = FramesReceived.load();
+
+    // Idle connections stay quiet between summaries
+    if (bClosing || Frames != FramesAtLastSummary)
+    {
+        UE_LOG(LogMCPNetwork, Log, TEXT("[NET] Connection %d %s: %lld requests in %.1f s (%lld in last %.1f s), %lld bytes in, %lld responses / %lld bytes out, %lld send failures, %d in flight"),
+               ConnectionId, bClosing ? TEXT("closed") : TEXT("summary"),
+               Frames, Now - ConnectionStartTime, Frames - FramesAtLastSummary, Now - LastSummaryTime,
+               BytesReceived.load(), ResponsesSent.load(), BytesSent.load(), SendFailures.load(), InFlightRequests.load());
+    }
+
+    LastSummaryTime = Now;
+    FramesAtLastSummary = Frames;
+}
+
+bool FMCPClientConnection::SendAll(const uint8* Data, int32 Length)
+{
+    // Hand the kernel at most one socket buffer per call so a large response drains as the client reads it
+    const int32 ChunkBytes = FMath::Max(Config.SocketBufferSize, 4096);
+
+    int32 TotalSent = 0;
+    while (TotalSent < Length)
+    {
+        int32 ChunkSent = 0;
+        if (!Socket->Send(Data + TotalSent, FMath::Min(Length - TotalSent, ChunkBytes), ChunkSent))
+        {
+            const ESocketErrors LastError = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+            if (LastError != SE_EWOULDBLOCK && LastError != SE_EINTR)
+            {
+                return false;
+            }
+            Socket->Wait(ESocketWaitConditions::WaitForWrite, FTimespan::FromMilliseconds(Config.ReadWaitMs));
+            continue;
+        }
+        TotalSent += ChunkSent;
+    }
+    return true;
+}
@@ -0,0 +1,126 @@
+#include "MCPCommandHandle.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    /** Handle of the command executing on this thread, if any */
+    thread_local const FMCPCommandHandle* CurrentHandle = nullptr;
+}
+
+FMCPCommandHandle::FMCPCommandHandle(const FString& InCommandType, double InTimeoutSeconds, FMCPCommandCompletion InOnComplete, FMCPCommandProgress InOnProgress)
+    : CommandType(InCommandType)
+    , TimeoutSeconds(InTimeoutSeconds)
+    , Deadline(InTimeoutSeconds > 0.0 ? FPlatformTime::Seconds() + InTimeoutSeconds : 0.0)
+    , OnComplete(MoveTemp(InOnComplete))
+    , OnProgress(MoveTemp(InOnProgress))
+    , bCompleted(false)
+    , bCancellationRequested(false)
+{
+}
+
+bool FMCPCommandHandle::Complete(const TSharedRef<FJsonObject>& Response)
+{
+    if (bCompleted.exchange(true))
+    {
+        return false;
+    }
+
+    OnComplete(Response);
+    return true;
+}
+
+bool FMCPCommandHandle::Cancel()
+{
+    bCancellationRequested = true;
+    return Complete(MakeErrorResponse(TEXT("cancelled"), FString::Printf(TEXT("Command '%s' was cancelled"), *CommandType)));
+}
+
+bool FMCPCommandHandle::CheckDeadline()
+{
+    if (Deadline <= 0.0 || IsCompleted() || FPlatformTime::Seconds() < Deadline)
+    {
+        return false;
+    }
+
+    bCancellationRequested = true;
+
+    TSharedRef<FJsonObject> Response = MakeErrorResponse(TEXT("timeout"),
+        FString::Printf(TEXT("Command '%s' timed out after %.0f ms"), *CommandType, TimeoutSeconds * 1000.0));
+    Response->SetNumberField(TEXT("timeout_ms"), TimeoutSeconds * 1000.0);
+
+    if (Complete(Response))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPCommandHandle: Command '%s' timed out after %.0f ms"), *CommandType, TimeoutSeconds * 1000.0);
+        return true;
+    }
+    return false;
+}
+
+double FMCPCommandHandle::GetRemainingSeconds() const
+{
+    if (Deadline <= 0.0)
+    {
+        return -1.0;
+    }
+    return FMath::Max(0.0, Deadline - FPlatformTime::Seconds());
+}
+
+bool FMCPCommandHandle::IsCurrentCancelled()
+{
+    if (!CurrentHandle)
+    {
+        return false;
+    }
+
+    // A command that overruns its deadline sees the cancellation even before the server has noticed
+    return CurrentHandle->IsCancellationRequested()
+        || (CurrentHandle->Deadline > 0.0 && FPlatformTime::Seconds() >= CurrentHandle->Deadline);
+}
+
+const FMCPCommandHandle* FMCPCommandHandle::GetCurrent()
+{
+    return CurrentHandle;
+}
+
+bool FMCPCommandHandle::ReportProgress(const TSharedRef<FJsonObject>& Progress) const
+{
+    if (!WantsProgress())
+    {
+        return false;
+    }
+
+    OnProgress(Progress);
+    return true;
+}
+
+bool FMCPCommandHandle::WantsCurrentProgress()
+{
+    return CurrentHandle && CurrentHandle->WantsProgress();
+}
+
+bool FMCPCommandHandle::ReportCurrentProgress(const TSharedRef<FJsonObject>& Progress)
+{
+    return CurrentHandle && CurrentHandle->ReportProgress(Progress);
+}
+
+TSharedRef<FJsonObject> FMCPCommandHandle::MakeErrorResponse(const FString& ErrorType, const FString& Message) const
+{
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+    ResponseJson->SetStringField(TEXT("error"), Message);
+    ResponseJson->SetStringField(TEXT("error_type"), ErrorType);
+    ResponseJson->SetStringField(TEXT("command"), CommandType);
+    return ResponseJson;
+}
+
+FMCPCommandHandle::FExecutionScope::FExecutionScope(const FMCPCommandHandle& Handle)
+    : PreviousHandle(CurrentHandle)
+{
+    CurrentHandle = &Handle;
+}
+
+FMCPCommandHandle::FExecutionScope::~FExecutionScope()
+{
+    CurrentHandle = PreviousHandle;
+}
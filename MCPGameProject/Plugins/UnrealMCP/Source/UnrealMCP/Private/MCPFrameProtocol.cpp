@@ -0,0 +1,347 @@
+#include "MCPFrameProtocol.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+namespace
+{
+    /** Initial receive buffer capacity; grows on demand for large frames */
+    constexpr int32 InitialBufferCapacity = 16 * 1024;
+
+    FORCEINLINE bool IsJsonWhitespace(uint8 Char)
+    {
+        return Char == ' ' || Char == '\t' || Char == '\r' || Char == '\n';
+    }
+}
+
+FMCPFrameDecoder::FMCPFrameDecoder(int32 InMaxFrameBytes)
+    : ReadOffset(0)
+    , WriteOffset(0)
+    , MaxFrameBytes(InMaxFrameBytes)
+    , Mode(EMCPFramingMode::Json)
+    , ScanOffset(0)
+    , JsonStart(INDEX_NONE)
+    , JsonDepth(0)
+    , bInString(false)
+    , bEscape(false)
+{
+    Buffer.SetNumUninitialized(InitialBufferCapacity);
+}
+
+void FMCPFrameDecoder::SetMode(EMCPFramingMode InMode)
+{
+    Mode = InMode;
+
+    // Any partially scanned JSON/line state belongs to the previous mode
+    ScanOffset = ReadOffset;
+    JsonStart = INDEX_NONE;
+    JsonDepth = 0;
+    bInString = false;
+    bEscape = false;
+}
+
+uint8* FMCPFrameDecoder::PrepareWrite(int32 MinBytes)
+{
+    if (ReadOffset == WriteOffset)
+    {
+        // Everything has been consumed, start over at the front without moving anything
+        ReadOffset = WriteOffset = ScanOffset = 0;
+        JsonStart = INDEX_NONE;
+    }
+    else if (Buffer.Num() - WriteOffset < MinBytes && ReadOffset > 0)
+    {
+        // Slide the unconsumed tail (at most one partial frame) to the front
+        const int32 Remaining = WriteOffset - ReadOffset;
+        FMemory::Memmove(Buffer.GetData(), Buffer.GetData() + ReadOffset, Remaining);
+        ScanOffset -= ReadOffset;
+        if (JsonStart != INDEX_NONE)
+        {
+            JsonStart -= ReadOffset;
+        }
+        ReadOffset = 0;
+        WriteOffset = Remaining;
+    }
+
+    if (Buffer.Num() - WriteOffset < MinBytes)
+    {
+        // Grow geometrically so reassembling a large frame is amortized O(n)
+        const int32 Required = WriteOffset + MinBytes;
+        Buffer.SetNumUninitialized(FMath::Max(Required, Buffer.Num() * 2));
+    }
+
+    return Buffer.GetData() + WriteOffset;
+}
+
+void FMCPFrameDecoder::CommitWrite(int32 BytesWritten)
+{
+    check(BytesWritten >= 0 && WriteOffset + BytesWritten <= Buffer.Num());
+    WriteOffset += BytesWritten;
+}
+
+EMCPFrameResult FMCPFrameDecoder::NextFrame(FUtf8StringView& OutFrame)
+{
+    switch (Mode)
+    {
+        case EMCPFramingMode::LengthPrefixed:
+            return NextLengthPrefixedFrame(OutFrame);
+        case EMCPFramingMode::NewlineDelimited:
+            return NextLineFrame(OutFrame);
+        case EMCPFramingMode::Json:
+        default:
+            return NextJsonFrame(OutFrame);
+    }
+}
+
+void FMCPFrameDecoder::Reset()
+{
+    ReadOffset = WriteOffset = 0;
+    SetMode(Mode);
+}
+
+EMCPFrameResult FMCPFrameDecoder::NextJsonFrame(FUtf8StringView& OutFrame)
+{
+    const uint8* Data = Buffer.GetData();
+
+    for (; ScanOffset < WriteOffset; ++ScanOffset)
+    {
+        const uint8 Char = Data[ScanOffset];
+
+        if (JsonStart == INDEX_NONE)
+        {
+            // Between documents: skip separators, anything else must open an object or array
+            if (IsJsonWhitespace(Char))
+            {
+                ReadOffset = ScanOffset + 1;
+                continue;
+            }
+            if (Char != '{' && Char != '[')
+            {
+                return Fail(FString::Printf(TEXT("Unexpected character '%c' between JSON messages"), (TCHAR)Char));
+            }
+            JsonStart = ScanOffset;
+            JsonDepth = 1;
+            continue;
+        }
+
+        if (bInString)
+        {
+            if (bEscape)
+            {
+                bEscape = false;
+            }
+            else if (Char == '\\')
+            {
+                bEscape = true;
+            }
+            else if (Char == '"')
+            {
+                bInString = false;
+            }
+            continue;
+        }
+
+        switch (Char)
+        {
+            case '"':
+                bInString = true;
+                break;
+            case '{':
+            case '[':
+                ++JsonDepth;
+                break;
+            case '}':
+            case ']':
+                if (--JsonDepth == 0)
+                {
+                    const int32 FrameStart = JsonStart;
+                    const int32 FrameEnd = ScanOffset + 1;
+                    JsonStart = INDEX_NONE;
+                    OutFrame = TakeFrame(FrameStart, FrameEnd, FrameEnd);
+                    return EMCPFrameResult::Frame;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (JsonStart != INDEX_NONE && WriteOffset - JsonStart > MaxFrameBytes)
+    {
+        return Fail(FString::Printf(TEXT("JSON message exceeds maximum frame size of %d bytes"), MaxFrameBytes));
+    }
+
+    return EMCPFrameResult::NeedMoreData;
+}
+
+EMCPFrameResult FMCPFrameDecoder::NextLineFrame(FUtf8StringView& OutFrame)
+{
+    const uint8* Data = Buffer.GetData();
+
+    while (ScanOffset < WriteOffset)
+    {
+        int32 LineEnd = ScanOffset;
+        while (LineEnd < WriteOffset && Data[LineEnd] != '\n')
+        {
+            ++LineEnd;
+        }
+
+        if (LineEnd == WriteOffset)
+        {
+            ScanOffset = WriteOffset;
+            break;
+        }
+
+        int32 FrameEnd = LineEnd;
+        if (FrameEnd > ReadOffset && Buffer[FrameEnd - 1] == '\r')
+        {
+            --FrameEnd;
+        }
+
+        if (FrameEnd == ReadOffset)
+        {
+            // Blank keep-alive line
+            ReadOffset = ScanOffset = LineEnd + 1;
+            continue;
+        }
+
+        OutFrame = TakeFrame(ReadOffset, FrameEnd, LineEnd + 1);
+        return EMCPFrameResult::Frame;
+    }
+
+    if (WriteOffset - ReadOffset > MaxFrameBytes)
+    {
+        return Fail(FString::Printf(TEXT("Line exceeds maximum frame size of %d bytes"), MaxFrameBytes));
+    }
+
+    return EMCPFrameResult::NeedMoreData;
+}
+
+EMCPFrameResult FMCPFrameDecoder::NextLengthPrefixedFrame(FUtf8StringView& OutFrame)
+{
+    if (WriteOffset - ReadOffset < LengthPrefixSize)
+    {
+        return EMCPFrameResult::NeedMoreData;
+    }
+
+    const uint8* Prefix = Buffer.GetData() + ReadOffset;
+    const uint32 PayloadBytes = (uint32(Prefix[0]) << 24) | (uint32(Prefix[1]) << 16) | (uint32(Prefix[2]) << 8) | uint32(Prefix[3]);
+
+    if (PayloadBytes > static_cast<uint32>(MaxFrameBytes))
+    {
+        return Fail(FString::Printf(TEXT("Frame of %u bytes exceeds maximum frame size of %d bytes"), PayloadBytes, MaxFrameBytes));
+    }
+
+    const int32 FrameStart = ReadOffset + LengthPrefixSize;
+    const int32 FrameEnd = FrameStart + static_cast<int32>(PayloadBytes);
+    if (FrameEnd > WriteOffset)
+    {
+        return EMCPFrameResult::NeedMoreData;
+    }
+
+    OutFrame = TakeFrame(FrameStart, FrameEnd, FrameEnd);
+    return EMCPFrameResult::Frame;
+}
+
+FUtf8StringView FMCPFrameDecoder::TakeFrame(int32 FrameStart, int32 FrameEnd, int32 ConsumedEnd)
+{
+    ReadOffset = ConsumedEnd;
+    ScanOffset = ConsumedEnd;
+    return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Buffer.GetData() + FrameStart), FrameEnd - FrameStart);
+}
+
+EMCPFrameResult FMCPFrameDecoder::Fail(const FString& Error)
+{
+    LastError = Error;
+    return EMCPFrameResult::Error;
+}
+
+void FMCPFrameDecoder::EncodeLengthPrefix(uint32 PayloadBytes, uint8* OutPrefix)
+{
+    OutPrefix[0] = static_cast<uint8>((PayloadBytes >> 24) & 0xFF);
+    OutPrefix[1] = static_cast<uint8>((PayloadBytes >> 16) & 0xFF);
+    OutPrefix[2] = static_cast<uint8>((PayloadBytes >> 8) & 0xFF);
+    OutPrefix[3] = static_cast<uint8>(PayloadBytes & 0xFF);
+}
+
+const TCHAR* FMCPFrameDecoder::ModeToString(EMCPFramingMode InMode)
+{
+    switch (InMode)
+    {
+        case EMCPFramingMode::NewlineDelimited: return TEXT("newline");
+        case EMCPFramingMode::LengthPrefixed: return TEXT("length_prefixed");
+        case EMCPFramingMode::Json:
+        default: return TEXT("json");
+    }
+}
+
+bool FMCPFrameDecoder::ModeFromString(const FString& Name, EMCPFramingMode& OutMode)
+{
+    if (Name.Equals(TEXT("length_prefixed")))
+    {
+        OutMode = EMCPFramingMode::LengthPrefixed;
+        return true;
+    }
+    if (Name.Equals(TEXT("newline")))
+    {
+        OutMode = EMCPFramingMode::NewlineDelimited;
+        return true;
+    }
+    if (Name.Equals(TEXT("json")))
+    {
+        OutMode = EMCPFramingMode::Json;
+        return true;
+    }
+    return false;
+}
+
+int32 FMCPFrameEncoder::EncodeJson(const TSharedRef<FJsonObject>& Payload, EMCPFramingMode Mode, TArray<uint8>& OutFrame)
+{
+    typedef TCondensedJsonPrintPolicy<UTF8CHAR> FUtf8PrintPolicy;
+
+    BeginFrame(Mode, OutFrame);
+    {
+        // Append after the prefix placeholder; the writer converts each string to UTF-8 as it goes
+        FMemoryWriter Archive(OutFrame, false, true);
+        TSharedRef<TJsonWriter<UTF8CHAR, FUtf8PrintPolicy>> Writer = TJsonWriterFactory<UTF8CHAR, FUtf8PrintPolicy>::Create(&Archive);
+        FJsonSerializer::Serialize(Payload, Writer);
+    }
+    return EndFrame(Mode, OutFrame);
+}
+
+int32 FMCPFrameEncoder::EncodeString(FStringView Payload, EMCPFramingMode Mode, TArray<uint8>& OutFrame)
+{
+    BeginFrame(Mode, OutFrame);
+    {
+        const auto Utf8Payload = StringCast<UTF8CHAR>(Payload.GetData(), Payload.Len());
+        OutFrame.Append(reinterpret_cast<const uint8*>(Utf8Payload.Get()), Utf8Payload.Length());
+    }
+    return EndFrame(Mode, OutFrame);
+}
+
+void FMCPFrameEncoder::BeginFrame(EMCPFramingMode Mode, TArray<uint8>& OutFrame)
+{
+    OutFrame.Reset();
+    if (Mode == EMCPFramingMode::LengthPrefixed)
+    {
+        OutFrame.AddUninitialized(FMCPFrameDecoder::LengthPrefixSize);
+    }
+}
+
+int32 FMCPFrameEncoder::EndFrame(EMCPFramingMode Mode, TArray<uint8>& OutFrame)
+{
+    if (Mode == EMCPFramingMode::LengthPrefixed)
+    {
+        const int32 PayloadBytes = OutFrame.Num() - FMCPFrameDecoder::LengthPrefixSize;
+        FMCPFrameDecoder::EncodeLengthPrefix(static_cast<uint32>(PayloadBytes), OutFrame.GetData());
+        return PayloadBytes;
+    }
+
+    const int32 PayloadBytes = OutFrame.Num();
+    if (Mode == EMCPFramingMode::NewlineDelimited)
+    {
+        OutFrame.Add('\n');
+    }
+    return PayloadBytes;
+}
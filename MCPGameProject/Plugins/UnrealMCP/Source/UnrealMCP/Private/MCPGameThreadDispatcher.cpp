@@ -0,0 +1,206 @@
+#include "MCPGameThreadDispatcher.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+TRACE_DECLARE_INT_COUNTER(MCPGameThreadQueueDepth, TEXT("UnrealMCP/GameThread/QueueDepth"));
+TRACE_DECLARE_INT_COUNTER(MCPGameThreadDrainedPerTick, TEXT("UnrealMCP/GameThread/DrainedPerTick"));
+TRACE_DECLARE_INT_COUNTER(MCPGameThreadBudgetOverruns, TEXT("UnrealMCP/GameThread/BudgetOverruns"));
+
+TSharedRef<FJsonObject> FMCPGameThreadDispatcherStats::ToJson() const
+{
+    TSharedRef<FJsonObject> StatsJson = MakeShared<FJsonObject>();
+    StatsJson->SetNumberField(TEXT("queue_depth"), QueueDepth);
+    StatsJson->SetNumberField(TEXT("last_drained_per_tick"), LastDrainedPerTick);
+    StatsJson->SetNumberField(TEXT("peak_drained_per_tick"), PeakDrainedPerTick);
+    StatsJson->SetNumberField(TEXT("total_drained"), static_cast<double>(TotalDrained));
+    StatsJson->SetNumberField(TEXT("budget_overruns"), static_cast<double>(BudgetOverruns));
+    StatsJson->SetNumberField(TEXT("skipped_cancelled"), static_cast<double>(SkippedCancelled));
+    return StatsJson;
+}
+
+FMCPGameThreadDispatcher::FMCPGameThreadDispatcher(FMCPCommandExecutor InExecutor, float InFrameBudgetMs)
+    : Executor(MoveTemp(InExecutor))
+    , FrameBudgetSeconds(InFrameBudgetMs / 1000.0)
+    , bAccepting(false)
+    , QueueDepth(0)
+    , LastDrainedPerTick(0)
+    , PeakDrainedPerTick(0)
+    , TotalDrained(0)
+    , BudgetOverruns(0)
+    , SkippedCancelled(0)
+{
+}
+
+FMCPGameThreadDispatcher::~FMCPGameThreadDispatcher()
+{
+    Shutdown();
+}
+
+void FMCPGameThreadDispatcher::Start()
+{
+    check(IsInGameThread());
+
+    FWriteScopeLock Lock(AcceptLock);
+    if (bAccepting)
+    {
+        return;
+    }
+
+    bAccepting = true;
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMCPGameThreadDispatcher::Tick), 0.0f);
+
+    UE_LOG(LogTemp, Display, TEXT("MCPGameThreadDispatcher: Started with %.2f ms frame budget"), FrameBudgetSeconds * 1000.0);
+}
+
+void FMCPGameThreadDispatcher::Shutdown()
+{
+    {
+        FWriteScopeLock Lock(AcceptLock);
+        if (!bAccepting)
+        {
+            return;
+        }
+        bAccepting = false;
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+
+    // Nothing can be enqueued anymore; release anyone still waiting on a queued command
+    int32 FailedCount = 0;
+    FQueuedCommand Command;
+    while (PendingCommands.Dequeue(Command))
+    {
+        --QueueDepth;
+        ++FailedCount;
+        if (Command.WorkDone.IsValid())
+        {
+            Command.WorkDone->SetValue(false);
+        }
+        else
+        {
+            Command.Handle->Complete(MakeShutdownResponse());
+        }
+    }
+
+    if (FailedCount > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPGameThreadDispatcher: Shut down with %d queued commands; they were answered with an error"), FailedCount);
+    }
+}
+
+void FMCPGameThreadDispatcher::Enqueue(const FMCPCommandHandleRef& Handle, const TSharedPtr<FJsonObject>& Params)
+{
+    {
+        FReadScopeLock Lock(AcceptLock);
+        if (bAccepting)
+        {
+            ++QueueDepth;
+            PendingCommands.Enqueue(FQueuedCommand{ Handle, Params });
+            return;
+        }
+    }
+
+    Handle->Complete(MakeShutdownResponse());
+}
+
+TFuture<bool> FMCPGameThreadDispatcher::EnqueueWork(TFunction<void()> Work)
+{
+    TSharedPtr<TPromise<bool>, ESPMode::ThreadSafe> WorkDone = MakeShared<TPromise<bool>, ESPMode::ThreadSafe>();
+    TFuture<bool> Future = WorkDone->GetFuture();
+    {
+        FReadScopeLock Lock(AcceptLock);
+        if (bAccepting)
+        {
+            FQueuedCommand Command;
+            Command.Work = MoveTemp(Work);
+            Command.WorkDone = WorkDone;
+            ++QueueDepth;
+            PendingCommands.Enqueue(MoveTemp(Command));
+            return Future;
+        }
+    }
+
+    WorkDone->SetValue(false);
+    return Future;
+}
+
+FMCPGameThreadDispatcherStats FMCPGameThreadDispatcher::GetStats() const
+{
+    FMCPGameThreadDispatcherStats Stats;
+    Stats.QueueDepth = QueueDepth.load();
+    Stats.LastDrainedPerTick = LastDrainedPerTick.load();
+    Stats.PeakDrainedPerTick = PeakDrainedPerTick.load();
+    Stats.TotalDrained = TotalDrained.load();
+    Stats.BudgetOverruns = BudgetOverruns.load();
+    Stats.SkippedCancelled = SkippedCancelled.load();
+    return Stats;
+}
+
+bool FMCPGameThreadDispatcher::Tick(float DeltaTime)
+{
+    if (PendingCommands.IsEmpty())
+    {
+        return true;
+    }
+
+    const double TickStart = FPlatformTime::Seconds();
+    double Elapsed = 0.0;
+    int32 Drained = 0;
+
+    FQueuedCommand Command;
+    while (Elapsed < FrameBudgetSeconds && PendingCommands.Dequeue(Command))
+    {
+        --QueueDepth;
+
+        if (Command.WorkDone.IsValid())
+        {
+            Command.Work();
+            Command.WorkDone->SetValue(true);
+        }
+        else
+        {
+            // Don't start work nobody is waiting for anymore
+            Command.Handle->CheckDeadline();
+            if (Command.Handle->IsCancellationRequested())
+            {
+                ++SkippedCancelled;
+                continue;
+            }
+
+            FMCPCommandHandle::FExecutionScope ExecutionScope(*Command.Handle);
+            Command.Handle->Complete(Executor(Command.Handle->GetCommandType(), Command.Params));
+        }
+        ++Drained;
+        Elapsed = FPlatformTime::Seconds() - TickStart;
+    }
+
+    TotalDrained += Drained;
+    LastDrainedPerTick = Drained;
+    if (Drained > PeakDrainedPerTick.load())
+    {
+        PeakDrainedPerTick = Drained;
+    }
+
+    if (Elapsed > FrameBudgetSeconds)
+    {
+        ++BudgetOverruns;
+        UE_LOG(LogTemp, Verbose, TEXT("MCPGameThreadDispatcher: Tick took %.2f ms for %d commands (budget %.2f ms), %d still queued"),
+               Elapsed * 1000.0, Drained, FrameBudgetSeconds * 1000.0, QueueDepth.load());
+    }
+
+    TRACE_COUNTER_SET(MCPGameThreadQueueDepth, QueueDepth.load());
+    TRACE_COUNTER_SET(MCPGameThreadDrainedPerTick, Drained);
+    TRACE_COUNTER_SET(MCPGameThreadBudgetOverruns, BudgetOverruns.load());
+
+    return true;
+}
+
+TSharedRef<FJsonObject> FMCPGameThreadDispatcher::MakeShutdownResponse()
+{
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+    ResponseJson->SetStringField(TEXT("error"), TEXT("MCP server is shutting down"));
+    return ResponseJson;
+}
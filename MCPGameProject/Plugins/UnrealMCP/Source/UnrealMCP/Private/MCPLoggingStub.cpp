@@ -1,8 +1,9 @@
 #include "MCPLogging.h"
 #include "MCPParameterValidator.h"
 
-// Define the log category
+// Define the log categories
 DEFINE_LOG_CATEGORY(LogUnrealMCP);
+DEFINE_LOG_CATEGORY(LogMCPNetwork);
 
 // Stub implementations for FMCPLogger
 void FMCPLogger::Initialize(bool bEnableDebugLogging, const FString& LogFilePath)
@@ -0,0 +1,47 @@
+#include "MCPServerConfig.h"
+#include "Misc/ConfigCacheIni.h"
+
+namespace
+{
+    const TCHAR* MCPServerConfigSection = TEXT("UnrealMCP.Server");
+}
+
+FMCPServerConfig FMCPServerConfig::Load()
+{
+    FMCPServerConfig Config;
+
+    if (GConfig)
+    {
+        GConfig->GetInt(MCPServerConfigSection, TEXT("MaxConnections"), Config.MaxConnections, GEditorIni);
+        GConfig->GetInt(MCPServerConfigSection, TEXT("AcceptWaitMs"), Config.AcceptWaitMs, GEditorIni);
+        GConfig->GetInt(MCPServerConfigSection, TEXT("ReadWaitMs"), Config.ReadWaitMs, GEditorIni);
+        GConfig->GetInt(MCPServerConfigSection, TEXT("SocketBufferSize"), Config.SocketBufferSize, GEditorIni);
+        GConfig->GetInt(MCPServerConfigSection, TEXT("MaxFrameBytes"), Config.MaxFrameBytes, GEditorIni);
+        GConfig->GetInt(MCPServerConfigSection, TEXT("ReceiveChunkBytes"), Config.ReceiveChunkBytes, GEditorIni);
+        GConfig->GetInt(MCPServerConfigSection, TEXT("MaxPipelinedRequests"), Config.MaxPipelinedRequests, GEditorIni);
+        GConfig->GetFloat(MCPServerConfigSection, TEXT("GameThreadBudgetMs"), Config.GameThreadBudgetMs, GEditorIni);
+        GConfig->GetInt(MCPServerConfigSection, TEXT("CommandTimeoutMs"), Config.CommandTimeoutMs, GEditorIni);
+        GConfig->GetInt(MCPServerConfigSection, TEXT("NetworkSummaryIntervalSec"), Config.NetworkSummaryIntervalSec, GEditorIni);
+        GConfig->GetInt(MCPServerConfigSection, TEXT("WireTraceBufferBytes"), Config.WireTraceBufferBytes, GEditorIni);
+        GConfig->GetInt(MCPServerConfigSection, TEXT("WireTraceMaxRecordBytes"), Config.WireTraceMaxRecordBytes, GEditorIni);
+        GConfig->GetBool(MCPServerConfigSection, TEXT("DeferAssetCommits"), Config.bDeferAssetCommits, GEditorIni);
+        GConfig->GetInt(MCPServerConfigSection, TEXT("AssetCommitIdleMs"), Config.AssetCommitIdleMs, GEditorIni);
+    }
+
+    // Clamp to sane values so a bad ini entry can't disable the server
+    Config.MaxConnections = FMath::Max(1, Config.MaxConnections);
+    Config.AcceptWaitMs = FMath::Clamp(Config.AcceptWaitMs, 1, 5000);
+    Config.ReadWaitMs = FMath::Clamp(Config.ReadWaitMs, 1, 5000);
+    Config.SocketBufferSize = FMath::Max(4096, Config.SocketBufferSize);
+    Config.MaxFrameBytes = FMath::Max(64 * 1024, Config.MaxFrameBytes);
+    Config.ReceiveChunkBytes = FMath::Clamp(Config.ReceiveChunkBytes, 1024, Config.MaxFrameBytes);
+    Config.MaxPipelinedRequests = FMath::Max(1, Config.MaxPipelinedRequests);
+    Config.GameThreadBudgetMs = FMath::Clamp(Config.GameThreadBudgetMs, 0.1f, 100.0f);
+    Config.CommandTimeoutMs = FMath::Max(0, Config.CommandTimeoutMs);
+    Config.NetworkSummaryIntervalSec = FMath::Max(0, Config.NetworkSummaryIntervalSec);
+    Config.WireTraceBufferBytes = FMath::Max(0, Config.WireTraceBufferBytes);
+    Config.WireTraceMaxRecordBytes = FMath::Max(0, Config.WireTraceMaxRecordBytes);
+    Config.AssetCommitIdleMs = FMath::Max(0, Config.AssetCommitIdleMs);
+
+    return Config;
+}
@@ -0,0 +1,175 @@
+#include "MCPWireTrace.h"
+#include "MCPLogging.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    const uint8 WireTraceMagic[8] = { 'M', 'C', 'P', 'W', 'T', 'R', 'C', '1' };
+
+    /** Console toggle so tracing can be switched on in a running editor without touching the ini */
+    FAutoConsoleCommand WireTraceCommand(
+        TEXT("UnrealMCP.WireTrace"),
+        TEXT("Capture raw MCP traffic into a ring buffer. Usage: UnrealMCP.WireTrace on [CapacityBytes] | off | dump [Path]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            FMCPWireTrace& Trace = FMCPWireTrace::Get();
+            const FString Action = Args.Num() > 0 ? Args[0].ToLower() : TEXT("dump");
+
+            if (Action == TEXT("on"))
+            {
+                const int32 Capacity = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 16 * 1024 * 1024;
+                Trace.Enable(Capacity, 4096);
+            }
+            else if (Action == TEXT("off"))
+            {
+                Trace.Disable();
+            }
+            else
+            {
+                Trace.DumpToFile(Args.Num() > 1 ? Args[1] : FMCPWireTrace::GetDefaultDumpPath());
+            }
+        }));
+}
+
+FMCPWireTrace& FMCPWireTrace::Get()
+{
+    static FMCPWireTrace Instance;
+    return Instance;
+}
+
+FMCPWireTrace::FMCPWireTrace()
+    : bEnabled(false)
+    , MaxRecordBytes(0)
+    , Tail(0)
+    , Head(0)
+    , UsedBytes(0)
+    , DroppedRecords(0)
+{
+}
+
+void FMCPWireTrace::Enable(int32 CapacityBytes, int32 InMaxRecordBytes)
+{
+    FScopeLock Lock(&TraceLock);
+
+    const int32 Capacity = FMath::Max(CapacityBytes, 64 * 1024);
+    Buffer.SetNumUninitialized(Capacity);
+    MaxRecordBytes = FMath::Clamp(InMaxRecordBytes, 0, Capacity - RecordHeaderSize);
+    Tail = 0;
+    Head = 0;
+    UsedBytes = 0;
+    DroppedRecords = 0;
+    bEnabled = true;
+
+    UE_LOG(LogMCPNetwork, Log, TEXT("[NET] Wire trace enabled (%d byte ring, %d bytes per record)"), Capacity, MaxRecordBytes);
+}
+
+void FMCPWireTrace::Disable()
+{
+    if (bEnabled.exchange(false))
+    {
+        UE_LOG(LogMCPNetwork, Log, TEXT("[NET] Wire trace disabled"));
+    }
+}
+
+void FMCPWireTrace::Record(int32 ConnectionId, EDirection Direction, const uint8* Data, int32 Length)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    const uint64 Timestamp = FPlatformTime::Cycles64();
+
+    FScopeLock Lock(&TraceLock);
+
+    const int32 Capacity = Buffer.Num();
+    const uint32 OriginalLength = static_cast<uint32>(Length);
+    const uint32 CapturedLength = static_cast<uint32>(FMath::Min(Length, MaxRecordBytes));
+    const int32 RecordSize = RecordHeaderSize + static_cast<int32>(CapturedLength);
+
+    // Make room by dropping the oldest records
+    while (UsedBytes + RecordSize > Capacity)
+    {
+        uint8 OldHeader[RecordHeaderSize];
+        ReadWrapped(Tail, OldHeader, RecordHeaderSize);
+        uint32 OldCaptured = 0;
+        FMemory::Memcpy(&OldCaptured, OldHeader + 17, sizeof(uint32));
+
+        const int32 OldSize = RecordHeaderSize + static_cast<int32>(OldCaptured);
+        Tail = (Tail + OldSize) % Capacity;
+        UsedBytes -= OldSize;
+        ++DroppedRecords;
+    }
+
+    uint8 Header[RecordHeaderSize];
+    const int32 ConnectionId32 = ConnectionId;
+    const uint8 Direction8 = static_cast<uint8>(Direction);
+    FMemory::Memcpy(Header, &Timestamp, sizeof(uint64));
+    FMemory::Memcpy(Header + 8, &ConnectionId32, sizeof(int32));
+    FMemory::Memcpy(Header + 12, &Direction8, sizeof(uint8));
+    FMemory::Memcpy(Header + 13, &OriginalLength, sizeof(uint32));
+    FMemory::Memcpy(Header + 17, &CapturedLength, sizeof(uint32));
+
+    WriteWrapped(Head, Header, RecordHeaderSize);
+    WriteWrapped((Head + RecordHeaderSize) % Capacity, Data, static_cast<int32>(CapturedLength));
+    Head = (Head + RecordSize) % Capacity;
+    UsedBytes += RecordSize;
+}
+
+bool FMCPWireTrace::DumpToFile(const FString& FilePath) const
+{
+    TArray<uint8> FileData;
+    {
+        FScopeLock Lock(&TraceLock);
+
+        const uint64 CyclesPerSecond = static_cast<uint64>(1.0 / FPlatformTime::GetSecondsPerCycle64());
+        FileData.Reserve(sizeof(WireTraceMagic) + 2 * sizeof(uint64) + UsedBytes);
+        FileData.Append(WireTraceMagic, sizeof(WireTraceMagic));
+        FileData.Append(reinterpret_cast<const uint8*>(&CyclesPerSecond), sizeof(uint64));
+        FileData.Append(reinterpret_cast<const uint8*>(&DroppedRecords), sizeof(uint64));
+
+        const int32 RecordsStart = FileData.Num();
+        FileData.AddUninitialized(UsedBytes);
+        if (UsedBytes > 0)
+        {
+            ReadWrapped(Tail, FileData.GetData() + RecordsStart, UsedBytes);
+        }
+    }
+
+    if (!FFileHelper::SaveArrayToFile(FileData, *FilePath))
+    {
+        UE_LOG(LogMCPNetwork, Warning, TEXT("[NET] Failed to write wire trace to %s"), *FilePath);
+        return false;
+    }
+
+    UE_LOG(LogMCPNetwork, Log, TEXT("[NET] Wrote %d bytes of wire trace to %s"), FileData.Num(), *FilePath);
+    return true;
+}
+
+FString FMCPWireTrace::GetDefaultDumpPath()
+{
+    return FPaths::Combine(FPaths::ProjectLogDir(), TEXT("UnrealMCP_WireTrace.bin"));
+}
+
+void FMCPWireTrace::WriteWrapped(int32 Offset, const uint8* Data, int32 Length)
+{
+    const int32 FirstPart = FMath::Min(Length, Buffer.Num() - Offset);
+    FMemory::Memcpy(Buffer.GetData() + Offset, Data, FirstPart);
+    if (FirstPart < Length)
+    {
+        FMemory::Memcpy(Buffer.GetData(), Data + FirstPart, Length - FirstPart);
+    }
+}
+
+void FMCPWireTrace::ReadWrapped(int32 Offset, uint8* OutData, int32 Length) const
+{
+    const int32 FirstPart = FMath::Min(Length, Buffer.Num() - Offset);
+    FMemory::Memcpy(OutData, Buffer.GetData() + Offset, FirstPart);
+    if (FirstPart < Length)
+    {
+        FMemory::Memcpy(OutData + FirstPart, Buffer.GetData(), Length - FirstPart);
+    }
+}
@@ -0,0 +1,62 @@
+#include "MCPWorkerCommandLane.h"
+#include "Dom/JsonObject.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+
+FMCPWorkerCommandLane::FMCPWorkerCommandLane(FMCPCommandExecutor InExecutor)
+    : Executor(MoveTemp(InExecutor))
+    , bAccepting(true)
+    , InFlightCount(0)
+{
+}
+
+FMCPWorkerCommandLane::~FMCPWorkerCommandLane()
+{
+    Shutdown();
+}
+
+void FMCPWorkerCommandLane::Enqueue(const FMCPCommandHandleRef& Handle, const TSharedPtr<FJsonObject>& Params)
+{
+    {
+        FReadScopeLock Lock(AcceptLock);
+        if (bAccepting)
+        {
+            ++InFlightCount;
+            Async(EAsyncExecution::ThreadPool, [this, Handle, Params]()
+            {
+                // Skip commands cancelled or timed out while waiting for a pool thread
+                Handle->CheckDeadline();
+                if (!Handle->IsCancellationRequested())
+                {
+                    FMCPCommandHandle::FExecutionScope ExecutionScope(*Handle);
+                    Handle->Complete(Executor(Handle->GetCommandType(), Params));
+                }
+                --InFlightCount;
+            });
+            return;
+        }
+    }
+
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+    ResponseJson->SetStringField(TEXT("error"), TEXT("MCP server is shutting down"));
+    Handle->Complete(ResponseJson);
+}
+
+void FMCPWorkerCommandLane::Shutdown()
+{
+    {
+        FWriteScopeLock Lock(AcceptLock);
+        if (!bAccepting)
+        {
+            return;
+        }
+        bAccepting = false;
+    }
+
+    // Running commands reference the executor, so it has to outlive them
+    while (InFlightCount.load() > 0)
+    {
+        FPlatformProcess::Sleep(0.001f);
+    }
+}
@@ -0,0 +1,354 @@
+#include "Services/AssetDirtySet.h"
+#include "Services/BlueprintCompileCache.h"
+#include "MCPServerConfig.h"
+#include "Editor.h"
+#include "EditorAssetLibrary.h"
+#include "Engine/Blueprint.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/ScopeLock.h"
+
+FAssetDirtySet& FAssetDirtySet::Get()
+{
+    static FAssetDirtySet Instance;
+    return Instance;
+}
+
+void FAssetDirtySet::Initialize()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+    
+    const FMCPServerConfig Config = FMCPServerConfig::Load();
+    bImmediateMode.store(!Config.bDeferAssetCommits, std::memory_order_relaxed);
+    IdleFlushSeconds = Config.AssetCommitIdleMs / 1000.0;
+    
+    // Checked every frame: the debounce is measured in wall time, not in ticks
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAssetDirtySet::Tick), 0.0f);
+    
+    UE_LOG(LogTemp, Log, TEXT("FAssetDirtySet: %s"), IsImmediateMode()
+        ? TEXT("Immediate mode, every mutation compiles and saves")
+        : *FString::Printf(TEXT("Deferring compiles and saves, idle flush after %d ms"), Config.AssetCommitIdleMs));
+}
+
+void FAssetDirtySet::Shutdown()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+    
+    // The editor is going away; saving now could touch systems that are already shut down
+    FScopeLock ScopeLock(&Lock);
+    if (PendingAssets.Num() > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FAssetDirtySet: %d modified assets were not flushed before shutdown and are left dirty"), PendingAssets.Num());
+    }
+    PendingAssets.Empty();
+    Stats.PendingCount = 0;
+}
+
+void FAssetDirtySet::MarkDirty(UObject* Asset, EPendingAssetWork Work)
+{
+    check(IsInGameThread());
+    if (!Asset || Work == EPendingAssetWork::None)
+    {
+        return;
+    }
+    
+    if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+    {
+        // A mutation that asks for a compile makes the last compile stale, even if it left the package clean
+        if (EnumHasAnyFlags(Work, EPendingAssetWork::Compile))
+        {
+            FBlueprintCompileCache::Get().Invalidate(Blueprint);
+        }
+    }
+    else
+    {
+        EnumRemoveFlags(Work, EPendingAssetWork::Compile);
+    }
+    
+    // A suspended set queues even in immediate mode; the work is committed when the suspension ends
+    if (IsImmediateMode() && SuspendCount == 0)
+    {
+        CommitNow(Asset, Work);
+        return;
+    }
+    
+    FScopeLock ScopeLock(&Lock);
+    ++Stats.MarkCount;
+    EPendingAssetWork& PendingWork = PendingAssets.FindOrAdd(Asset, EPendingAssetWork::None);
+    if (PendingWork != EPendingAssetWork::None)
+    {
+        ++Stats.CoalescedCount;
+    }
+    PendingWork |= Work;
+    Stats.PendingCount = PendingAssets.Num();
+    LastMarkTime = FPlatformTime::Seconds();
+}
+
+void FAssetDirtySet::EnsureCompiled(UBlueprint* Blueprint)
+{
+    check(IsInGameThread());
+    if (!Blueprint)
+    {
+        return;
+    }
+    
+    {
+        FScopeLock ScopeLock(&Lock);
+        EPendingAssetWork* PendingWork = PendingAssets.Find(Blueprint);
+        if (!PendingWork || !EnumHasAnyFlags(*PendingWork, EPendingAssetWork::Compile))
+        {
+            return;
+        }
+        EnumRemoveFlags(*PendingWork, EPendingAssetWork::Compile);
+        ++Stats.CompileCount;
+    }
+    
+    CompileBlueprint(Blueprint);
+}
+
+void FAssetDirtySet::NoteCompiled(UBlueprint* Blueprint)
+{
+    FScopeLock ScopeLock(&Lock);
+    if (EPendingAssetWork* PendingWork = PendingAssets.Find(Blueprint))
+    {
+        EnumRemoveFlags(*PendingWork, EPendingAssetWork::Compile);
+    }
+}
+
+FAssetFlushResult FAssetDirtySet::Flush()
+{
+    check(IsInGameThread());
+    FAssetFlushResult Result;
+    if (bFlushing)
+    {
+        return Result;
+    }
+    if (SuspendCount > 0)
+    {
+        RequestFlush();
+        return Result;
+    }
+    
+    TMap<TWeakObjectPtr<UObject>, EPendingAssetWork> Work;
+    {
+        FScopeLock ScopeLock(&Lock);
+        bFlushRequested.store(false, std::memory_order_relaxed);
+        if (PendingAssets.Num() == 0)
+        {
+            return Result;
+        }
+        // Anything marked while the flush runs waits for the next one
+        Work = MoveTemp(PendingAssets);
+        PendingAssets.Reset();
+        Stats.PendingCount = 0;
+    }
+    
+    TGuardValue<bool> FlushingGuard(bFlushing, true);
+    const double StartTime = FPlatformTime::Seconds();
+    
+    // Compile everything first, so a blueprint that depends on another one sees it up to date when saved
+    for (const TPair<TWeakObjectPtr<UObject>, EPendingAssetWork>& Pair : Work)
+    {
+        UBlueprint* Blueprint = Cast<UBlueprint>(Pair.Key.Get());
+        if (Blueprint && EnumHasAnyFlags(Pair.Value, EPendingAssetWork::Compile))
+        {
+            CompileBlueprint(Blueprint);
+            Result.Compiled.Add(Blueprint->GetPathName());
+        }
+    }
+    
+    TSet<UPackage*> SavedPackages;
+    for (const TPair<TWeakObjectPtr<UObject>, EPendingAssetWork>& Pair : Work)
+    {
+        UObject* Asset = Pair.Key.Get();
+        if (!Asset)
+        {
+            ++Result.SkippedCount;
+            continue;
+        }
+        if (!EnumHasAnyFlags(Pair.Value, EPendingAssetWork::Save))
+        {
+            continue;
+        }
+    
+        // Several assets may share a package, and a package cleaned since it was marked needs no save
+        UPackage* Package = Asset->GetPackage();
+        bool bAlreadySaved = false;
+        SavedPackages.Add(Package, &bAlreadySaved);
+        if (bAlreadySaved || !Package->IsDirty())
+        {
+            continue;
+        }
+    
+        if (UEditorAssetLibrary::SaveLoadedAsset(Asset, true))
+        {
+            Result.Saved.Add(Asset->GetPathName());
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FAssetDirtySet: Failed to save '%s'"), *Asset->GetPathName());
+            Result.FailedSaves.Add(Asset->GetPathName());
+        }
+    }
+    
+    Result.DurationMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    {
+        FScopeLock ScopeLock(&Lock);
+        ++Stats.FlushCount;
+        Stats.CompileCount += Result.Compiled.Num();
+        Stats.SaveCount += Result.Saved.Num();
+        Stats.LastFlushMs = Result.DurationMs;
+    }
+    
+    UE_LOG(LogTemp, Log, TEXT("FAssetDirtySet: Flushed %d assets: %d compiled, %d saved, %d failed saves in %.1f ms"),
+           Work.Num(), Result.Compiled.Num(), Result.Saved.Num(), Result.FailedSaves.Num(), Result.DurationMs);
+    return Result;
+}
+
+void FAssetDirtySet::RequestFlush()
+{
+    bFlushRequested.store(true, std::memory_order_relaxed);
+}
+
+void FAssetDirtySet::SuspendFlushes()
+{
+    check(IsInGameThread());
+    ++SuspendCount;
+}
+
+void FAssetDirtySet::ResumeFlushes()
+{
+    check(IsInGameThread());
+    if (!ensure(SuspendCount > 0) || --SuspendCount > 0)
+    {
+        return;
+    }
+    
+    // Immediate mode owes a commit for everything queued during the suspension
+    FScopeLock ScopeLock(&Lock);
+    if (IsImmediateMode() && PendingAssets.Num() > 0)
+    {
+        bFlushRequested.store(true, std::memory_order_relaxed);
+    }
+}
+
+TSet<FName> FAssetDirtySet::GetPendingSavePackages() const
+{
+    check(IsInGameThread());
+    TSet<FName> PackageNames;
+    FScopeLock ScopeLock(&Lock);
+    for (const TPair<TWeakObjectPtr<UObject>, EPendingAssetWork>& Pair : PendingAssets)
+    {
+        const UObject* Asset = Pair.Key.Get();
+        if (Asset && EnumHasAnyFlags(Pair.Value, EPendingAssetWork::Save))
+        {
+            PackageNames.Add(Asset->GetPackage()->GetFName());
+        }
+    }
+    return PackageNames;
+}
+
+void FAssetDirtySet::DiscardPendingSaves(const TSet<FName>& PackageNames)
+{
+    check(IsInGameThread());
+    if (PackageNames.Num() == 0)
+    {
+        return;
+    }
+    
+    FScopeLock ScopeLock(&Lock);
+    for (auto It = PendingAssets.CreateIterator(); It; ++It)
+    {
+        const UObject* Asset = It.Key().Get();
+        if (!Asset || !PackageNames.Contains(Asset->GetPackage()->GetFName()))
+        {
+            continue;
+        }
+        
+        EnumRemoveFlags(It.Value(), EPendingAssetWork::Save);
+        if (It.Value() == EPendingAssetWork::None)
+        {
+            It.RemoveCurrent();
+        }
+    }
+    Stats.PendingCount = PendingAssets.Num();
+}
+
+void FAssetDirtySet::SetImmediateMode(bool bImmediate)
+{
+    check(IsInGameThread());
+    bImmediateMode.store(bImmediate, std::memory_order_relaxed);
+    if (bImmediate)
+    {
+        Flush();
+    }
+}
+
+FAssetDirtySetStats FAssetDirtySet::GetStats() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return Stats;
+}
+
+void FAssetDirtySet::CommitNow(UObject* Asset, EPendingAssetWork Work)
+{
+    if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+    {
+        if (EnumHasAnyFlags(Work, EPendingAssetWork::Compile))
+        {
+            CompileBlueprint(Blueprint);
+        }
+    }
+    
+    if (EnumHasAnyFlags(Work, EPendingAssetWork::Save))
+    {
+        UEditorAssetLibrary::SaveLoadedAsset(Asset, false);
+    }
+}
+
+bool FAssetDirtySet::CompileBlueprint(UBlueprint* Blueprint)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    FKismetEditorUtilities::CompileBlueprint(Blueprint);
+    if (Blueprint->Status == BS_Error)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FAssetDirtySet: '%s' compiled with errors"), *Blueprint->GetPathName());
+        FBlueprintCompileCache::Get().Invalidate(Blueprint);
+        return false;
+    }
+    
+    // Flushed compiles count too, so a compile_blueprint right after a flush is skipped
+    FBlueprintCompileCache::Get().RecordCompile(Blueprint, TArray<FString>(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return true;
+}
+
+bool FAssetDirtySet::Tick(float DeltaTime)
+{
+    // PIE holds the editor world and a suspension holds a running batch; the flush waits for both to end
+    if (SuspendCount > 0 || (GEditor && GEditor->PlayWorld))
+    {
+        return true;
+    }
+    
+    bool bShouldFlush = bFlushRequested.load(std::memory_order_relaxed);
+    if (!bShouldFlush && IdleFlushSeconds > 0.0)
+    {
+        FScopeLock ScopeLock(&Lock);
+        bShouldFlush = PendingAssets.Num() > 0 && FPlatformTime::Seconds() - LastMarkTime >= IdleFlushSeconds;
+    }
+    
+    if (bShouldFlush)
+    {
+        Flush();
+    }
+    return true;
+}
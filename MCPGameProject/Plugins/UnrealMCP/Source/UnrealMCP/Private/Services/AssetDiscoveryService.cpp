@@ -1,4 +1,7 @@
 #include "Services/AssetDiscoveryService.h"
+#include "Services/AssetNameIndex.h"
+#include "Services/ObjectResolutionCache.h"
+#include "Services/AssetDirtySet.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "EditorAssetLibrary.h"
 #include "Blueprint/UserWidget.h"
@@ -22,129 +25,49 @@ TArray<FString> FAssetDiscoveryService::FindAssetsByType(const FString& AssetTyp
 {
     TArray<FString> FoundAssets;
     
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    TArray<FAssetData> AssetDataList;
-    
-    FARFilter Filter;
-    Filter.PackagePaths.Add(FName(*SearchPath));
-    Filter.bRecursivePaths = true;
-    
     // Add class names based on asset type
+    TArray<FTopLevelAssetPath> ClassPaths;
     if (AssetType.Equals(TEXT("Blueprint"), ESearchCase::IgnoreCase))
     {
-        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
     }
     else if (AssetType.Equals(TEXT("WidgetBlueprint"), ESearchCase::IgnoreCase))
     {
-        Filter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
-    }
-    
-    AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
-    
-    for (const FAssetData& AssetData : AssetDataList)
-    {
-        FoundAssets.Add(AssetData.GetObjectPathString());
+        ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
     }
     
+    FAssetNameIndex::Get().FindContaining(FString(), ESearchCase::CaseSensitive, ClassPaths, SearchPath, FoundAssets);
     return FoundAssets;
 }
 
 TArray<FString> FAssetDiscoveryService::FindAssetsByName(const FString& AssetName, const FString& SearchPath)
 {
     TArray<FString> FoundAssets;
-    
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    TArray<FAssetData> AssetDataList;
-    
-    FARFilter Filter;
-    Filter.PackagePaths.Add(FName(*SearchPath));
-    Filter.bRecursivePaths = true;
-    
-    AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
-    
-    for (const FAssetData& AssetData : AssetDataList)
-    {
-        if (AssetData.AssetName.ToString().Contains(AssetName))
-        {
-            FoundAssets.Add(AssetData.GetObjectPathString());
-        }
-    }
-    
+    FAssetNameIndex::Get().FindContaining(AssetName, ESearchCase::CaseSensitive, TConstArrayView<FTopLevelAssetPath>(), SearchPath, FoundAssets);
     return FoundAssets;
 }
 
 TArray<FString> FAssetDiscoveryService::FindWidgetBlueprints(const FString& WidgetName, const FString& SearchPath)
 {
     TArray<FString> FoundWidgets;
-    
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    TArray<FAssetData> AssetDataList;
-    
-    FARFilter Filter;
-    Filter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
-    Filter.PackagePaths.Add(FName(*SearchPath));
-    Filter.bRecursivePaths = true;
-    
-    AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
-    
-    for (const FAssetData& AssetData : AssetDataList)
-    {
-        if (WidgetName.IsEmpty() || AssetData.AssetName.ToString().Contains(WidgetName))
-        {
-            FoundWidgets.Add(AssetData.GetObjectPathString());
-        }
-    }
-    
+    const FTopLevelAssetPath ClassPath = UWidgetBlueprint::StaticClass()->GetClassPathName();
+    FAssetNameIndex::Get().FindContaining(WidgetName, ESearchCase::CaseSensitive, MakeArrayView(&ClassPath, 1), SearchPath, FoundWidgets);
     return FoundWidgets;
 }
 
 TArray<FString> FAssetDiscoveryService::FindBlueprints(const FString& BlueprintName, const FString& SearchPath)
 {
     TArray<FString> FoundBlueprints;
-    
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    TArray<FAssetData> AssetDataList;
-    
-    FARFilter Filter;
-    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-    Filter.PackagePaths.Add(FName(*SearchPath));
-    Filter.bRecursivePaths = true;
-    
-    AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
-    
-    for (const FAssetData& AssetData : AssetDataList)
-    {
-        if (BlueprintName.IsEmpty() || AssetData.AssetName.ToString().Contains(BlueprintName))
-        {
-            FoundBlueprints.Add(AssetData.GetObjectPathString());
-        }
-    }
-    
+    const FTopLevelAssetPath ClassPath = UBlueprint::StaticClass()->GetClassPathName();
+    FAssetNameIndex::Get().FindContaining(BlueprintName, ESearchCase::CaseSensitive, MakeArrayView(&ClassPath, 1), SearchPath, FoundBlueprints);
     return FoundBlueprints;
 }
 
 TArray<FString> FAssetDiscoveryService::FindDataTables(const FString& TableName, const FString& SearchPath)
 {
     TArray<FString> FoundTables;
-    
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    TArray<FAssetData> AssetDataList;
-    
-    FARFilter Filter;
-    Filter.ClassPaths.Add(UDataTable::StaticClass()->GetClassPathName());
-    Filter.PackagePaths.Add(FName(*SearchPath));
-    Filter.bRecursivePaths = true;
-    
-    AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
-    
-    for (const FAssetData& AssetData : AssetDataList)
-    {
-        if (TableName.IsEmpty() || AssetData.AssetName.ToString().Contains(TableName))
-        {
-            FoundTables.Add(AssetData.GetObjectPathString());
-        }
-    }
-    
+    const FTopLevelAssetPath ClassPath = UDataTable::StaticClass()->GetClassPathName();
+    FAssetNameIndex::Get().FindContaining(TableName, ESearchCase::CaseSensitive, MakeArrayView(&ClassPath, 1), SearchPath, FoundTables);
     return FoundTables;
 }
 
@@ -152,16 +75,28 @@ UClass* FAssetDiscoveryService::FindWidgetClass(const FString& WidgetPath)
 {
     UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Searching for widget class: %s"), *WidgetPath);
     
-    // First try direct loading
-    UClass* FoundClass = LoadObject<UClass>(nullptr, *WidgetPath);
+    // Native classes are always loaded; generated classes are only loaded when named explicitly
+    UClass* FoundClass = nullptr;
+    if (WidgetPath.StartsWith(TEXT("/Script/")))
+    {
+        FoundClass = FindObject<UClass>(nullptr, *WidgetPath);
+    }
+    else if (WidgetPath.StartsWith(TEXT("/")) && WidgetPath.EndsWith(TEXT("_C")))
+    {
+        FoundClass = LoadObject<UClass>(nullptr, *WidgetPath);
+    }
     if (FoundClass)
     {
         UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found class via direct loading: %s"), *FoundClass->GetName());
+        
+        // A widget blueprint's class may still lack mutations whose compile is deferred
+        FAssetDirtySet::Get().EnsureCompiled(UBlueprint::GetBlueprintFromClass(FoundClass));
         return FoundClass;
     }
     
     // Try loading as widget blueprint
     UWidgetBlueprint* WidgetBP = FindWidgetBlueprint(WidgetPath);
+    FAssetDirtySet::Get().EnsureCompiled(WidgetBP);
     if (WidgetBP && WidgetBP->GeneratedClass)
     {
         UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found class via widget blueprint: %s"), *WidgetBP->GeneratedClass->GetName());
@@ -183,39 +118,44 @@ UWidgetBlueprint* FAssetDiscoveryService::FindWidgetBlueprint(const FString& Wid
 {
     UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Searching for widget blueprint: %s"), *WidgetPath);
     
-    // Try direct loading first
-    UWidgetBlueprint* WidgetBP = LoadObject<UWidgetBlueprint>(nullptr, *WidgetPath);
-    if (WidgetBP)
+    const FString MissKey = TEXT("widget|") + WidgetPath;
+    uint64 Generation = 0;
+    if (IsKnownMiss(MissKey, Generation))
     {
-        UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found via direct loading: %s"), *WidgetBP->GetName());
-        return WidgetBP;
+        UE_LOG(LogTemp, Verbose, TEXT("AssetDiscoveryService: Widget blueprint still missing: %s"), *WidgetPath);
+        return nullptr;
     }
     
-    // Try with common paths
+    // Check the original path and the common folders against the asset name index; only an asset that exists is loaded
+    FAssetNameIndex& AssetIndex = FAssetNameIndex::Get();
+    FAssetNameIndexEntry Entry;
     TArray<FString> SearchPaths = GetCommonAssetSearchPaths(WidgetPath);
     
     for (const FString& SearchPath : SearchPaths)
     {
-        WidgetBP = LoadObject<UWidgetBlueprint>(nullptr, *SearchPath);
-        if (WidgetBP)
+        if (AssetIndex.FindByPath(SearchPath, Entry))
         {
-            UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found via search path: %s"), *SearchPath);
-            return WidgetBP;
+            if (UWidgetBlueprint* WidgetBP = Cast<UWidgetBlueprint>(Entry.ObjectPath.TryLoad()))
+            {
+                UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found via search path: %s"), *SearchPath);
+                return WidgetBP;
+            }
         }
     }
     
-    // Use asset registry as fallback
-    TArray<FString> FoundWidgets = FindWidgetBlueprints(FPaths::GetBaseFilename(WidgetPath));
-    if (FoundWidgets.Num() > 0)
+    // Any widget blueprint with that name, wherever it lives
+    const FTopLevelAssetPath ClassPath = UWidgetBlueprint::StaticClass()->GetClassPathName();
+    TArray<FAssetNameIndexEntry> FoundWidgets;
+    if (AssetIndex.FindByName(FPaths::GetBaseFilename(WidgetPath), MakeArrayView(&ClassPath, 1), FString(), FoundWidgets))
     {
-        WidgetBP = LoadObject<UWidgetBlueprint>(nullptr, *FoundWidgets[0]);
-        if (WidgetBP)
+        if (UWidgetBlueprint* WidgetBP = Cast<UWidgetBlueprint>(FoundWidgets[0].ObjectPath.TryLoad()))
         {
-            UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found via asset registry: %s"), *FoundWidgets[0]);
+            UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found via asset registry: %s"), *FoundWidgets[0].ObjectPathString);
             return WidgetBP;
         }
     }
     
+    RememberMiss(MissKey, Generation);
     UE_LOG(LogTemp, Warning, TEXT("AssetDiscoveryService: Could not find widget blueprint for: %s"), *WidgetPath);
     return nullptr;
 }
@@ -224,27 +164,46 @@ UObject* FAssetDiscoveryService::FindAssetByPath(const FString& AssetPath)
 {
     UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Searching for asset: %s"), *AssetPath);
     
-    // Try direct loading
-    UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
-    if (Asset)
+    // Native objects are never in the asset registry but are always in memory
+    if (AssetPath.StartsWith(TEXT("/Script/")))
     {
-        UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found via direct loading: %s"), *Asset->GetName());
-        return Asset;
+        UObject* NativeObject = FindObject<UObject>(nullptr, *AssetPath);
+        if (NativeObject)
+        {
+            UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found native object: %s"), *NativeObject->GetName());
+            return NativeObject;
+        }
+        
+        UE_LOG(LogTemp, Warning, TEXT("AssetDiscoveryService: Could not find asset for: %s"), *AssetPath);
+        return nullptr;
     }
     
-    // Try with common paths
+    const FString MissKey = TEXT("asset|") + AssetPath;
+    uint64 Generation = 0;
+    if (IsKnownMiss(MissKey, Generation))
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("AssetDiscoveryService: Asset still missing: %s"), *AssetPath);
+        return nullptr;
+    }
+    
+    // Check the original path and the common folders against the asset name index; only an asset that exists is loaded
+    FAssetNameIndex& AssetIndex = FAssetNameIndex::Get();
+    FAssetNameIndexEntry Entry;
     TArray<FString> SearchPaths = GetCommonAssetSearchPaths(AssetPath);
     
     for (const FString& SearchPath : SearchPaths)
     {
-        Asset = LoadObject<UObject>(nullptr, *SearchPath);
-        if (Asset)
+        if (AssetIndex.FindByPath(SearchPath, Entry))
         {
-            UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found via search path: %s"), *SearchPath);
-            return Asset;
+            if (UObject* Asset = Entry.ObjectPath.TryLoad())
+            {
+                UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found via search path: %s"), *SearchPath);
+                return Asset;
+            }
         }
     }
     
+    RememberMiss(MissKey, Generation);
     UE_LOG(LogTemp, Warning, TEXT("AssetDiscoveryService: Could not find asset for: %s"), *AssetPath);
     return nullptr;
 }
@@ -253,37 +212,29 @@ UObject* FAssetDiscoveryService::FindAssetByName(const FString& AssetName, const
 {
     UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Searching for asset: %s (Type: %s)"), *AssetName, *AssetType);
     
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    TArray<FAssetData> AssetDataList;
-    
-    FARFilter Filter;
-    Filter.PackagePaths.Add(TEXT("/Game"));
-    Filter.bRecursivePaths = true;
-    
+    TArray<FTopLevelAssetPath> ClassPaths;
     if (!AssetType.IsEmpty())
     {
         if (AssetType.Equals(TEXT("Blueprint"), ESearchCase::IgnoreCase))
         {
-            Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+            ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
         }
         else if (AssetType.Equals(TEXT("WidgetBlueprint"), ESearchCase::IgnoreCase))
         {
-            Filter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
+            ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
         }
     }
     
-    AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
+    TArray<FAssetNameIndexEntry> FoundAssets;
+    FAssetNameIndex::Get().FindByName(AssetName, ClassPaths, TEXT("/Game"), FoundAssets);
     
-    for (const FAssetData& AssetData : AssetDataList)
+    for (const FAssetNameIndexEntry& Entry : FoundAssets)
     {
-        if (AssetData.AssetName.ToString().Equals(AssetName, ESearchCase::IgnoreCase))
+        UObject* Asset = Entry.ObjectPath.TryLoad();
+        if (Asset)
         {
-            UObject* Asset = AssetData.GetAsset();
-            if (Asset)
-            {
-                UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found asset: %s"), *Asset->GetName());
-                return Asset;
-            }
+            UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found asset: %s"), *Asset->GetName());
+            return Asset;
         }
     }
     
@@ -295,59 +246,117 @@ UScriptStruct* FAssetDiscoveryService::FindStructType(const FString& StructPath)
 {
     UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Searching for struct: %s"), *StructPath);
     
-    // Try direct loading first
-    UScriptStruct* FoundStruct = LoadObject<UScriptStruct>(nullptr, *StructPath);
+    FObjectResolutionCache& ResolutionCache = FObjectResolutionCache::Get();
+    if (UScriptStruct* CachedStruct = ResolutionCache.Find<UScriptStruct>(EResolvedObjectKind::Struct, StructPath))
+    {
+        return CachedStruct;
+    }
+    
+    // Native structs are always in memory, so look them up directly before anything else
+    UScriptStruct* FoundStruct = nullptr;
+    if (StructPath.StartsWith(TEXT("/Script/")))
+    {
+        FoundStruct = FindObject<UScriptStruct>(nullptr, *StructPath);
+    }
+    else if (!StructPath.StartsWith(TEXT("/")))
+    {
+        const FString NativePaths[] = { BuildEnginePath(StructPath), BuildCorePath(StructPath) };
+        for (const FString& Path : NativePaths)
+        {
+            FoundStruct = FindObject<UScriptStruct>(nullptr, *Path);
+            if (FoundStruct)
+            {
+                break;
+            }
+        }
+    }
     if (FoundStruct)
     {
-        UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found via direct loading: %s"), *FoundStruct->GetName());
+        UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found native struct: %s"), *FoundStruct->GetName());
+        ResolutionCache.Store(EResolvedObjectKind::Struct, StructPath, FoundStruct);
         return FoundStruct;
     }
     
-    // Try with common engine paths
-    TArray<FString> CommonPaths = {
-        BuildEnginePath(StructPath),
-        BuildCorePath(StructPath),
-        BuildGamePath(StructPath)
-    };
+    const FString MissKey = TEXT("struct|") + StructPath;
+    uint64 Generation = 0;
+    if (IsKnownMiss(MissKey, Generation))
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("AssetDiscoveryService: Struct still missing: %s"), *StructPath);
+        return nullptr;
+    }
     
-    for (const FString& Path : CommonPaths)
+    // User-defined structs are assets; check the path as given and under /Game
+    FAssetNameIndex& AssetIndex = FAssetNameIndex::Get();
+    FAssetNameIndexEntry Entry;
+    const FString AssetPaths[] = { StructPath, BuildGamePath(StructPath) };
+    for (const FString& Path : AssetPaths)
     {
-        FoundStruct = LoadObject<UScriptStruct>(nullptr, *Path);
-        if (FoundStruct)
+        if (AssetIndex.FindByPath(Path, Entry))
         {
-            UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found via common path: %s"), *Path);
-            return FoundStruct;
+            FoundStruct = Cast<UScriptStruct>(Entry.ObjectPath.TryLoad());
+            if (FoundStruct)
+            {
+                UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found via asset path: %s"), *Path);
+                ResolutionCache.Store(EResolvedObjectKind::Struct, StructPath, FoundStruct);
+                return FoundStruct;
+            }
         }
     }
     
-    // Try finding user-defined structs using asset registry (without UUserDefinedStruct class)
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    TArray<FAssetData> AssetDataList;
+    // Try finding user-defined structs by name; only struct assets are considered, so nothing else gets loaded
+    const FTopLevelAssetPath UserDefinedStructClassPath(TEXT("/Script/Engine"), TEXT("UserDefinedStruct"));
+    TArray<FString> FoundStructs;
+    AssetIndex.FindContaining(FPaths::GetBaseFilename(StructPath), ESearchCase::CaseSensitive, MakeArrayView(&UserDefinedStructClassPath, 1), TEXT("/Game"), FoundStructs);
     
-    FARFilter Filter;
-    Filter.PackagePaths.Add(TEXT("/Game"));
-    Filter.bRecursivePaths = true;
-    
-    AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
-    
-    for (const FAssetData& AssetData : AssetDataList)
+    for (const FString& FoundPath : FoundStructs)
     {
-        if (AssetData.AssetName.ToString().Contains(StructPath))
+        UScriptStruct* ScriptStruct = Cast<UScriptStruct>(FSoftObjectPath(FoundPath).TryLoad());
+        if (ScriptStruct)
         {
-            UObject* Asset = AssetData.GetAsset();
-            UScriptStruct* ScriptStruct = Cast<UScriptStruct>(Asset);
-            if (ScriptStruct)
-            {
-                UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found user-defined struct: %s"), *ScriptStruct->GetName());
-                return ScriptStruct;
-            }
+            UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found user-defined struct: %s"), *ScriptStruct->GetName());
+            ResolutionCache.Store(EResolvedObjectKind::Struct, StructPath, ScriptStruct);
+            return ScriptStruct;
         }
     }
     
+    RememberMiss(MissKey, Generation);
     UE_LOG(LogTemp, Warning, TEXT("AssetDiscoveryService: Could not find struct: %s"), *StructPath);
     return nullptr;
 }
 
+bool FAssetDiscoveryService::IsKnownMiss(const FString& MissKey, uint64& OutGeneration)
+{
+    OutGeneration = FAssetNameIndex::Get().GetGeneration();
+    
+    FScopeLock Lock(&MissLock);
+    if (MissGeneration != OutGeneration)
+    {
+        // An asset was added or renamed since the misses were recorded, so any of them may resolve now
+        KnownMisses.Empty();
+        MissOrder.Empty();
+        MissGeneration = OutGeneration;
+        return false;
+    }
+    return KnownMisses.Contains(MissKey);
+}
+
+void FAssetDiscoveryService::RememberMiss(const FString& MissKey, uint64 Generation)
+{
+    FScopeLock Lock(&MissLock);
+    if (Generation != MissGeneration || Generation != FAssetNameIndex::Get().GetGeneration() || KnownMisses.Contains(MissKey))
+    {
+        return;
+    }
+    
+    while (MissOrder.Num() >= MaxKnownMisses)
+    {
+        KnownMisses.Remove(MissOrder[0]);
+        MissOrder.RemoveAt(0, 1, EAllowShrinking::No);
+    }
+    KnownMisses.Add(MissKey);
+    MissOrder.Add(MissKey);
+}
+
 TArray<FString> FAssetDiscoveryService::GetCommonAssetSearchPaths(const FString& AssetName)
 {
     TArray<FString> SearchPaths;
@@ -407,6 +416,12 @@ UClass* FAssetDiscoveryService::ResolveObjectClass(const FString& ClassName)
         return UMGClass;
     }
     
+    FObjectResolutionCache& ResolutionCache = FObjectResolutionCache::Get();
+    if (UClass* CachedClass = ResolutionCache.Find<UClass>(EResolvedObjectKind::Class, ClassName))
+    {
+        return CachedClass;
+    }
+    
     // Try direct loading with various paths
     TArray<FString> SearchPaths = {
         ClassName,
@@ -423,6 +438,7 @@ UClass* FAssetDiscoveryService::ResolveObjectClass(const FString& ClassName)
         if (FoundClass)
         {
             UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found class via search path: %s -> %s"), *SearchPath, *FoundClass->GetName());
+            ResolutionCache.Store(EResolvedObjectKind::Class, ClassName, FoundClass);
             return FoundClass;
         }
     }
@@ -0,0 +1,352 @@
+#include "Services/AssetNameIndex.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectHash.h"
+
+FAssetNameIndex& FAssetNameIndex::Get()
+{
+    static FAssetNameIndex Instance;
+    return Instance;
+}
+
+void FAssetNameIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    // Subscribe first so nothing discovered between the snapshot and the subscription is missed;
+    // assets that arrive through both paths are simply replaced
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FAssetNameIndex::OnAssetAdded);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FAssetNameIndex::OnAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FAssetNameIndex::OnAssetRenamed);
+
+    const double StartTime = FPlatformTime::Seconds();
+    TArray<FAssetData> AllAssets;
+    AssetRegistry.GetAllAssets(AllAssets, true);
+
+    {
+        FRWScopeLock Lock(IndexLock, SLT_Write);
+        Entries.Reserve(AllAssets.Num());
+        SlotsByName.Reserve(AllAssets.Num());
+        SlotsByPath.Reserve(AllAssets.Num());
+        for (const FAssetData& AssetData : AllAssets)
+        {
+            AddAsset(AssetData);
+        }
+        Stats.InitialBuildMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+        Stats.AssetsAdded = 0;
+        bInitialized = true;
+    }
+    Generation.fetch_add(1, std::memory_order_release);
+
+    UE_LOG(LogTemp, Log, TEXT("FAssetNameIndex: Indexed %d assets in %.1f ms%s"), SlotsByPath.Num(), Stats.InitialBuildMs,
+           AssetRegistry.IsLoadingAssets() ? TEXT(" (asset registry still scanning)") : TEXT(""));
+}
+
+void FAssetNameIndex::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    // The asset registry may already be gone during engine shutdown
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+
+    FRWScopeLock Lock(IndexLock, SLT_Write);
+    Entries.Empty();
+    FreeSlots.Empty();
+    SlotsByName.Empty();
+    SlotsByPath.Empty();
+    bInitialized = false;
+}
+
+bool FAssetNameIndex::FindByName(const FString& AssetName, TConstArrayView<FTopLevelAssetPath> ClassPaths, const FString& UnderPath, TArray<FAssetNameIndexEntry>& OutEntries) const
+{
+    OutEntries.Reset();
+    LookupCount.fetch_add(1, std::memory_order_relaxed);
+
+    // A name that was never turned into an FName cannot be an indexed asset name
+    const FName NameKey(*AssetName, FNAME_Find);
+    if (NameKey.IsNone())
+    {
+        return false;
+    }
+
+    FRWScopeLock Lock(IndexLock, SLT_ReadOnly);
+    const TArray<int32>* Slots = SlotsByName.Find(NameKey);
+    if (!Slots)
+    {
+        return false;
+    }
+
+    int32 NumExactCase = 0;
+    for (int32 Slot : *Slots)
+    {
+        const FAssetNameIndexEntry& Entry = Entries[Slot];
+        if (!Matches(Entry, ClassPaths, UnderPath))
+        {
+            continue;
+        }
+
+        if (Entry.AssetName.Equals(AssetName, ESearchCase::CaseSensitive))
+        {
+            OutEntries.Insert(Entry, NumExactCase++);
+        }
+        else
+        {
+            OutEntries.Add(Entry);
+        }
+    }
+
+    if (OutEntries.Num() > 0)
+    {
+        HitCount.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+bool FAssetNameIndex::FindBestByName(const FString& AssetName, TConstArrayView<FTopLevelAssetPath> ClassPaths, const FString& UnderPath, TConstArrayView<FName> PreferredFolders, FAssetNameIndexEntry& OutEntry) const
+{
+    TArray<FAssetNameIndexEntry> Candidates;
+    if (!FindByName(AssetName, ClassPaths, UnderPath, Candidates))
+    {
+        return false;
+    }
+
+    // Lower is better: exact case outranks folder preference, then folders in the order given
+    int32 BestIndex = 0;
+    int32 BestRank = MAX_int32;
+    for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+    {
+        const FAssetNameIndexEntry& Candidate = Candidates[Index];
+        const int32 FolderRank = PreferredFolders.IndexOfByKey(Candidate.PackagePath);
+        const int32 CaseRank = Candidate.AssetName.Equals(AssetName, ESearchCase::CaseSensitive) ? 0 : 1;
+        const int32 Rank = CaseRank * (PreferredFolders.Num() + 1) + (FolderRank != INDEX_NONE ? FolderRank : PreferredFolders.Num());
+        if (Rank < BestRank)
+        {
+            BestRank = Rank;
+            BestIndex = Index;
+        }
+    }
+
+    OutEntry = MoveTemp(Candidates[BestIndex]);
+    return true;
+}
+
+bool FAssetNameIndex::FindByPath(const FString& AssetPath, FAssetNameIndexEntry& OutEntry) const
+{
+    LookupCount.fetch_add(1, std::memory_order_relaxed);
+
+    const FSoftObjectPath ObjectPath(ToObjectPath(AssetPath));
+    if (ObjectPath.IsNull())
+    {
+        return false;
+    }
+
+    FRWScopeLock Lock(IndexLock, SLT_ReadOnly);
+    if (const int32* Slot = SlotsByPath.Find(ObjectPath))
+    {
+        OutEntry = Entries[*Slot];
+        HitCount.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void FAssetNameIndex::FindContaining(const FString& Substring, ESearchCase::Type SearchCase, TConstArrayView<FTopLevelAssetPath> ClassPaths, const FString& UnderPath, TArray<FString>& OutObjectPaths) const
+{
+    LookupCount.fetch_add(1, std::memory_order_relaxed);
+
+    FRWScopeLock Lock(IndexLock, SLT_ReadOnly);
+    const int32 NumBefore = OutObjectPaths.Num();
+    for (const FAssetNameIndexEntry& Entry : Entries)
+    {
+        if (Matches(Entry, ClassPaths, UnderPath)
+            && (Substring.IsEmpty() || Entry.AssetName.Contains(Substring, SearchCase)))
+        {
+            OutObjectPaths.Add(Entry.ObjectPathString);
+        }
+    }
+
+    if (OutObjectPaths.Num() > NumBefore)
+    {
+        HitCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+FAssetNameIndexStats FAssetNameIndex::GetStats() const
+{
+    FRWScopeLock Lock(IndexLock, SLT_ReadOnly);
+    FAssetNameIndexStats StatsCopy = Stats;
+    StatsCopy.IndexedAssets = SlotsByPath.Num();
+    StatsCopy.DistinctNames = SlotsByName.Num();
+    StatsCopy.Lookups = LookupCount.load(std::memory_order_relaxed);
+    StatsCopy.Hits = HitCount.load(std::memory_order_relaxed);
+    return StatsCopy;
+}
+
+TArray<FTopLevelAssetPath> FAssetNameIndex::GetClassPathsDerivedFrom(const UClass* BaseClass)
+{
+    TArray<FTopLevelAssetPath> ClassPaths;
+    if (!BaseClass)
+    {
+        return ClassPaths;
+    }
+
+    TArray<UClass*> DerivedClasses;
+    GetDerivedClasses(BaseClass, DerivedClasses, true);
+    ClassPaths.Reserve(DerivedClasses.Num() + 1);
+    ClassPaths.Add(BaseClass->GetClassPathName());
+    for (const UClass* DerivedClass : DerivedClasses)
+    {
+        ClassPaths.Add(DerivedClass->GetClassPathName());
+    }
+    return ClassPaths;
+}
+
+FString FAssetNameIndex::ToObjectPath(const FString& AssetPath)
+{
+    FString ObjectPath = AssetPath;
+    if (ObjectPath.EndsWith(TEXT(".uasset"), ESearchCase::IgnoreCase))
+    {
+        ObjectPath.LeftChopInline(7);
+    }
+
+    if (!ObjectPath.StartsWith(TEXT("/")))
+    {
+        return FString();
+    }
+
+    int32 DotIndex = INDEX_NONE;
+    if (!ObjectPath.FindLastChar(TEXT('.'), DotIndex))
+    {
+        ObjectPath += TEXT(".") + FPackageName::GetShortName(ObjectPath);
+    }
+    return ObjectPath;
+}
+
+void FAssetNameIndex::AddAsset(const FAssetData& AssetData)
+{
+    // Redirectors are not assets callers can use; their targets are indexed under their own names
+    if (AssetData.IsRedirector())
+    {
+        return;
+    }
+
+    const FSoftObjectPath ObjectPath = AssetData.GetSoftObjectPath();
+    if (SlotsByPath.Contains(ObjectPath))
+    {
+        RemoveAsset(ObjectPath);
+    }
+
+    const int32 Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+    FAssetNameIndexEntry& Entry = Entries[Slot];
+    Entry.ObjectPath = ObjectPath;
+    Entry.ClassPath = AssetData.AssetClassPath;
+    Entry.PackagePath = AssetData.PackagePath;
+    Entry.AssetName = AssetData.AssetName.ToString();
+    Entry.ObjectPathString = AssetData.GetObjectPathString();
+
+    SlotsByName.FindOrAdd(AssetData.AssetName).Add(Slot);
+    SlotsByPath.Add(ObjectPath, Slot);
+    ++Stats.AssetsAdded;
+}
+
+void FAssetNameIndex::RemoveAsset(const FSoftObjectPath& ObjectPath)
+{
+    int32 Slot = INDEX_NONE;
+    if (!SlotsByPath.RemoveAndCopyValue(ObjectPath, Slot))
+    {
+        return;
+    }
+
+    const FName NameKey = ObjectPath.GetAssetFName();
+    if (TArray<int32>* Slots = SlotsByName.Find(NameKey))
+    {
+        Slots->RemoveSingleSwap(Slot, EAllowShrinking::No);
+        if (Slots->Num() == 0)
+        {
+            SlotsByName.Remove(NameKey);
+        }
+    }
+
+    Entries[Slot] = FAssetNameIndexEntry();
+    FreeSlots.Add(Slot);
+    ++Stats.AssetsRemoved;
+}
+
+bool FAssetNameIndex::Matches(const FAssetNameIndexEntry& Entry, TConstArrayView<FTopLevelAssetPath> ClassPaths, const FString& UnderPath)
+{
+    if (Entry.ObjectPath.IsNull())
+    {
+        return false;
+    }
+
+    if (ClassPaths.Num() > 0 && !ClassPaths.Contains(Entry.ClassPath))
+    {
+        return false;
+    }
+
+    if (!UnderPath.IsEmpty())
+    {
+        // /Game matches /Game/X.X and /Game/Sub/X.X but not /GameData/X.X
+        FStringView Root(UnderPath);
+        if (Root.EndsWith(TEXT('/')))
+        {
+            Root.LeftChopInline(1);
+        }
+        if (!FStringView(Entry.ObjectPathString).StartsWith(Root, ESearchCase::IgnoreCase)
+            || Entry.ObjectPathString.Len() <= Root.Len()
+            || Entry.ObjectPathString[Root.Len()] != TEXT('/'))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FAssetNameIndex::OnAssetAdded(const FAssetData& AssetData)
+{
+    {
+        FRWScopeLock Lock(IndexLock, SLT_Write);
+        AddAsset(AssetData);
+    }
+    Generation.fetch_add(1, std::memory_order_release);
+}
+
+void FAssetNameIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+    FRWScopeLock Lock(IndexLock, SLT_Write);
+    RemoveAsset(AssetData.GetSoftObjectPath());
+}
+
+void FAssetNameIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    {
+        FRWScopeLock Lock(IndexLock, SLT_Write);
+        RemoveAsset(FSoftObjectPath(OldObjectPath));
+        AddAsset(AssetData);
+        ++Stats.AssetsRenamed;
+    }
+    Generation.fetch_add(1, std::memory_order_release);
+}
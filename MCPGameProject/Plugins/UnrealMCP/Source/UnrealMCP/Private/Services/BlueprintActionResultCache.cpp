@@ -0,0 +1,176 @@
+#include "Services/BlueprintActionResultCache.h"
+#include "BlueprintActionDatabase.h"
+#include "Editor.h"
+#include "Interfaces/IPluginManager.h"
+#include "Modules/ModuleManager.h"
+
+FBlueprintActionResultCache& FBlueprintActionResultCache::Get()
+{
+    static FBlueprintActionResultCache Instance;
+    return Instance;
+}
+
+FString FBlueprintActionResultCache::MakeKey(const TCHAR* QueryKind, const FString& Subject, const FString& SearchFilter, int32 MaxResults)
+{
+    // Filters are matched case-insensitively by every query, so fold them here as well
+    return FString::Printf(TEXT("%s|%s|%s|%d"), QueryKind, *Subject, *SearchFilter.ToLower(), MaxResults);
+}
+
+bool FBlueprintActionResultCache::Find(const FString& Key, FString& OutResult)
+{
+    if (IsInGameThread())
+    {
+        RegisterInvalidationHooks();
+    }
+
+    FScopeLock Lock(&CacheLock);
+    CacheStats.TotalRequests++;
+
+    if (const FString* CachedResult = CachedResults.Find(Key))
+    {
+        CacheStats.CacheHits++;
+        OutResult = *CachedResult;
+        UE_LOG(LogTemp, Verbose, TEXT("FBlueprintActionResultCache: Cache hit for '%s'"), *Key);
+        return true;
+    }
+
+    CacheStats.CacheMisses++;
+    return false;
+}
+
+void FBlueprintActionResultCache::Store(const FString& Key, const FString& Result)
+{
+    FScopeLock Lock(&CacheLock);
+
+    if (!CachedResults.Contains(Key))
+    {
+        if (InsertionOrder.Num() < MaxEntries)
+        {
+            InsertionOrder.Add(Key);
+        }
+        else
+        {
+            // Once the budget is reached the ring is full: the new key replaces the oldest in place
+            CachedResults.Remove(InsertionOrder[OldestIndex]);
+            InsertionOrder[OldestIndex] = Key;
+            OldestIndex = (OldestIndex + 1) % MaxEntries;
+            CacheStats.InvalidatedCount++;
+        }
+    }
+
+    CachedResults.Add(Key, Result);
+    CacheStats.CachedCount = CachedResults.Num();
+    UE_LOG(LogTemp, Verbose, TEXT("FBlueprintActionResultCache: Cached result for '%s'"), *Key);
+}
+
+void FBlueprintActionResultCache::Invalidate(const TCHAR* Reason)
+{
+    FScopeLock Lock(&CacheLock);
+    if (CachedResults.Num() == 0)
+    {
+        return;
+    }
+
+    const int32 ClearedCount = CachedResults.Num();
+    CachedResults.Empty();
+    InsertionOrder.Empty();
+    OldestIndex = 0;
+    CacheStats.InvalidatedCount += ClearedCount;
+    CacheStats.FlushCount++;
+    CacheStats.CachedCount = 0;
+    UE_LOG(LogTemp, Verbose, TEXT("FBlueprintActionResultCache: Cleared %d cached results (%s)"), ClearedCount, Reason);
+}
+
+FBlueprintActionResultCacheStats FBlueprintActionResultCache::GetCacheStats() const
+{
+    FScopeLock Lock(&CacheLock);
+    FBlueprintActionResultCacheStats StatsCopy = CacheStats;
+    StatsCopy.CachedCount = CachedResults.Num();
+    return StatsCopy;
+}
+
+void FBlueprintActionResultCache::ResetCacheStats()
+{
+    FScopeLock Lock(&CacheLock);
+    CacheStats.Reset();
+    CacheStats.CachedCount = CachedResults.Num();
+    UE_LOG(LogTemp, Log, TEXT("FBlueprintActionResultCache: Cache statistics reset"));
+}
+
+void FBlueprintActionResultCache::Shutdown()
+{
+    if (GEditor && BlueprintCompiledHandle.IsValid())
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    if (PluginMountedHandle.IsValid())
+    {
+        IPluginManager::Get().OnNewPluginMounted().Remove(PluginMountedHandle);
+    }
+
+    // The action database lives in BlueprintGraph, which may already be gone during engine shutdown
+    if (EntryUpdatedHandle.IsValid() && FModuleManager::Get().IsModuleLoaded(TEXT("BlueprintGraph")))
+    {
+        FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+        ActionDatabase.OnEntryUpdated().Remove(EntryUpdatedHandle);
+        ActionDatabase.OnEntryRemoved().Remove(EntryRemovedHandle);
+    }
+
+    BlueprintCompiledHandle.Reset();
+    ReloadCompleteHandle.Reset();
+    PluginMountedHandle.Reset();
+    EntryUpdatedHandle.Reset();
+    EntryRemovedHandle.Reset();
+
+    FScopeLock Lock(&CacheLock);
+    CachedResults.Empty();
+    InsertionOrder.Empty();
+    OldestIndex = 0;
+    CacheStats.CachedCount = 0;
+}
+
+void FBlueprintActionResultCache::RegisterInvalidationHooks()
+{
+    check(IsInGameThread());
+
+    // GEditor does not exist yet while the module starts up, so hooks are bound on first use
+    if (!BlueprintCompiledHandle.IsValid() && GEditor)
+    {
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FBlueprintActionResultCache::OnBlueprintCompiled);
+    }
+    if (!ReloadCompleteHandle.IsValid())
+    {
+        ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FBlueprintActionResultCache::OnReloadComplete);
+    }
+    if (!PluginMountedHandle.IsValid())
+    {
+        PluginMountedHandle = IPluginManager::Get().OnNewPluginMounted().AddRaw(this, &FBlueprintActionResultCache::OnPluginMounted);
+    }
+    if (!EntryUpdatedHandle.IsValid())
+    {
+        FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+        EntryUpdatedHandle = ActionDatabase.OnEntryUpdated().AddRaw(this, &FBlueprintActionResultCache::OnActionDatabaseChanged);
+        EntryRemovedHandle = ActionDatabase.OnEntryRemoved().AddRaw(this, &FBlueprintActionResultCache::OnActionDatabaseChanged);
+    }
+}
+
+void FBlueprintActionResultCache::OnBlueprintCompiled()
+{
+    Invalidate(TEXT("blueprint compiled"));
+}
+
+void FBlueprintActionResultCache::OnReloadComplete(EReloadCompleteReason Reason)
+{
+    Invalidate(TEXT("hot reload"));
+}
+
+void FBlueprintActionResultCache::OnPluginMounted(IPlugin& Plugin)
+{
+    Invalidate(TEXT("plugin mounted"));
+}
+
+void FBlueprintActionResultCache::OnActionDatabaseChanged(UObject* ActionKey)
+{
+    Invalidate(TEXT("action database changed"));
+}
@@ -0,0 +1,456 @@
+#include "Services/BlueprintActionSearchIndex.h"
+#include "BlueprintActionDatabase.h"
+#include "BlueprintNodeSpawner.h"
+#include "K2Node.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_ExecutionSequence.h"
+#include "K2Node_DynamicCast.h"
+#include "K2Node_CustomEvent.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/PlatformTime.h"
+#include "Modules/ModuleManager.h"
+
+namespace
+{
+    /** Rank buckets, best first: exact title, title prefix, title substring, other fields */
+    constexpr int32 NumSearchRanks = 4;
+
+    /**
+     * Fill in the searchable description of a spawner
+     * @return False if the spawner has no template node and cannot be described
+     */
+    bool DescribeSpawner(const UBlueprintNodeSpawner* NodeSpawner, FBlueprintActionSearchEntry& OutEntry)
+    {
+        UEdGraphNode* TemplateNode = NodeSpawner->GetTemplateNode();
+        if (!TemplateNode)
+        {
+            return false;
+        }
+
+        OutEntry.Title = TEXT("Unknown Action");
+        OutEntry.Category = TEXT("Unknown");
+        OutEntry.NodeType = TEXT("Unknown");
+
+        // Determine node type and get information
+        if (TemplateNode->IsA<UK2Node_IfThenElse>())
+        {
+            OutEntry.Title = TEXT("Branch");
+            OutEntry.Category = TEXT("Flow Control");
+            OutEntry.NodeType = TEXT("Branch");
+            OutEntry.Tooltip = TEXT("Conditional execution based on boolean input");
+            OutEntry.Keywords = TEXT("if then else conditional branch bool boolean");
+        }
+        else if (TemplateNode->IsA<UK2Node_ExecutionSequence>())
+        {
+            OutEntry.Title = TEXT("Sequence");
+            OutEntry.Category = TEXT("Flow Control");
+            OutEntry.NodeType = TEXT("Sequence");
+            OutEntry.Tooltip = TEXT("Execute multiple outputs in order");
+            OutEntry.Keywords = TEXT("sequence multiple execution order flow");
+        }
+        else if (TemplateNode->IsA<UK2Node_DynamicCast>())
+        {
+            OutEntry.Title = TEXT("Cast");
+            OutEntry.Category = TEXT("Utilities");
+            OutEntry.NodeType = TEXT("Cast");
+            OutEntry.Tooltip = TEXT("Cast object to different type");
+            OutEntry.Keywords = TEXT("cast convert type object class");
+        }
+        else if (TemplateNode->IsA<UK2Node_CustomEvent>())
+        {
+            OutEntry.Title = TEXT("Custom Event");
+            OutEntry.Category = TEXT("Events");
+            OutEntry.NodeType = TEXT("CustomEvent");
+            OutEntry.Tooltip = TEXT("Create custom event that can be called");
+            OutEntry.Keywords = TEXT("custom event call dispatch");
+        }
+        else if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
+        {
+            if (UFunction* Function = FunctionNode->GetTargetFunction())
+            {
+                UClass* OwnerClass = Function->GetOwnerClass();
+                OutEntry.Title = Function->GetName();
+                OutEntry.Category = OwnerClass->GetName();
+                OutEntry.FunctionName = Function->GetName();
+                OutEntry.ClassName = OwnerClass->GetName();
+
+                // Better categorization
+                if (OwnerClass == UKismetMathLibrary::StaticClass())
+                {
+                    OutEntry.Category = TEXT("Math");
+                    OutEntry.Keywords = TEXT("math mathematics calculation");
+                    OutEntry.bIsMathFunction = true;
+                }
+                else if (OwnerClass == UKismetSystemLibrary::StaticClass())
+                {
+                    OutEntry.Category = TEXT("Utilities");
+                    OutEntry.Keywords = TEXT("system utility helper");
+                }
+                else if (OwnerClass == UGameplayStatics::StaticClass())
+                {
+                    OutEntry.Category = TEXT("Game");
+                    OutEntry.Keywords = TEXT("gameplay game static");
+                }
+
+                OutEntry.NodeType = TEXT("Function");
+            }
+        }
+        else if (UK2Node* K2Node = Cast<UK2Node>(TemplateNode))
+        {
+            OutEntry.Title = K2Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+            if (OutEntry.Title.IsEmpty())
+            {
+                OutEntry.Title = K2Node->GetClass()->GetName();
+            }
+            OutEntry.NodeType = K2Node->GetClass()->GetName();
+            OutEntry.Category = TEXT("Node");
+        }
+
+        return true;
+    }
+}
+
+FBlueprintActionSearchIndex& FBlueprintActionSearchIndex::Get()
+{
+    static FBlueprintActionSearchIndex Instance;
+    return Instance;
+}
+
+void FBlueprintActionSearchIndex::Search(const FString& Query, const FString& CategoryFilter, int32 MaxResults, TArray<FBlueprintActionSearchEntry>& OutResults)
+{
+    OutResults.Reset();
+    if (Query.IsEmpty() || MaxResults <= 0)
+    {
+        return;
+    }
+
+    FScopeLock Lock(&IndexLock);
+    EnsureUpToDate();
+    ++Stats.Queries;
+
+    FString QueryLower;
+    AppendLower(Query, QueryLower);
+
+    // Evaluate the category filter once per distinct category rather than once per action
+    TBitArray<> AllowedCategories;
+    if (!CategoryFilter.IsEmpty())
+    {
+        FString FilterLower;
+        AppendLower(CategoryFilter, FilterLower);
+        AllowedCategories.Init(false, Categories.Num());
+        for (int32 CategoryId = 0; CategoryId < Categories.Num(); ++CategoryId)
+        {
+            AllowedCategories[CategoryId] = Categories[CategoryId].Contains(FilterLower, ESearchCase::CaseSensitive);
+        }
+    }
+
+    // Only actions containing every trigram of the query can match, so the shortest posting list bounds the work;
+    // queries shorter than a trigram scan every action
+    const TArray<int32>* Candidates = nullptr;
+    for (int32 Index = 0; Index + 2 < QueryLower.Len(); ++Index)
+    {
+        const TArray<int32>* Posting = Postings.Find(MakeTrigram(QueryLower[Index], QueryLower[Index + 1], QueryLower[Index + 2]));
+        if (!Posting)
+        {
+            return;
+        }
+        if (!Candidates || Posting->Num() < Candidates->Num())
+        {
+            Candidates = Posting;
+        }
+    }
+
+    TArray<int32, TInlineAllocator<64>> Ranked[NumSearchRanks];
+    auto Consider = [&](int32 ActionId)
+    {
+        const FIndexedAction& Action = Actions[ActionId];
+        if (!Action.bLive || !Action.Spawner.IsValid())
+        {
+            return false;
+        }
+        if (AllowedCategories.Num() > 0 && !AllowedCategories[Action.CategoryId])
+        {
+            return false;
+        }
+        if (!Action.SearchTextLower.Contains(QueryLower, ESearchCase::CaseSensitive))
+        {
+            return false;
+        }
+
+        int32 Rank = 3;
+        if (Action.TitleLower.Equals(QueryLower, ESearchCase::CaseSensitive))
+        {
+            Rank = 0;
+        }
+        else if (Action.TitleLower.StartsWith(QueryLower, ESearchCase::CaseSensitive))
+        {
+            Rank = 1;
+        }
+        else if (Action.TitleLower.Contains(QueryLower, ESearchCase::CaseSensitive))
+        {
+            Rank = 2;
+        }
+
+        if (Ranked[Rank].Num() < MaxResults)
+        {
+            Ranked[Rank].Add(ActionId);
+        }
+
+        // Once the best rank is full, nothing later can make it into the results
+        return Ranked[0].Num() >= MaxResults;
+    };
+
+    if (Candidates)
+    {
+        for (int32 ActionId : *Candidates)
+        {
+            if (Consider(ActionId))
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        for (int32 ActionId = 0; ActionId < Actions.Num(); ++ActionId)
+        {
+            if (Consider(ActionId))
+            {
+                break;
+            }
+        }
+    }
+
+    OutResults.Reserve(MaxResults);
+    for (int32 Rank = 0; Rank < NumSearchRanks && OutResults.Num() < MaxResults; ++Rank)
+    {
+        for (int32 ActionId : Ranked[Rank])
+        {
+            if (OutResults.Num() >= MaxResults)
+            {
+                break;
+            }
+            OutResults.Add(Actions[ActionId].Entry);
+        }
+    }
+}
+
+void FBlueprintActionSearchIndex::Rebuild()
+{
+    FScopeLock Lock(&IndexLock);
+    BuildIndex();
+}
+
+FBlueprintActionSearchIndexStats FBlueprintActionSearchIndex::GetStats() const
+{
+    FScopeLock Lock(&IndexLock);
+    return Stats;
+}
+
+void FBlueprintActionSearchIndex::Shutdown()
+{
+    FScopeLock Lock(&IndexLock);
+
+    // The action database lives in BlueprintGraph, which may already be gone during engine shutdown
+    if (FModuleManager::Get().IsModuleLoaded(TEXT("BlueprintGraph")))
+    {
+        FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+        ActionDatabase.OnEntryUpdated().Remove(EntryUpdatedHandle);
+        ActionDatabase.OnEntryRemoved().Remove(EntryRemovedHandle);
+    }
+    EntryUpdatedHandle.Reset();
+    EntryRemovedHandle.Reset();
+
+    Actions.Empty();
+    Postings.Empty();
+    ActionsByKey.Empty();
+    Categories.Empty();
+    CategoryIds.Empty();
+    DirtyKeys.Empty();
+    RetiredCount = 0;
+    bBuilt = false;
+}
+
+void FBlueprintActionSearchIndex::EnsureUpToDate()
+{
+    check(IsInGameThread());
+
+    if (!bBuilt)
+    {
+        BuildIndex();
+        return;
+    }
+
+    if (DirtyKeys.Num() == 0)
+    {
+        return;
+    }
+
+    // Retired actions stay in the postings, so rebuild instead of letting them pile up
+    if (RetiredCount + DirtyKeys.Num() > Actions.Num() / 2)
+    {
+        BuildIndex();
+        return;
+    }
+
+    const FBlueprintActionDatabase::FActionRegistry& ActionRegistry = FBlueprintActionDatabase::Get().GetAllActions();
+    for (const FObjectKey& ActionKey : DirtyKeys)
+    {
+        RemoveActionKey(ActionKey);
+
+        if (const FBlueprintActionDatabase::FActionList* Spawners = ActionRegistry.Find(ActionKey))
+        {
+            for (const UBlueprintNodeSpawner* NodeSpawner : *Spawners)
+            {
+                IndexSpawner(ActionKey, NodeSpawner);
+            }
+        }
+        ++Stats.IncrementalUpdates;
+    }
+    DirtyKeys.Reset();
+
+    Stats.TrigramCount = Postings.Num();
+}
+
+void FBlueprintActionSearchIndex::BuildIndex()
+{
+    check(IsInGameThread());
+
+    const double StartSeconds = FPlatformTime::Seconds();
+
+    Actions.Reset();
+    Postings.Reset();
+    ActionsByKey.Reset();
+    Categories.Reset();
+    CategoryIds.Reset();
+    DirtyKeys.Reset();
+    RetiredCount = 0;
+    Stats.IndexedActions = 0;
+
+    FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+    if (!EntryUpdatedHandle.IsValid())
+    {
+        EntryUpdatedHandle = ActionDatabase.OnEntryUpdated().AddRaw(this, &FBlueprintActionSearchIndex::OnEntryUpdated);
+        EntryRemovedHandle = ActionDatabase.OnEntryRemoved().AddRaw(this, &FBlueprintActionSearchIndex::OnEntryRemoved);
+    }
+
+    const FBlueprintActionDatabase::FActionRegistry& ActionRegistry = ActionDatabase.GetAllActions();
+    for (const auto& ActionPair : ActionRegistry)
+    {
+        for (const UBlueprintNodeSpawner* NodeSpawner : ActionPair.Value)
+        {
+            IndexSpawner(ActionPair.Key, NodeSpawner);
+        }
+    }
+
+    bBuilt = true;
+    ++Stats.FullBuilds;
+    Stats.TrigramCount = Postings.Num();
+    Stats.LastBuildMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+    UE_LOG(LogTemp, Log, TEXT("FBlueprintActionSearchIndex: Indexed %d actions (%d trigrams) in %.1f ms"),
+           Stats.IndexedActions, Stats.TrigramCount, Stats.LastBuildMs);
+}
+
+void FBlueprintActionSearchIndex::IndexSpawner(const FObjectKey& ActionKey, const UBlueprintNodeSpawner* NodeSpawner)
+{
+    if (!NodeSpawner || !IsValid(NodeSpawner))
+    {
+        return;
+    }
+
+    FIndexedAction Action;
+    if (!DescribeSpawner(NodeSpawner, Action.Entry))
+    {
+        return;
+    }
+
+    const FBlueprintActionSearchEntry& Entry = Action.Entry;
+    AppendLower(Entry.Title, Action.TitleLower);
+
+    Action.SearchTextLower.Reserve(Entry.Title.Len() + Entry.Category.Len() + Entry.Tooltip.Len() + Entry.Keywords.Len() + 3);
+    Action.SearchTextLower += Action.TitleLower;
+    Action.SearchTextLower += TEXT('\n');
+    AppendLower(Entry.Category, Action.SearchTextLower);
+    Action.SearchTextLower += TEXT('\n');
+    AppendLower(Entry.Tooltip, Action.SearchTextLower);
+    Action.SearchTextLower += TEXT('\n');
+    AppendLower(Entry.Keywords, Action.SearchTextLower);
+
+    FString CategoryLower;
+    AppendLower(Entry.Category, CategoryLower);
+    if (const int32* ExistingId = CategoryIds.Find(CategoryLower))
+    {
+        Action.CategoryId = *ExistingId;
+    }
+    else
+    {
+        Action.CategoryId = Categories.Add(CategoryLower);
+        CategoryIds.Add(MoveTemp(CategoryLower), Action.CategoryId);
+    }
+
+    Action.ActionKey = ActionKey;
+    Action.Spawner = NodeSpawner;
+
+    // Postings stay sorted because ids only grow; a trigram repeated within one action is added once
+    const int32 ActionId = Actions.Num();
+    const FString& Text = Action.SearchTextLower;
+    for (int32 Index = 0; Index + 2 < Text.Len(); ++Index)
+    {
+        if (Text[Index] == TEXT('\n') || Text[Index + 1] == TEXT('\n') || Text[Index + 2] == TEXT('\n'))
+        {
+            continue;
+        }
+
+        TArray<int32>& Posting = Postings.FindOrAdd(MakeTrigram(Text[Index], Text[Index + 1], Text[Index + 2]));
+        if (Posting.Num() == 0 || Posting.Last() != ActionId)
+        {
+            Posting.Add(ActionId);
+        }
+    }
+
+    ActionsByKey.FindOrAdd(ActionKey).Add(ActionId);
+    Actions.Add(MoveTemp(Action));
+    ++Stats.IndexedActions;
+}
+
+void FBlueprintActionSearchIndex::RemoveActionKey(const FObjectKey& ActionKey)
+{
+    if (TArray<int32>* ActionIds = ActionsByKey.Find(ActionKey))
+    {
+        for (int32 ActionId : *ActionIds)
+        {
+            if (Actions[ActionId].bLive)
+            {
+                Actions[ActionId].bLive = false;
+                ++RetiredCount;
+                --Stats.IndexedActions;
+            }
+        }
+        ActionsByKey.Remove(ActionKey);
+    }
+}
+
+void FBlueprintActionSearchIndex::AppendLower(const FString& Text, FString& Out)
+{
+    Out.Reserve(Out.Len() + Text.Len());
+    for (TCHAR Character : Text)
+    {
+        Out.AppendChar(FChar::ToLower(Character));
+    }
+}
+
+void FBlueprintActionSearchIndex::OnEntryUpdated(UObject* ActionKey)
+{
+    FScopeLock Lock(&IndexLock);
+    DirtyKeys.Add(FObjectKey(ActionKey));
+}
+
+void FBlueprintActionSearchIndex::OnEntryRemoved(UObject* ActionKey)
+{
+    FScopeLock Lock(&IndexLock);
+    DirtyKeys.Add(FObjectKey(ActionKey));
+}
@@ -0,0 +1,198 @@
+#include "Services/BlueprintCompileCache.h"
+#include "Editor.h"
+#include "Engine/UserDefinedStruct.h"
+#include "UObject/Package.h"
+
+FBlueprintCompileCache& FBlueprintCompileCache::Get()
+{
+    static FBlueprintCompileCache Instance;
+    return Instance;
+}
+
+void FBlueprintCompileCache::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    PackageDirtyHandle = UPackage::PackageMarkedDirtyEvent.AddRaw(this, &FBlueprintCompileCache::OnPackageMarkedDirty);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FBlueprintCompileCache::OnUndoRedo);
+    bInitialized = true;
+}
+
+void FBlueprintCompileCache::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    UPackage::PackageMarkedDirtyEvent.Remove(PackageDirtyHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+    PackageDirtyHandle.Reset();
+    UndoRedoHandle.Reset();
+
+    Entries.Empty();
+    Dependents.Empty();
+    TrackedCount = 0;
+    bInitialized = false;
+}
+
+bool FBlueprintCompileCache::FindUpToDate(UBlueprint* Blueprint, FBlueprintCompileRecord& OutRecord)
+{
+    check(IsInGameThread());
+    if (!Blueprint)
+    {
+        return false;
+    }
+
+    ++LookupCount;
+    const FEntry* Entry = Entries.Find(Blueprint);
+    if (!Entry)
+    {
+        return false;
+    }
+
+    // Edits that skip MarkPackageDirty still leave the Blueprint dirty or recompiled
+    const bool bStatusCurrent = Blueprint->Status == BS_UpToDate || Blueprint->Status == BS_UpToDateWithWarnings;
+    if (!bStatusCurrent || !Blueprint->GeneratedClass || Entry->GeneratedClass.Get() != Blueprint->GeneratedClass)
+    {
+        RemoveEntry(Blueprint);
+        ++InvalidationCount;
+        return false;
+    }
+
+    OutRecord = Entry->Record;
+    ++SkipCount;
+    SavedMs = SavedMs.load() + Entry->Record.CompileMs;
+    return true;
+}
+
+void FBlueprintCompileCache::RecordCompile(UBlueprint* Blueprint, const TArray<FString>& Warnings, double CompileMs)
+{
+    check(IsInGameThread());
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    RemoveEntry(Blueprint);
+    if (!bInitialized || !Blueprint->GeneratedClass || (Blueprint->Status != BS_UpToDate && Blueprint->Status != BS_UpToDateWithWarnings))
+    {
+        return;
+    }
+
+    FEntry Entry;
+    Entry.Record.Status = Blueprint->Status;
+    Entry.Record.Warnings = Warnings;
+    Entry.Record.CompileMs = CompileMs;
+    Entry.GeneratedClass = Blueprint->GeneratedClass;
+
+    Entry.Packages.AddUnique(Blueprint->GetPackage());
+    for (UClass* Class = Blueprint->ParentClass; Class; Class = Class->GetSuperClass())
+    {
+        if (UBlueprint* ParentBlueprint = Cast<UBlueprint>(Class->ClassGeneratedBy))
+        {
+            Entry.Packages.AddUnique(ParentBlueprint->GetPackage());
+        }
+    }
+    for (const TWeakObjectPtr<UBlueprint>& Dependency : Blueprint->CachedDependencies)
+    {
+        if (const UBlueprint* DependencyBlueprint = Dependency.Get())
+        {
+            Entry.Packages.AddUnique(DependencyBlueprint->GetPackage());
+        }
+    }
+    for (const TWeakObjectPtr<UStruct>& Dependency : Blueprint->CachedUDSDependencies)
+    {
+        if (const UStruct* DependencyStruct = Dependency.Get())
+        {
+            Entry.Packages.AddUnique(DependencyStruct->GetPackage());
+        }
+    }
+
+    const TObjectKey<UBlueprint> BlueprintKey(Blueprint);
+    for (const TObjectKey<UPackage>& PackageKey : Entry.Packages)
+    {
+        Dependents.FindOrAdd(PackageKey).Add(BlueprintKey);
+    }
+    Entries.Add(BlueprintKey, MoveTemp(Entry));
+    TrackedCount = Entries.Num();
+}
+
+void FBlueprintCompileCache::Invalidate(UBlueprint* Blueprint)
+{
+    check(IsInGameThread());
+    if (Blueprint && Entries.Contains(Blueprint))
+    {
+        RemoveEntry(Blueprint);
+        ++InvalidationCount;
+    }
+}
+
+FBlueprintCompileCacheStats FBlueprintCompileCache::GetStats() const
+{
+    FBlueprintCompileCacheStats Stats;
+    Stats.TrackedBlueprints = TrackedCount.load();
+    Stats.Lookups = LookupCount.load();
+    Stats.Skips = SkipCount.load();
+    Stats.Invalidations = InvalidationCount.load();
+    Stats.SavedMs = SavedMs.load();
+    return Stats;
+}
+
+void FBlueprintCompileCache::ResetStats()
+{
+    LookupCount = 0;
+    SkipCount = 0;
+    InvalidationCount = 0;
+    SavedMs = 0.0;
+}
+
+void FBlueprintCompileCache::RemoveEntry(TObjectKey<UBlueprint> BlueprintKey)
+{
+    FEntry Entry;
+    if (!Entries.RemoveAndCopyValue(BlueprintKey, Entry))
+    {
+        return;
+    }
+
+    for (const TObjectKey<UPackage>& PackageKey : Entry.Packages)
+    {
+        if (auto* PackageDependents = Dependents.Find(PackageKey))
+        {
+            PackageDependents->RemoveSingleSwap(BlueprintKey);
+            if (PackageDependents->Num() == 0)
+            {
+                Dependents.Remove(PackageKey);
+            }
+        }
+    }
+    TrackedCount = Entries.Num();
+}
+
+void FBlueprintCompileCache::OnPackageMarkedDirty(UPackage* Package, bool bWasDirty)
+{
+    // Fires for every modification, even of packages that are already dirty
+    TArray<TObjectKey<UBlueprint>, TInlineAllocator<1>> Affected;
+    if (!Dependents.RemoveAndCopyValue(Package, Affected))
+    {
+        return;
+    }
+
+    for (const TObjectKey<UBlueprint>& BlueprintKey : Affected)
+    {
+        RemoveEntry(BlueprintKey);
+        ++InvalidationCount;
+    }
+}
+
+void FBlueprintCompileCache::OnUndoRedo()
+{
+    InvalidationCount += Entries.Num();
+    Entries.Empty();
+    Dependents.Empty();
+    TrackedCount = 0;
+}
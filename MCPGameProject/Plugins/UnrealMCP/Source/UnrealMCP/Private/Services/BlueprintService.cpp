@@ -2,6 +2,9 @@
 #include "Services/ComponentService.h"
 #include "Services/PropertyService.h"
 #include "Utils/UnrealMCPCommonUtils.h"
+#include "Services/ObjectResolutionCache.h"
+#include "Services/AssetDirtySet.h"
+#include "Services/BlueprintCompileCache.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/SimpleConstructionScript.h"
@@ -25,193 +28,45 @@
 #include "EdGraphSchema_K2.h"
 #include "UObject/StructOnScope.h"
 #include "Engine/Engine.h"
+#include "BlueprintCompilationManager.h"
+#include "Logging/TokenizedMessage.h"
+#include "MCPCommandHandle.h"
 
-// Blueprint Cache Implementation
-UBlueprint* FBlueprintCache::GetBlueprint(const FString& BlueprintName)
+namespace
 {
-    FScopeLock Lock(&CacheLock);
-    
-    // Update statistics
-    UpdateStats(false); // Assume miss initially
-    
-    if (TWeakObjectPtr<UBlueprint>* CachedPtr = CachedBlueprints.Find(BlueprintName))
+    /** Collect the compiler messages the last compile left on a Blueprint's nodes */
+    void CollectCompilerMessages(UBlueprint* Blueprint, TArray<FString>& OutErrors, TArray<FString>& OutWarnings)
     {
-        if (CachedPtr->IsValid())
-        {
-            // Update to hit since we found a valid entry
-            CacheStats.CacheHits++;
-            CacheStats.CacheMisses--;
-            
-            UE_LOG(LogTemp, Verbose, TEXT("FBlueprintCache: Cache hit for blueprint '%s'"), *BlueprintName);
-            return CachedPtr->Get();
-        }
-        else
+        TArray<UEdGraph*> Graphs;
+        Blueprint->GetAllGraphs(Graphs);
+        for (const UEdGraph* Graph : Graphs)
         {
-            // Remove invalid entry
-            CachedBlueprints.Remove(BlueprintName);
-            CacheStats.CachedCount = CachedBlueprints.Num();
-            UE_LOG(LogTemp, Verbose, TEXT("FBlueprintCache: Removed invalid cache entry for blueprint '%s'"), *BlueprintName);
-        }
-    }
-    
-    return nullptr;
-}
-
-void FBlueprintCache::CacheBlueprint(const FString& BlueprintName, UBlueprint* Blueprint)
-{
-    if (!Blueprint)
-    {
-        return;
-    }
-    
-    FScopeLock Lock(&CacheLock);
-    CachedBlueprints.Add(BlueprintName, Blueprint);
-    CacheStats.CachedCount = CachedBlueprints.Num();
-    UE_LOG(LogTemp, Verbose, TEXT("FBlueprintCache: Cached blueprint '%s'"), *BlueprintName);
-}
-
-void FBlueprintCache::InvalidateBlueprint(const FString& BlueprintName)
-{
-    FScopeLock Lock(&CacheLock);
-    if (CachedBlueprints.Remove(BlueprintName) > 0)
-    {
-        CacheStats.InvalidatedCount++;
-        CacheStats.CachedCount = CachedBlueprints.Num();
-        UE_LOG(LogTemp, Verbose, TEXT("FBlueprintCache: Invalidated cache for blueprint '%s'"), *BlueprintName);
-    }
-}
-
-void FBlueprintCache::ClearCache()
-{
-    FScopeLock Lock(&CacheLock);
-    int32 ClearedCount = CachedBlueprints.Num();
-    CachedBlueprints.Empty();
-    CacheStats.CachedCount = 0;
-    UE_LOG(LogTemp, Log, TEXT("FBlueprintCache: Cleared %d cached blueprints"), ClearedCount);
-}
-
-void FBlueprintCache::WarmCache(const TArray<FString>& BlueprintNames)
-{
-    UE_LOG(LogTemp, Log, TEXT("FBlueprintCache: Warming cache with %d blueprints"), BlueprintNames.Num());
-    
-    for (const FString& BlueprintName : BlueprintNames)
-    {
-        // Check if already cached
-        if (IsCached(BlueprintName))
-        {
-            continue;
+            for (const UEdGraphNode* Node : Graph->Nodes)
+            {
+                if (!Node || !Node->bHasCompilerMessage)
+                {
+                    continue;
+                }
+                
+                const FString Message = FString::Printf(TEXT("%s: %s: %s"), *Graph->GetName(),
+                    *Node->GetNodeTitle(ENodeTitleType::ListView).ToString(), *Node->ErrorMsg);
+                if (Node->ErrorType <= EMessageSeverity::Error)
+                {
+                    OutErrors.Add(Message);
+                }
+                else if (Node->ErrorType <= EMessageSeverity::Warning)
+                {
+                    OutWarnings.Add(Message);
+                }
+            }
         }
         
-        // Try to find and cache the blueprint
-        UBlueprint* FoundBlueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
-        if (FoundBlueprint)
-        {
-            CacheBlueprint(BlueprintName, FoundBlueprint);
-            UE_LOG(LogTemp, Verbose, TEXT("FBlueprintCache: Warmed cache with blueprint '%s'"), *BlueprintName);
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("FBlueprintCache: Could not find blueprint '%s' for cache warming"), *BlueprintName);
-        }
-    }
-    
-    UE_LOG(LogTemp, Log, TEXT("FBlueprintCache: Cache warming complete. %d blueprints cached"), GetCachedCount());
-}
-
-void FBlueprintCache::WarmCacheWithCommonBlueprints()
-{
-    UE_LOG(LogTemp, Log, TEXT("FBlueprintCache: Warming cache with common blueprints"));
-    
-    // Common blueprint names that are frequently used
-    TArray<FString> CommonBlueprints = {
-        TEXT("BP_PlayerController"),
-        TEXT("BP_GameMode"),
-        TEXT("BP_GameState"),
-        TEXT("BP_PlayerState"),
-        TEXT("BP_Character"),
-        TEXT("BP_Pawn"),
-        TEXT("BP_Actor"),
-        TEXT("BP_HUD"),
-        TEXT("BP_Widget"),
-        TEXT("BP_UserWidget"),
-        TEXT("ThirdPersonCharacter"),
-        TEXT("BP_ThirdPersonCharacter"),
-        TEXT("FirstPersonCharacter"),
-        TEXT("BP_FirstPersonCharacter")
-    };
-    
-    WarmCache(CommonBlueprints);
-}
-
-FBlueprintCacheStats FBlueprintCache::GetCacheStats() const
-{
-    FScopeLock Lock(&CacheLock);
-    FBlueprintCacheStats StatsCopy = CacheStats;
-    StatsCopy.CachedCount = CachedBlueprints.Num();
-    return StatsCopy;
-}
-
-void FBlueprintCache::ResetCacheStats()
-{
-    FScopeLock Lock(&CacheLock);
-    CacheStats.Reset();
-    CacheStats.CachedCount = CachedBlueprints.Num();
-    UE_LOG(LogTemp, Log, TEXT("FBlueprintCache: Cache statistics reset"));
-}
-
-int32 FBlueprintCache::GetCachedCount() const
-{
-    FScopeLock Lock(&CacheLock);
-    return CachedBlueprints.Num();
-}
-
-bool FBlueprintCache::IsCached(const FString& BlueprintName) const
-{
-    FScopeLock Lock(&CacheLock);
-    
-    if (const TWeakObjectPtr<UBlueprint>* CachedPtr = CachedBlueprints.Find(BlueprintName))
-    {
-        return CachedPtr->IsValid();
-    }
-    
-    return false;
-}
-
-void FBlueprintCache::UpdateStats(bool bWasHit) const
-{
-    // This method assumes the lock is already held
-    CacheStats.TotalRequests++;
-    if (bWasHit)
-    {
-        CacheStats.CacheHits++;
-    }
-    else
-    {
-        CacheStats.CacheMisses++;
-    }
-}
-
-int32 FBlueprintCache::CleanupInvalidEntries()
-{
-    // This method assumes the lock is already held
-    int32 CleanedCount = 0;
-    
-    for (auto It = CachedBlueprints.CreateIterator(); It; ++It)
-    {
-        if (!It.Value().IsValid())
+        // Errors such as a missing parent class are not attached to any node
+        if (Blueprint->Status == BS_Error && OutErrors.Num() == 0)
         {
-            It.RemoveCurrent();
-            CleanedCount++;
+            OutErrors.Add(FString::Printf(TEXT("Blueprint '%s' failed to compile"), *Blueprint->GetName()));
         }
     }
-    
-    if (CleanedCount > 0)
-    {
-        CacheStats.CachedCount = CachedBlueprints.Num();
-        UE_LOG(LogTemp, Log, TEXT("FBlueprintCache: Cleaned up %d invalid cache entries"), CleanedCount);
-    }
-    
-    return CleanedCount;
 }
 
 // Blueprint Service Implementation
@@ -252,7 +107,7 @@ UBlueprint* FBlueprintService::CreateBlueprint(const FBlueprintCreationParams& P
         UBlueprint* ExistingBlueprint = Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(FullAssetPath));
         if (ExistingBlueprint)
         {
-            BlueprintCache.CacheBlueprint(Params.Name, ExistingBlueprint);
+            FObjectResolutionCache::Get().Store(EResolvedObjectKind::Blueprint, Params.Name, ExistingBlueprint);
         }
         return ExistingBlueprint;
     }
@@ -314,18 +169,11 @@ UBlueprint* FBlueprintService::CreateBlueprint(const FBlueprintCreationParams& P
         }
     }
     
-    // Save the asset
-    if (UEditorAssetLibrary::SaveLoadedAsset(NewBlueprint))
-    {
-        UE_LOG(LogTemp, Log, TEXT("FBlueprintService::CreateBlueprint: Successfully saved blueprint '%s'"), *FullAssetPath);
-    }
-    else
-    {
-        UE_LOG(LogTemp, Warning, TEXT("FBlueprintService::CreateBlueprint: Failed to save blueprint '%s'"), *FullAssetPath);
-    }
+    // Queue the save; the components and graphs usually added next are written with it
+    FAssetDirtySet::Get().MarkDirty(NewBlueprint, EPendingAssetWork::Save);
     
     // Cache the blueprint
-    BlueprintCache.CacheBlueprint(Params.Name, NewBlueprint);
+    FObjectResolutionCache::Get().Store(EResolvedObjectKind::Blueprint, Params.Name, NewBlueprint);
     
     UE_LOG(LogTemp, Log, TEXT("FBlueprintService::CreateBlueprint: Successfully created blueprint '%s'"), *Params.Name);
     return NewBlueprint;
@@ -336,12 +184,6 @@ bool FBlueprintService::AddComponentToBlueprint(UBlueprint* Blueprint, const FCo
     // Delegate to ComponentService for component operations
     bool bResult = FComponentService::Get().AddComponentToBlueprint(Blueprint, Params);
     
-    if (bResult)
-    {
-        // Invalidate cache since blueprint was modified
-        BlueprintCache.InvalidateBlueprint(Blueprint->GetName());
-    }
-    
     return bResult;
 }
 
@@ -366,7 +208,12 @@ bool FBlueprintService::CompileBlueprint(UBlueprint* Blueprint, FString& OutErro
     Blueprint->bIsRegeneratingOnLoad = false;
     
     // Compile the blueprint
+    const double CompileStartTime = FPlatformTime::Seconds();
     FKismetEditorUtilities::CompileBlueprint(Blueprint);
+    const double CompileMs = (FPlatformTime::Seconds() - CompileStartTime) * 1000.0;
+    
+    // A compile queued by an earlier mutation is now redundant
+    FAssetDirtySet::Get().NoteCompiled(Blueprint);
     
     // Log the compilation status for debugging
     FString StatusName;
@@ -416,6 +263,7 @@ bool FBlueprintService::CompileBlueprint(UBlueprint* Blueprint, FString& OutErro
         UE_LOG(LogTemp, Error, TEXT("FBlueprintService::CompileBlueprint: Compilation failed for blueprint '%s' - %s"), 
             *Blueprint->GetName(), *OutError);
         
+        FBlueprintCompileCache::Get().Invalidate(Blueprint);
         return false;
     }
     else if (Blueprint->Status == BS_UpToDateWithWarnings)
@@ -425,19 +273,109 @@ bool FBlueprintService::CompileBlueprint(UBlueprint* Blueprint, FString& OutErro
         UE_LOG(LogTemp, Warning, TEXT("FBlueprintService::CompileBlueprint: Blueprint '%s' compiled with warnings"), *Blueprint->GetName());
     }
     
-    // Invalidate cache since blueprint was modified
-    BlueprintCache.InvalidateBlueprint(Blueprint->GetName());
+    // Lets a later compile_blueprint return this result if nothing it depends on is modified
+    FBlueprintCompileCache::Get().RecordCompile(Blueprint, OutError.IsEmpty() ? TArray<FString>() : TArray<FString>{ OutError }, CompileMs);
     
     UE_LOG(LogTemp, Log, TEXT("FBlueprintService::CompileBlueprint: Successfully compiled blueprint '%s'"), *Blueprint->GetName());
     return true;
 }
 
+void FBlueprintService::CompileBlueprints(const FBlueprintBatchCompileParams& Params, FBlueprintBatchCompileResult& OutResult, const FOnBlueprintCompiled& OnCompiled)
+{
+    check(IsInGameThread());
+    
+    OutResult = FBlueprintBatchCompileResult();
+    OutResult.Results.Reserve(Params.Blueprints.Num());
+    for (UBlueprint* Blueprint : Params.Blueprints)
+    {
+        FBlueprintCompileResult& Result = OutResult.Results.AddDefaulted_GetRef();
+        Result.Name = Blueprint->GetName();
+        Result.Path = Blueprint->GetPathName();
+    }
+    
+    const double StartTime = FPlatformTime::Seconds();
+    
+    // Blueprints unchanged since their last successful compile are answered from the cache and never queued
+    TArray<int32> PendingIndices;
+    PendingIndices.Reserve(Params.Blueprints.Num());
+    FBlueprintCompileCache& CompileCache = FBlueprintCompileCache::Get();
+    for (int32 Index = 0; Index < Params.Blueprints.Num(); ++Index)
+    {
+        FBlueprintCompileRecord Record;
+        if (Params.bForce || !CompileCache.FindUpToDate(Params.Blueprints[Index], Record))
+        {
+            PendingIndices.Add(Index);
+            continue;
+        }
+        
+        FBlueprintCompileResult& Result = OutResult.Results[Index];
+        Result.Status = Record.Status;
+        Result.Warnings = Record.Warnings;
+        Result.bSkipped = true;
+        ++OutResult.SkippedCount;
+        if (OnCompiled)
+        {
+            OnCompiled(Result);
+        }
+    }
+    
+    const int32 WaveSize = Params.WaveSize > 0 ? Params.WaveSize : FMath::Max(PendingIndices.Num(), 1);
+    int32 CompiledCount = 0;
+    for (int32 WaveStart = 0; WaveStart < PendingIndices.Num(); WaveStart += WaveSize)
+    {
+        // A flush can't be interrupted, so cancellation is honoured between waves
+        if (FMCPCommandHandle::IsCurrentCancelled())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FBlueprintService::CompileBlueprints: Cancelled after %d of %d blueprints"), WaveStart, PendingIndices.Num());
+            OutResult.bCancelled = true;
+            break;
+        }
+        
+        const int32 WaveEnd = FMath::Min(WaveStart + WaveSize, PendingIndices.Num());
+        for (int32 Pending = WaveStart; Pending < WaveEnd; ++Pending)
+        {
+            FBlueprintCompilationManager::QueueForCompilation(Params.Blueprints[PendingIndices[Pending]]);
+        }
+        
+        // One flush compiles the whole wave and reinstances each affected class once
+        const double WaveStartTime = FPlatformTime::Seconds();
+        FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+        ++OutResult.WaveCount;
+        CompiledCount = WaveEnd;
+        
+        const double CompletedAtMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+        const double ShareOfWaveMs = (FPlatformTime::Seconds() - WaveStartTime) * 1000.0 / (WaveEnd - WaveStart);
+        for (int32 Pending = WaveStart; Pending < WaveEnd; ++Pending)
+        {
+            const int32 Index = PendingIndices[Pending];
+            UBlueprint* Blueprint = Params.Blueprints[Index];
+            FBlueprintCompileResult& Result = OutResult.Results[Index];
+            Result.Status = Blueprint->Status;
+            Result.CompletedAtMs = CompletedAtMs;
+            CollectCompilerMessages(Blueprint, Result.Errors, Result.Warnings);
+            
+            // A compile queued by an earlier mutation is now redundant
+            FAssetDirtySet::Get().NoteCompiled(Blueprint);
+            CompileCache.RecordCompile(Blueprint, Result.Warnings, ShareOfWaveMs);
+            
+            if (OnCompiled)
+            {
+                OnCompiled(Result);
+            }
+        }
+    }
+    
+    OutResult.CompileMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    UE_LOG(LogTemp, Log, TEXT("FBlueprintService::CompileBlueprints: Compiled %d of %d blueprints (%d skipped as unchanged) in %d wave(s) in %.1f ms"),
+        CompiledCount, Params.Blueprints.Num(), OutResult.SkippedCount, OutResult.WaveCount, OutResult.CompileMs);
+}
+
 UBlueprint* FBlueprintService::FindBlueprint(const FString& BlueprintName)
 {
     UE_LOG(LogTemp, Verbose, TEXT("FBlueprintService::FindBlueprint: Looking for blueprint '%s'"), *BlueprintName);
     
     // Check cache first
-    UBlueprint* CachedBlueprint = BlueprintCache.GetBlueprint(BlueprintName);
+    UBlueprint* CachedBlueprint = FObjectResolutionCache::Get().Find<UBlueprint>(EResolvedObjectKind::Blueprint, BlueprintName);
     if (CachedBlueprint)
     {
         UE_LOG(LogTemp, Verbose, TEXT("FBlueprintService::FindBlueprint: Found blueprint '%s' in cache"), *BlueprintName);
@@ -449,7 +387,7 @@ UBlueprint* FBlueprintService::FindBlueprint(const FString& BlueprintName)
     if (FoundBlueprint)
     {
         // Cache for future lookups
-        BlueprintCache.CacheBlueprint(BlueprintName, FoundBlueprint);
+        FObjectResolutionCache::Get().Store(EResolvedObjectKind::Blueprint, BlueprintName, FoundBlueprint);
         UE_LOG(LogTemp, Verbose, TEXT("FBlueprintService::FindBlueprint: Found and cached blueprint '%s'"), *BlueprintName);
     }
     else
@@ -545,9 +483,6 @@ bool FBlueprintService::AddVariableToBlueprint(UBlueprint* Blueprint, const FStr
     // Mark blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
     
-    // Invalidate cache since blueprint was modified
-    BlueprintCache.InvalidateBlueprint(Blueprint->GetName());
-    
     UE_LOG(LogTemp, Log, TEXT("FBlueprintService::AddVariableToBlueprint: Successfully added variable '%s'"), *VariableName);
     return true;
 }
@@ -563,7 +498,8 @@ bool FBlueprintService::SetBlueprintProperty(UBlueprint* Blueprint, const FStrin
     UE_LOG(LogTemp, Log, TEXT("FBlueprintService::SetBlueprintProperty: Setting property '%s' on blueprint '%s'"), 
         *PropertyName, *Blueprint->GetName());
     
-    // Get the blueprint's default object
+    // Get the blueprint's default object, compiling first if a deferred compile is pending
+    FAssetDirtySet::Get().EnsureCompiled(Blueprint);
     UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
     if (!DefaultObject)
     {
@@ -582,9 +518,6 @@ bool FBlueprintService::SetBlueprintProperty(UBlueprint* Blueprint, const FStrin
     // Mark blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
     
-    // Invalidate cache since blueprint was modified
-    BlueprintCache.InvalidateBlueprint(Blueprint->GetName());
-    
     UE_LOG(LogTemp, Log, TEXT("FBlueprintService::SetBlueprintProperty: Successfully set property '%s'"), *PropertyName);
     return true;
 }
@@ -811,12 +744,6 @@ bool FBlueprintService::SetPhysicsProperties(UBlueprint* Blueprint, const FStrin
     // Delegate to ComponentService for physics operations
     bool bResult = FComponentService::Get().SetPhysicsProperties(Blueprint, ComponentName, PhysicsJsonParams);
     
-    if (bResult)
-    {
-        // Invalidate cache since blueprint was modified
-        BlueprintCache.InvalidateBlueprint(Blueprint->GetName());
-    }
-    
     return bResult;
 }
 
@@ -847,6 +774,7 @@ bool FBlueprintService::GetBlueprintComponents(UBlueprint* Blueprint, TArray<TPa
     }
     
     // Get inherited components from CDO
+    FAssetDirtySet::Get().EnsureCompiled(Blueprint);
     if (Blueprint->GeneratedClass)
     {
         UObject* DefaultObject = Blueprint->GeneratedClass->GetDefaultObject();
@@ -900,12 +828,6 @@ bool FBlueprintService::SetStaticMeshProperties(UBlueprint* Blueprint, const FSt
     // Delegate to ComponentService for static mesh operations
     bool bResult = FComponentService::Get().SetStaticMeshProperties(Blueprint, ComponentName, StaticMeshPath);
     
-    if (bResult)
-    {
-        // Invalidate cache since blueprint was modified
-        BlueprintCache.InvalidateBlueprint(Blueprint->GetName());
-    }
-    
     return bResult;
 }
 
@@ -919,7 +841,8 @@ bool FBlueprintService::SetPawnProperties(UBlueprint* Blueprint, const TMap<FStr
     
     UE_LOG(LogTemp, Log, TEXT("FBlueprintService::SetPawnProperties: Setting pawn properties on blueprint '%s'"), *Blueprint->GetName());
     
-    // Get the blueprint's default object
+    // Get the blueprint's default object, compiling first if a deferred compile is pending
+    FAssetDirtySet::Get().EnsureCompiled(Blueprint);
     UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
     APawn* DefaultPawn = Cast<APawn>(DefaultObject);
     if (!DefaultPawn)
@@ -977,9 +900,6 @@ bool FBlueprintService::SetPawnProperties(UBlueprint* Blueprint, const TMap<FStr
     // Mark blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
     
-    // Invalidate cache since blueprint was modified
-    BlueprintCache.InvalidateBlueprint(Blueprint->GetName());
-    
     UE_LOG(LogTemp, Log, TEXT("FBlueprintService::SetPawnProperties: Successfully set pawn properties"));
     return true;
 }
@@ -1016,9 +936,6 @@ bool FBlueprintService::AddInterfaceToBlueprint(UBlueprint* Blueprint, const FSt
     // Mark blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
     
-    // Invalidate cache since blueprint was modified
-    BlueprintCache.InvalidateBlueprint(Blueprint->GetName());
-    
     UE_LOG(LogTemp, Log, TEXT("FBlueprintService::AddInterfaceToBlueprint: Successfully added interface '%s'"), *InterfaceName);
     return true;
 }
@@ -1085,18 +1002,11 @@ UBlueprint* FBlueprintService::CreateBlueprintInterface(const FString& Interface
     // Mark the package dirty
     Package->MarkPackageDirty();
     
-    // Save the asset
-    if (UEditorAssetLibrary::SaveLoadedAsset(NewInterface))
-    {
-        UE_LOG(LogTemp, Log, TEXT("FBlueprintService::CreateBlueprintInterface: Successfully saved interface '%s'"), *FullAssetPath);
-    }
-    else
-    {
-        UE_LOG(LogTemp, Warning, TEXT("FBlueprintService::CreateBlueprintInterface: Failed to save interface '%s'"), *FullAssetPath);
-    }
+    // Queue the save
+    FAssetDirtySet::Get().MarkDirty(NewInterface, EPendingAssetWork::Save);
     
     // Cache the interface
-    BlueprintCache.CacheBlueprint(InterfaceName, NewInterface);
+    FObjectResolutionCache::Get().Store(EResolvedObjectKind::Blueprint, InterfaceName, NewInterface);
     
     UE_LOG(LogTemp, Log, TEXT("FBlueprintService::CreateBlueprintInterface: Successfully created interface '%s'"), *InterfaceName);
     return NewInterface;
@@ -1306,9 +1216,6 @@ bool FBlueprintService::CreateCustomBlueprintFunction(UBlueprint* Blueprint, con
     // Mark blueprint as structurally modified
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
     
-    // Invalidate cache since blueprint was modified
-    BlueprintCache.InvalidateBlueprint(Blueprint->GetName());
-    
     UE_LOG(LogTemp, Log, TEXT("FBlueprintService::CreateCustomBlueprintFunction: Successfully created function '%s' with parameters"), *FunctionName);
     return true;
 }
@@ -1332,7 +1239,8 @@ bool FBlueprintService::SpawnBlueprintActor(UBlueprint* Blueprint, const FString
         return false;
     }
     
-    // Get the blueprint's generated class
+    // Get the blueprint's generated class, compiling first if a deferred compile is pending
+    FAssetDirtySet::Get().EnsureCompiled(Blueprint);
     UClass* BlueprintClass = Blueprint->GeneratedClass;
     if (!BlueprintClass)
     {
@@ -1367,7 +1275,8 @@ bool FBlueprintService::CallBlueprintFunction(UBlueprint* Blueprint, const FStri
     UE_LOG(LogTemp, Log, TEXT("FBlueprintService::CallBlueprintFunction: Calling function '%s' on blueprint '%s'"), 
         *FunctionName, *Blueprint->GetName());
     
-    // Get the blueprint's generated class
+    // Get the blueprint's generated class, compiling first if a deferred compile is pending
+    FAssetDirtySet::Get().EnsureCompiled(Blueprint);
     UClass* BlueprintClass = Blueprint->GeneratedClass;
     if (!BlueprintClass)
     {
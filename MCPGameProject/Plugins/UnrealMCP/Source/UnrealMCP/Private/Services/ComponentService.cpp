@@ -1,6 +1,8 @@
 #include "Services/ComponentService.h"
 #include "Services/IPropertyService.h"
 #include "Services/PropertyService.h"
+#include "Services/ObjectResolutionCache.h"
+#include "Services/AssetDirtySet.h"
 #include "Engine/Blueprint.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
@@ -19,310 +21,6 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "GameFramework/Actor.h"
 
-// Component Type Cache Implementation
-UClass* FComponentTypeCache::GetComponentClass(const FString& ComponentType)
-{
-    FScopeLock Lock(&CacheLock);
-    
-    // Update statistics
-    UpdateStats(false); // Assume miss initially
-    
-    if (TWeakObjectPtr<UClass>* CachedPtr = CachedComponentClasses.Find(ComponentType))
-    {
-        if (CachedPtr->IsValid())
-        {
-            // Update to hit since we found a valid entry
-            CacheStats.CacheHits++;
-            CacheStats.CacheMisses--;
-            
-            UE_LOG(LogTemp, Verbose, TEXT("FComponentTypeCache: Cache hit for component type '%s'"), *ComponentType);
-            return CachedPtr->Get();
-        }
-        else
-        {
-            // Remove invalid entry
-            CachedComponentClasses.Remove(ComponentType);
-            CacheStats.CachedCount = CachedComponentClasses.Num();
-            UE_LOG(LogTemp, Verbose, TEXT("FComponentTypeCache: Removed invalid cache entry for component type '%s'"), *ComponentType);
-        }
-    }
-    
-    // Try lazy loading
-    UClass* LoadedClass = LazyLoadComponentClass(ComponentType);
-    if (LoadedClass)
-    {
-        // Cache the loaded class
-        CachedComponentClasses.Add(ComponentType, LoadedClass);
-        CacheStats.CachedCount = CachedComponentClasses.Num();
-        
-        // Update to hit since we successfully loaded
-        CacheStats.CacheHits++;
-        CacheStats.CacheMisses--;
-        
-        UE_LOG(LogTemp, Verbose, TEXT("FComponentTypeCache: Lazy loaded and cached component type '%s'"), *ComponentType);
-    }
-    
-    return LoadedClass;
-}
-
-void FComponentTypeCache::CacheComponentClass(const FString& ComponentType, UClass* ComponentClass)
-{
-    if (!ComponentClass)
-    {
-        return;
-    }
-    
-    FScopeLock Lock(&CacheLock);
-    CachedComponentClasses.Add(ComponentType, ComponentClass);
-    CacheStats.CachedCount = CachedComponentClasses.Num();
-    UE_LOG(LogTemp, Verbose, TEXT("FComponentTypeCache: Cached component type '%s'"), *ComponentType);
-}
-
-void FComponentTypeCache::RefreshCache()
-{
-    FScopeLock Lock(&CacheLock);
-    
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Refreshing cache"));
-    
-    // Clear invalid entries
-    int32 CleanedCount = 0;
-    for (auto It = CachedComponentClasses.CreateIterator(); It; ++It)
-    {
-        if (!It.Value().IsValid())
-        {
-            It.RemoveCurrent();
-            CleanedCount++;
-        }
-    }
-    
-    CacheStats.RefreshCount++;
-    CacheStats.CachedCount = CachedComponentClasses.Num();
-    bNeedsRefresh = false;
-    
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Cache refresh complete. Cleaned %d invalid entries. %d types cached"), 
-        CleanedCount, CacheStats.CachedCount);
-}
-
-void FComponentTypeCache::PreloadCommonComponentTypes()
-{
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Preloading common component types"));
-    
-    // Common component types that are frequently used
-    TArray<FString> CommonComponentTypes = {
-        TEXT("StaticMeshComponent"),
-        TEXT("PointLightComponent"),
-        TEXT("SpotLightComponent"),
-        TEXT("DirectionalLightComponent"),
-        TEXT("BoxComponent"),
-        TEXT("SphereComponent"),
-        TEXT("CapsuleComponent"),
-        TEXT("CameraComponent"),
-        TEXT("AudioComponent"),
-        TEXT("SceneComponent"),
-        TEXT("BillboardComponent"),
-        TEXT("StaticMesh"),
-        TEXT("PointLight"),
-        TEXT("SpotLight"),
-        TEXT("DirectionalLight"),
-        TEXT("Box"),
-        TEXT("Sphere"),
-        TEXT("Capsule"),
-        TEXT("Camera"),
-        TEXT("Audio"),
-        TEXT("Scene"),
-        TEXT("Billboard")
-    };
-    
-    int32 PreloadedCount = 0;
-    for (const FString& ComponentType : CommonComponentTypes)
-    {
-        if (!IsCached(ComponentType))
-        {
-            UClass* ComponentClass = GetComponentClass(ComponentType);
-            if (ComponentClass)
-            {
-                PreloadedCount++;
-                UE_LOG(LogTemp, Verbose, TEXT("FComponentTypeCache: Preloaded component type '%s'"), *ComponentType);
-            }
-        }
-    }
-    
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Preloading complete. %d component types preloaded"), PreloadedCount);
-}
-
-bool FComponentTypeCache::IsCached(const FString& ComponentType) const
-{
-    FScopeLock Lock(&CacheLock);
-    
-    if (const TWeakObjectPtr<UClass>* CachedPtr = CachedComponentClasses.Find(ComponentType))
-    {
-        return CachedPtr->IsValid();
-    }
-    
-    return false;
-}
-
-void FComponentTypeCache::ClearCache()
-{
-    FScopeLock Lock(&CacheLock);
-    int32 ClearedCount = CachedComponentClasses.Num();
-    CachedComponentClasses.Empty();
-    CacheStats.CachedCount = 0;
-    bNeedsRefresh = false;
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Cleared %d cached component types"), ClearedCount);
-}
-
-FComponentTypeCacheStats FComponentTypeCache::GetCacheStats() const
-{
-    FScopeLock Lock(&CacheLock);
-    FComponentTypeCacheStats StatsCopy = CacheStats;
-    StatsCopy.CachedCount = CachedComponentClasses.Num();
-    return StatsCopy;
-}
-
-void FComponentTypeCache::ResetCacheStats()
-{
-    FScopeLock Lock(&CacheLock);
-    CacheStats.Reset();
-    CacheStats.CachedCount = CachedComponentClasses.Num();
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Cache statistics reset"));
-}
-
-int32 FComponentTypeCache::GetCachedCount() const
-{
-    FScopeLock Lock(&CacheLock);
-    return CachedComponentClasses.Num();
-}
-
-void FComponentTypeCache::UpdateStats(bool bWasHit) const
-{
-    // This method assumes the lock is already held
-    CacheStats.TotalRequests++;
-    if (bWasHit)
-    {
-        CacheStats.CacheHits++;
-    }
-    else
-    {
-        CacheStats.CacheMisses++;
-    }
-}
-
-UClass* FComponentTypeCache::LazyLoadComponentClass(const FString& ComponentType)
-{
-    // This method assumes the lock is already held
-    return ResolveComponentClassInternal(ComponentType);
-}
-
-TMap<FString, FString> FComponentTypeCache::GetSupportedComponentTypes() const
-{
-    static TMap<FString, FString> SupportedTypes;
-    
-    if (SupportedTypes.Num() == 0)
-    {
-        // Initialize supported component types mapping
-        SupportedTypes.Add(TEXT("StaticMesh"), TEXT("StaticMeshComponent"));
-        SupportedTypes.Add(TEXT("StaticMeshComponent"), TEXT("StaticMeshComponent"));
-        SupportedTypes.Add(TEXT("PointLight"), TEXT("PointLightComponent"));
-        SupportedTypes.Add(TEXT("PointLightComponent"), TEXT("PointLightComponent"));
-        SupportedTypes.Add(TEXT("SpotLight"), TEXT("SpotLightComponent"));
-        SupportedTypes.Add(TEXT("SpotLightComponent"), TEXT("SpotLightComponent"));
-        SupportedTypes.Add(TEXT("DirectionalLight"), TEXT("DirectionalLightComponent"));
-        SupportedTypes.Add(TEXT("DirectionalLightComponent"), TEXT("DirectionalLightComponent"));
-        SupportedTypes.Add(TEXT("Box"), TEXT("BoxComponent"));
-        SupportedTypes.Add(TEXT("BoxComponent"), TEXT("BoxComponent"));
-        SupportedTypes.Add(TEXT("Sphere"), TEXT("SphereComponent"));
-        SupportedTypes.Add(TEXT("SphereComponent"), TEXT("SphereComponent"));
-        SupportedTypes.Add(TEXT("Capsule"), TEXT("CapsuleComponent"));
-        SupportedTypes.Add(TEXT("CapsuleComponent"), TEXT("CapsuleComponent"));
-        SupportedTypes.Add(TEXT("Camera"), TEXT("CameraComponent"));
-        SupportedTypes.Add(TEXT("CameraComponent"), TEXT("CameraComponent"));
-        SupportedTypes.Add(TEXT("Audio"), TEXT("AudioComponent"));
-        SupportedTypes.Add(TEXT("AudioComponent"), TEXT("AudioComponent"));
-        SupportedTypes.Add(TEXT("Scene"), TEXT("SceneComponent"));
-        SupportedTypes.Add(TEXT("SceneComponent"), TEXT("SceneComponent"));
-        SupportedTypes.Add(TEXT("Billboard"), TEXT("BillboardComponent"));
-        SupportedTypes.Add(TEXT("BillboardComponent"), TEXT("BillboardComponent"));
-    }
-    
-    return SupportedTypes;
-}
-
-UClass* FComponentTypeCache::ResolveComponentClassInternal(const FString& ComponentType) const
-{
-    // Get the mapped component type
-    TMap<FString, FString> SupportedTypes = GetSupportedComponentTypes();
-    const FString* MappedType = SupportedTypes.Find(ComponentType);
-    FString ActualComponentType = MappedType ? *MappedType : ComponentType;
-    
-    // Try direct class lookups for common components
-    if (ActualComponentType == TEXT("StaticMeshComponent"))
-    {
-        return UStaticMeshComponent::StaticClass();
-    }
-    else if (ActualComponentType == TEXT("PointLightComponent"))
-    {
-        return UPointLightComponent::StaticClass();
-    }
-    else if (ActualComponentType == TEXT("SpotLightComponent"))
-    {
-        return USpotLightComponent::StaticClass();
-    }
-    else if (ActualComponentType == TEXT("DirectionalLightComponent"))
-    {
-        return UDirectionalLightComponent::StaticClass();
-    }
-    else if (ActualComponentType == TEXT("BoxComponent"))
-    {
-        return UBoxComponent::StaticClass();
-    }
-    else if (ActualComponentType == TEXT("SphereComponent"))
-    {
-        return USphereComponent::StaticClass();
-    }
-    else if (ActualComponentType == TEXT("CapsuleComponent"))
-    {
-        return UCapsuleComponent::StaticClass();
-    }
-    else if (ActualComponentType == TEXT("CameraComponent"))
-    {
-        return UCameraComponent::StaticClass();
-    }
-    else if (ActualComponentType == TEXT("AudioComponent"))
-    {
-        return UAudioComponent::StaticClass();
-    }
-    else if (ActualComponentType == TEXT("SceneComponent"))
-    {
-        return USceneComponent::StaticClass();
-    }
-    else if (ActualComponentType == TEXT("BillboardComponent"))
-    {
-        return UBillboardComponent::StaticClass();
-    }
-    
-    // Try loading from Engine module
-    FString EnginePath = FString::Printf(TEXT("/Script/Engine.%s"), *ActualComponentType);
-    UClass* ComponentClass = LoadObject<UClass>(nullptr, *EnginePath);
-    
-    if (!ComponentClass)
-    {
-        // Try with U prefix
-        FString WithUPrefix = FString::Printf(TEXT("U%s"), *ActualComponentType);
-        EnginePath = FString::Printf(TEXT("/Script/Engine.%s"), *WithUPrefix);
-        ComponentClass = LoadObject<UClass>(nullptr, *EnginePath);
-    }
-    
-    // Verify that the class is a valid component type
-    if (ComponentClass && !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Class '%s' is not a component type"), *ActualComponentType);
-        return nullptr;
-    }
-    
-    return ComponentClass;
-}
-
 FComponentService& FComponentService::Get()
 {
     static FComponentService Instance;
@@ -458,7 +156,8 @@ UObject* FComponentService::FindComponentInBlueprint(UBlueprint* Blueprint, cons
         }
     }
     
-    // Search inherited components on the CDO
+    // Search inherited components on the CDO, compiling first if a deferred compile is pending
+    FAssetDirtySet::Get().EnsureCompiled(Blueprint);
     UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
     AActor* DefaultActor = Cast<AActor>(DefaultObject);
     if (DefaultActor)
@@ -500,7 +199,8 @@ TArray<TPair<FString, FString>> FComponentService::GetBlueprintComponents(UBluep
         }
     }
     
-    // Get inherited components from CDO
+    // Get inherited components from CDO, compiling first if a deferred compile is pending
+    FAssetDirtySet::Get().EnsureCompiled(Blueprint);
     UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
     AActor* DefaultActor = Cast<AActor>(DefaultObject);
     if (DefaultActor)
@@ -544,7 +244,17 @@ bool FComponentService::IsValidComponentType(const FString& ComponentType)
 
 UClass* FComponentService::GetComponentClass(const FString& ComponentType)
 {
-    return ComponentTypeCache.GetComponentClass(ComponentType);
+    // Component types share the class table with other class lookups, so their keys are prefixed
+    const FString CacheKey = TEXT("Component:") + ComponentType;
+    FObjectResolutionCache& ResolutionCache = FObjectResolutionCache::Get();
+    if (UClass* CachedClass = ResolutionCache.Find<UClass>(EResolvedObjectKind::Class, CacheKey))
+    {
+        return CachedClass;
+    }
+    
+    UClass* ComponentClass = ResolveComponentClass(ComponentType);
+    ResolutionCache.Store(EResolvedObjectKind::Class, CacheKey, ComponentClass);
+    return ComponentClass;
 }
 
 TMap<FString, FString> FComponentService::GetSupportedComponentTypes() const
@@ -7,10 +7,138 @@
 #include "AssetToolsModule.h"
 #include "JsonObjectConverter.h"
 #include "Utils/UnrealMCPCommonUtils.h"
+#include "Services/ObjectResolutionCache.h"
+#include "Services/AssetDirtySet.h"
+#include "Services/StructSchemaCache.h"
 #include "Editor.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 #include "UObject/MetaData.h"
 #include "ScopedTransaction.h"
+#include "MCPCommandHandle.h"
+#include "DataTableUtils.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/StructOnScope.h"
+
+namespace
+{
+    /** Rows processed between cancellation checks and progress reports */
+    constexpr int32 RowChunkSize = 4096;
+    
+    /** Exported characters buffered before they are written to the output file */
+    constexpr int32 ExportFlushChars = 1 << 20;
+    
+    /** Call Visitor with each line of Text, without the line feed */
+    void VisitLines(const FString& Text, TFunctionRef<void(FStringView)> Visitor)
+    {
+        const TCHAR* LineStart = *Text;
+        const TCHAR* TextEnd = LineStart + Text.Len();
+        while (LineStart < TextEnd)
+        {
+            const TCHAR* LineEnd = LineStart;
+            while (LineEnd < TextEnd && *LineEnd != TEXT('\n'))
+            {
+                ++LineEnd;
+            }
+            Visitor(FStringView(LineStart, UE_PTRDIFF_TO_INT32(LineEnd - LineStart)));
+            LineStart = LineEnd + 1;
+        }
+    }
+    
+    /** @return true if Record ends inside a quoted CSV field, i.e. the record continues on the next line */
+    bool EndsInsideQuotes(FStringView Record)
+    {
+        // An escaped quote ("") toggles twice, so counting quotes is enough
+        bool bInQuotes = false;
+        for (const TCHAR Char : Record)
+        {
+            bInQuotes ^= (Char == TEXT('"'));
+        }
+        return bInQuotes;
+    }
+    
+    /**
+     * Split one CSV record into unquoted fields, reusing the strings already in OutFields
+     * @return Number of fields in the record
+     */
+    int32 ParseCsvRecord(FStringView Record, TArray<FString>& OutFields)
+    {
+        int32 NumFields = 0;
+        auto NextField = [&OutFields, &NumFields]() -> FString&
+        {
+            if (NumFields == OutFields.Num())
+            {
+                OutFields.AddDefaulted();
+            }
+            FString& Field = OutFields[NumFields++];
+            Field.Reset();
+            return Field;
+        };
+        
+        FString* Field = &NextField();
+        bool bInQuotes = false;
+        for (int32 Index = 0; Index < Record.Len(); ++Index)
+        {
+            const TCHAR Char = Record[Index];
+            if (bInQuotes)
+            {
+                if (Char != TEXT('"'))
+                {
+                    Field->AppendChar(Char);
+                }
+                else if (Index + 1 < Record.Len() && Record[Index + 1] == TEXT('"'))
+                {
+                    Field->AppendChar(TEXT('"'));
+                    ++Index;
+                }
+                else
+                {
+                    bInQuotes = false;
+                }
+            }
+            else if (Char == TEXT('"'))
+            {
+                bInQuotes = true;
+            }
+            else if (Char == TEXT(','))
+            {
+                Field = &NextField();
+            }
+            else
+            {
+                Field->AppendChar(Char);
+            }
+        }
+        return NumFields;
+    }
+    
+    /** Append Value to Out as a CSV field, quoted if it contains a comma, quote or line break */
+    void AppendCsvField(FString& Out, const FString& Value)
+    {
+        int32 Index;
+        if (!Value.FindChar(TEXT(','), Index) && !Value.FindChar(TEXT('"'), Index) && !Value.FindChar(TEXT('\n'), Index) && !Value.FindChar(TEXT('\r'), Index))
+        {
+            Out += Value;
+            return;
+        }
+        
+        Out.AppendChar(TEXT('"'));
+        Out += Value.Replace(TEXT("\""), TEXT("\"\""));
+        Out.AppendChar(TEXT('"'));
+    }
+    
+    void WriteUtf8(FArchive& Writer, const FString& Text)
+    {
+        FTCHARToUTF8 Utf8Text(*Text, Text.Len());
+        Writer.Serialize(const_cast<uint8*>(reinterpret_cast<const uint8*>(Utf8Text.Get())), Utf8Text.Length());
+    }
+}
 
 FDataTableService::FDataTableService()
 {
@@ -56,6 +184,34 @@ bool FDataTableRowParams::IsValid(const UDataTable* DataTable, FString& OutError
     return true;
 }
 
+bool FDataTableImportParams::IsValid(FString& OutError) const
+{
+    if (Data.IsEmpty() && FilePath.IsEmpty())
+    {
+        OutError = TEXT("Either data or file_path must be provided");
+        return false;
+    }
+    
+    if (!FilePath.IsEmpty() && !FPaths::FileExists(FilePath))
+    {
+        OutError = FString::Printf(TEXT("File not found: %s"), *FilePath);
+        return false;
+    }
+    
+    return true;
+}
+
+bool FDataTableExportParams::IsValid(FString& OutError) const
+{
+    if (FilePath.IsEmpty() && (Limit < 1 || Limit > MaxLimit))
+    {
+        OutError = FString::Printf(TEXT("limit must be between 1 and %d"), MaxLimit);
+        return false;
+    }
+    
+    return true;
+}
+
 UDataTable* FDataTableService::CreateDataTable(const FDataTableCreationParams& Params)
 {
     FString ValidationError;
@@ -126,6 +282,12 @@ UDataTable* FDataTableService::CreateDataTable(const FDataTableCreationParams& P
 
 UDataTable* FDataTableService::FindDataTable(const FString& DataTableName)
 {
+    FObjectResolutionCache& ResolutionCache = FObjectResolutionCache::Get();
+    if (UDataTable* CachedTable = ResolutionCache.Find<UDataTable>(EResolvedObjectKind::DataTable, DataTableName))
+    {
+        return CachedTable;
+    }
+    
     // Try multiple path variations to find the datatable
     TArray<FString> PathVariations;
     PathVariations.Add(FUnrealMCPCommonUtils::BuildGamePath(FString::Printf(TEXT("Data/%s"), *DataTableName)));
@@ -140,6 +302,7 @@ UDataTable* FDataTableService::FindDataTable(const FString& DataTableName)
         if (FoundTable)
         {
             UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Successfully found DataTable at: '%s'"), *Path);
+            ResolutionCache.Store(EResolvedObjectKind::DataTable, DataTableName, FoundTable);
             return FoundTable;
         }
     }
@@ -166,8 +329,18 @@ bool FDataTableService::AddRowsToDataTable(UDataTable* DataTable, const TArray<F
     OutAddedRows.Empty();
     OutFailedRows.Empty();
     
+    // GUID property names are mapped to struct property names through the cached schema
+    const TSharedRef<const FStructSchema> Schema = FStructSchemaCache::Get().GetSchema(RowStruct);
+    
     for (const FDataTableRowParams& RowParams : Rows)
     {
+        // Rows applied so far stay in memory; the save below is skipped for a cancelled command
+        if (FMCPCommandHandle::IsCurrentCancelled())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Command cancelled, stopping before row '%s'"), *RowParams.RowName);
+            break;
+        }
+        
         FString ValidationError;
         if (!RowParams.IsValid(DataTable, ValidationError))
         {
@@ -183,8 +356,7 @@ bool FDataTableService::AddRowsToDataTable(UDataTable* DataTable, const TArray<F
         }
         
         // Map GUID property names to struct property names and transform JSON
-        TMap<FString, FString> GuidToStructMap = BuildGuidToStructNameMap(RowStruct);
-        TSharedPtr<FJsonObject> StructJson = TransformJsonToStructNames(RowParams.RowData, GuidToStructMap);
+        TSharedPtr<FJsonObject> StructJson = TransformJsonToStructNames(RowParams.RowData, Schema->AuthoredNameByInternalName);
         
         // Allocate memory for the new row
         uint8* RowMemory = (uint8*)FMemory::Malloc(RowStruct->GetStructureSize());
@@ -244,8 +416,18 @@ bool FDataTableService::UpdateRowsInDataTable(UDataTable* DataTable, const TArra
     OutUpdatedRows.Empty();
     OutFailedRows.Empty();
     
+    // GUID property names are mapped to struct property names through the cached schema
+    const TSharedRef<const FStructSchema> Schema = FStructSchemaCache::Get().GetSchema(RowStruct);
+    
     for (const FDataTableRowParams& RowParams : Rows)
     {
+        // Rows applied so far stay in memory; the save below is skipped for a cancelled command
+        if (FMCPCommandHandle::IsCurrentCancelled())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Command cancelled, stopping before row '%s'"), *RowParams.RowName);
+            break;
+        }
+        
         FString ValidationError;
         if (!RowParams.IsValid(DataTable, ValidationError))
         {
@@ -268,8 +450,7 @@ bool FDataTableService::UpdateRowsInDataTable(UDataTable* DataTable, const TArra
         }
         
         // Map GUID property names to struct property names and transform JSON
-        TMap<FString, FString> GuidToStructMap = BuildGuidToStructNameMap(RowStruct);
-        TSharedPtr<FJsonObject> StructJson = TransformJsonToStructNames(RowParams.RowData, GuidToStructMap);
+        TSharedPtr<FJsonObject> StructJson = TransformJsonToStructNames(RowParams.RowData, Schema->AuthoredNameByInternalName);
         
         // Allocate memory for the new row
         uint8* RowMemory = (uint8*)FMemory::Malloc(RowStruct->GetStructureSize());
@@ -463,6 +644,448 @@ TSharedPtr<FJsonObject> FDataTableService::GetDataTableRows(const UDataTable* Da
     return ResultObj;
 }
 
+bool FDataTableService::ImportDataTableRows(UDataTable* DataTable, const FDataTableImportParams& Params, FDataTableImportResult& OutResult, FString& OutError)
+{
+    OutResult = FDataTableImportResult();
+    if (!DataTable || !DataTable->GetRowStruct())
+    {
+        OutError = TEXT("Invalid DataTable or row struct");
+        return false;
+    }
+    
+    if (!Params.IsValid(OutError))
+    {
+        return false;
+    }
+    
+    const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+    const double StartTime = FPlatformTime::Seconds();
+    
+    // Field names come from the struct's cached schema, not a reflection walk per import or per row
+    const TSharedRef<const FStructSchema> Schema = FStructSchemaCache::Get().GetSchema(RowStruct);
+    
+    // Every row is converted in this buffer, reset to the struct defaults in between, then copied into the table
+    FStructOnScope RowBuffer(RowStruct);
+    uint8* RowMemory = RowBuffer.GetStructMemory();
+    
+    // Rows are written to the row map directly, as DeleteRowsFromDataTable does, so existing
+    // rows are overwritten in place and the table change is broadcast once for the whole import
+    TMap<FName, uint8*>& RowMap = const_cast<TMap<FName, uint8*>&>(DataTable->GetRowMap());
+    
+    bool bStarted = false;
+    bool bStop = false;
+    int32 RowsInChunk = 0;
+    
+    // Deferred to the first row, so a bad CSV header leaves the table untouched
+    auto BeginRows = [&]()
+    {
+        if (!bStarted)
+        {
+            bStarted = true;
+            DataTable->Modify();
+            if (Params.bReplace)
+            {
+                DataTable->EmptyTable();
+            }
+        }
+    };
+    
+    auto StoreRow = [&](const FName RowName)
+    {
+        BeginRows();
+        uint8*& RowData = RowMap.FindOrAdd(RowName);
+        if (!RowData)
+        {
+            RowData = static_cast<uint8*>(FMemory::Malloc(RowStruct->GetStructureSize()));
+            RowStruct->InitializeStruct(RowData);
+        }
+        RowStruct->CopyScriptStruct(RowData, RowMemory);
+        ++OutResult.ImportedCount;
+    };
+    
+    auto AddError = [&OutResult](int32 LineNumber, const FString& Error)
+    {
+        ++OutResult.ErrorCount;
+        if (OutResult.Errors.Num() < FDataTableImportResult::MaxReportedErrors)
+        {
+            OutResult.Errors.Add(FString::Printf(TEXT("line %d: %s"), LineNumber, *Error));
+        }
+    };
+    
+    // Cancellation is checked, and progress reported, once per chunk of rows
+    auto EndRow = [&]()
+    {
+        if (++RowsInChunk < RowChunkSize)
+        {
+            return;
+        }
+        RowsInChunk = 0;
+        
+        if (FMCPCommandHandle::IsCurrentCancelled())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Import cancelled after %d rows"), OutResult.ImportedCount);
+            OutResult.bCancelled = true;
+            bStop = true;
+            return;
+        }
+        
+        if (FMCPCommandHandle::WantsCurrentProgress())
+        {
+            TSharedRef<FJsonObject> Progress = MakeShared<FJsonObject>();
+            Progress->SetStringField(TEXT("event"), TEXT("imported"));
+            Progress->SetNumberField(TEXT("imported"), OutResult.ImportedCount);
+            Progress->SetNumberField(TEXT("failed"), OutResult.ErrorCount);
+            Progress->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+            FMCPCommandHandle::ReportCurrentProgress(Progress);
+        }
+    };
+    
+    // JSON lines: {"row_name": "...", "row_data": {...}} as exported, or the fields next to row_name
+    FString LineText;
+    auto ImportJsonLine = [&](FStringView Line, int32 LineNumber)
+    {
+        LineText.Reset();
+        LineText.AppendChars(Line.GetData(), Line.Len());
+        TSharedPtr<FJsonObject> LineObject;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(LineText);
+        if (!FJsonSerializer::Deserialize(Reader, LineObject) || !LineObject.IsValid())
+        {
+            AddError(LineNumber, TEXT("not a JSON object"));
+            return;
+        }
+        
+        FString RowName;
+        if (!LineObject->TryGetStringField(TEXT("row_name"), RowName) || RowName.IsEmpty())
+        {
+            AddError(LineNumber, TEXT("missing row_name"));
+            return;
+        }
+        
+        const TSharedPtr<FJsonObject>* RowDataObject = nullptr;
+        const TSharedPtr<FJsonObject>& Fields = LineObject->TryGetObjectField(TEXT("row_data"), RowDataObject) ? *RowDataObject : LineObject;
+        
+        RowStruct->ClearScriptStruct(RowMemory);
+        for (const FStructSchemaField& Column : Schema->Fields)
+        {
+            // JSON field lookup ignores case, so the camelCase names get_datatable_rows exports match too
+            TSharedPtr<FJsonValue> Value = Fields->TryGetField(Column.AuthoredName);
+            if (!Value.IsValid())
+            {
+                Value = Fields->TryGetField(Column.InternalName);
+            }
+            if (!Value.IsValid() || Value->IsNull())
+            {
+                continue;
+            }
+            
+            if (!FJsonObjectConverter::JsonValueToUProperty(Value, Column.Property, Column.Property->ContainerPtrToValuePtr<void>(RowMemory)))
+            {
+                AddError(LineNumber, FString::Printf(TEXT("row '%s': field '%s' could not be converted"), *RowName, *Column.AuthoredName));
+                return;
+            }
+        }
+        StoreRow(FName(*RowName));
+    };
+    
+    // CSV: a header naming the row name column and then the fields, in any order
+    TArray<FString> CsvFields;
+    TArray<const FStructSchemaField*> CsvColumns;
+    bool bHeaderRead = false;
+    auto ImportCsvRecord = [&](FStringView Record, int32 LineNumber)
+    {
+        const int32 NumFields = ParseCsvRecord(Record, CsvFields);
+        if (!bHeaderRead)
+        {
+            bHeaderRead = true;
+            for (int32 FieldIndex = 1; FieldIndex < NumFields; ++FieldIndex)
+            {
+                const FString& Header = CsvFields[FieldIndex];
+                const FStructSchemaField* Column = Schema->FindField(Header);
+                if (!Column)
+                {
+                    OutError = FString::Printf(TEXT("Unknown column '%s' in the CSV header; the row struct %s has no such field"), *Header, *RowStruct->GetName());
+                    bStop = true;
+                    return;
+                }
+                CsvColumns.Add(Column);
+            }
+            return;
+        }
+        
+        if (NumFields != CsvColumns.Num() + 1)
+        {
+            AddError(LineNumber, FString::Printf(TEXT("expected %d fields, found %d"), CsvColumns.Num() + 1, NumFields));
+            return;
+        }
+        if (CsvFields[0].IsEmpty())
+        {
+            AddError(LineNumber, TEXT("empty row name"));
+            return;
+        }
+        
+        RowStruct->ClearScriptStruct(RowMemory);
+        for (int32 ColumnIndex = 0; ColumnIndex < CsvColumns.Num(); ++ColumnIndex)
+        {
+            // An empty cell keeps the struct default
+            const FString& Cell = CsvFields[ColumnIndex + 1];
+            if (Cell.IsEmpty())
+            {
+                continue;
+            }
+            
+            const FString CellError = DataTableUtils::AssignStringToProperty(Cell, CsvColumns[ColumnIndex]->Property, RowMemory);
+            if (!CellError.IsEmpty())
+            {
+                AddError(LineNumber, FString::Printf(TEXT("row '%s': field '%s': %s"), *CsvFields[0], *CsvColumns[ColumnIndex]->AuthoredName, *CellError));
+                return;
+            }
+        }
+        StoreRow(FName(*CsvFields[0]));
+    };
+    
+    // A quoted CSV field may contain line breaks; its record is gathered until the quotes balance
+    FString PendingRecord;
+    int32 PendingLineNumber = 0;
+    int32 LineNumber = 0;
+    auto ProcessLine = [&](FStringView Line)
+    {
+        ++LineNumber;
+        if (bStop)
+        {
+            return;
+        }
+        if (Line.Len() > 0 && Line[Line.Len() - 1] == TEXT('\r'))
+        {
+            Line.LeftChopInline(1);
+        }
+        
+        if (Params.Format == EDataTableRowFormat::Csv)
+        {
+            if (PendingLineNumber > 0)
+            {
+                PendingRecord.AppendChar(TEXT('\n'));
+                PendingRecord.AppendChars(Line.GetData(), Line.Len());
+                if (EndsInsideQuotes(PendingRecord))
+                {
+                    return;
+                }
+                ImportCsvRecord(PendingRecord, PendingLineNumber);
+                PendingLineNumber = 0;
+            }
+            else if (Line.TrimStartAndEnd().IsEmpty())
+            {
+                return;
+            }
+            else if (EndsInsideQuotes(Line))
+            {
+                PendingRecord.Reset();
+                PendingRecord.AppendChars(Line.GetData(), Line.Len());
+                PendingLineNumber = LineNumber;
+                return;
+            }
+            else
+            {
+                ImportCsvRecord(Line, LineNumber);
+            }
+        }
+        else
+        {
+            if (Line.TrimStartAndEnd().IsEmpty())
+            {
+                return;
+            }
+            ImportJsonLine(Line, LineNumber);
+        }
+        
+        if (bHeaderRead || Params.Format != EDataTableRowFormat::Csv)
+        {
+            EndRow();
+        }
+    };
+    
+    if (!Params.FilePath.IsEmpty())
+    {
+        // The file is read in blocks and handed over a line at a time, never held whole as text
+        if (!FFileHelper::LoadFileToStringWithLineVisitor(*Params.FilePath, ProcessLine) && !bStarted)
+        {
+            OutError = FString::Printf(TEXT("Failed to read %s"), *Params.FilePath);
+            return false;
+        }
+    }
+    else
+    {
+        VisitLines(Params.Data, ProcessLine);
+    }
+    
+    if (PendingLineNumber > 0 && !bStop)
+    {
+        AddError(PendingLineNumber, TEXT("unterminated quoted field"));
+    }
+    
+    // Only a bad CSV header stops the import before any row is stored
+    if (!OutError.IsEmpty())
+    {
+        return false;
+    }
+    
+    if (bStarted)
+    {
+        DataTable->HandleDataTableChanged();
+        
+        // Transient tables, e.g. the benchmark's, have no package to save
+        if (!DataTable->HasAnyFlags(RF_Transient))
+        {
+            SaveAndSyncDataTable(DataTable);
+        }
+    }
+    
+    OutResult.DurationMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Imported %d rows (%d failed) into '%s' in %.1f ms, %.0f rows/s"),
+        OutResult.ImportedCount, OutResult.ErrorCount, *DataTable->GetName(), OutResult.DurationMs, OutResult.GetRowsPerSecond());
+    return true;
+}
+
+bool FDataTableService::ExportDataTableRows(const UDataTable* DataTable, const FDataTableExportParams& Params, FDataTableExportResult& OutResult, FString& OutError)
+{
+    OutResult = FDataTableExportResult();
+    if (!DataTable || !DataTable->GetRowStruct())
+    {
+        OutError = TEXT("Invalid DataTable or row struct");
+        return false;
+    }
+    
+    if (!Params.IsValid(OutError))
+    {
+        return false;
+    }
+    
+    const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+    const double StartTime = FPlatformTime::Seconds();
+    const TSharedRef<const FStructSchema> Schema = FStructSchemaCache::Get().GetSchema(RowStruct);
+    
+    // The cursor is "<index of the next row>:<name of the last row returned>"; the name finds
+    // that spot again if rows were added or removed in between
+    const TArray<FName> RowNames = DataTable->GetRowNames();
+    OutResult.TotalRows = RowNames.Num();
+    int32 StartIndex = 0;
+    if (!Params.Cursor.IsEmpty())
+    {
+        FString IndexPart;
+        FString LastRowName;
+        if (!Params.Cursor.Split(TEXT(":"), &IndexPart, &LastRowName) || !IndexPart.IsNumeric())
+        {
+            OutError = FString::Printf(TEXT("Invalid cursor: %s"), *Params.Cursor);
+            return false;
+        }
+        
+        StartIndex = FMath::Clamp(FCString::Atoi(*IndexPart), 0, RowNames.Num());
+        const FName LastRow(*LastRowName);
+        if (!RowNames.IsValidIndex(StartIndex - 1) || RowNames[StartIndex - 1] != LastRow)
+        {
+            const int32 MovedIndex = RowNames.IndexOfByKey(LastRow);
+            if (MovedIndex != INDEX_NONE)
+            {
+                StartIndex = MovedIndex + 1;
+            }
+        }
+    }
+    
+    TUniquePtr<FArchive> FileWriter;
+    if (!Params.FilePath.IsEmpty())
+    {
+        FileWriter.Reset(IFileManager::Get().CreateFileWriter(*Params.FilePath));
+        if (!FileWriter)
+        {
+            OutError = FString::Printf(TEXT("Failed to open %s for writing"), *Params.FilePath);
+            return false;
+        }
+    }
+    const int32 EndIndex = FileWriter ? RowNames.Num() : FMath::Min(StartIndex + Params.Limit, RowNames.Num());
+    
+    FString& Out = OutResult.Data;
+    if (Params.Format == EDataTableRowFormat::Csv)
+    {
+        // The engine's own CSV export names the row name column "---"
+        Out += TEXT("---");
+        for (const FStructSchemaField& Column : Schema->Fields)
+        {
+            Out.AppendChar(TEXT(','));
+            AppendCsvField(Out, Column.AuthoredName);
+        }
+        Out.AppendChar(TEXT('\n'));
+    }
+    
+    FString RowText;
+    int32 Index = StartIndex;
+    for (; Index < EndIndex; ++Index)
+    {
+        // A file export can be long; a page never is
+        if (FileWriter && OutResult.RowCount > 0 && OutResult.RowCount % RowChunkSize == 0 && FMCPCommandHandle::IsCurrentCancelled())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Export cancelled after %d rows"), OutResult.RowCount);
+            break;
+        }
+        
+        const uint8* RowData = DataTable->FindRowUnchecked(RowNames[Index]);
+        if (!RowData)
+        {
+            continue;
+        }
+        
+        if (Params.Format == EDataTableRowFormat::Csv)
+        {
+            AppendCsvField(Out, RowNames[Index].ToString());
+            for (const FStructSchemaField& Column : Schema->Fields)
+            {
+                Out.AppendChar(TEXT(','));
+                AppendCsvField(Out, DataTableUtils::GetPropertyValueAsString(Column.Property, RowData, EDataTableExportFlags::None));
+            }
+        }
+        else
+        {
+            TSharedRef<FJsonObject> RowDataObject = MakeShared<FJsonObject>();
+            FJsonObjectConverter::UStructToJsonObject(RowStruct, RowData, RowDataObject);
+            TSharedRef<FJsonObject> RowObject = MakeShared<FJsonObject>();
+            RowObject->SetStringField(TEXT("row_name"), RowNames[Index].ToString());
+            RowObject->SetObjectField(TEXT("row_data"), RowDataObject);
+            
+            RowText.Reset();
+            TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RowText);
+            FJsonSerializer::Serialize(RowObject, Writer);
+            Out += RowText;
+        }
+        Out.AppendChar(TEXT('\n'));
+        ++OutResult.RowCount;
+        
+        if (FileWriter && Out.Len() >= ExportFlushChars)
+        {
+            WriteUtf8(*FileWriter, Out);
+            Out.Reset();
+        }
+    }
+    
+    if (FileWriter)
+    {
+        WriteUtf8(*FileWriter, Out);
+        Out.Reset();
+        if (!FileWriter->Close())
+        {
+            OutError = FString::Printf(TEXT("Failed to write %s"), *Params.FilePath);
+            return false;
+        }
+    }
+    
+    if (Index < RowNames.Num() && Index > 0)
+    {
+        OutResult.NextCursor = FString::Printf(TEXT("%d:%s"), Index, *RowNames[Index - 1].ToString());
+    }
+    
+    OutResult.DurationMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Exported %d of %d rows from '%s' in %.1f ms, %.0f rows/s"),
+        OutResult.RowCount, OutResult.TotalRows, *DataTable->GetName(), OutResult.DurationMs, OutResult.GetRowsPerSecond());
+    return true;
+}
+
 bool FDataTableService::GetDataTableRowNames(const UDataTable* DataTable, TArray<FString>& OutRowNames, TArray<FString>& OutFieldNames)
 {
     if (!DataTable)
@@ -484,10 +1107,9 @@ bool FDataTableService::GetDataTableRowNames(const UDataTable* DataTable, TArray
     const UScriptStruct* RowStruct = DataTable->GetRowStruct();
     if (RowStruct)
     {
-        for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
+        for (const FStructSchemaField& Field : FStructSchemaCache::Get().GetSchema(RowStruct)->Fields)
         {
-            FProperty* Property = *PropIt;
-            OutFieldNames.Add(Property->GetName());
+            OutFieldNames.Add(Field.InternalName);
         }
     }
     
@@ -510,12 +1132,10 @@ TSharedPtr<FJsonObject> FDataTableService::GetDataTablePropertyMap(const UDataTa
     }
     
     TSharedPtr<FJsonObject> MappingObj = MakeShared<FJsonObject>();
-    for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
+    for (const FStructSchemaField& Field : FStructSchemaCache::Get().GetSchema(RowStruct)->Fields)
     {
-        FProperty* Property = *PropIt;
-        FString InternalName = Property->GetName();
-        FString DisplayName = Property->GetAuthoredName(); // This is usually the user-facing name
-        MappingObj->SetStringField(DisplayName, InternalName);
+        // The authored name is the user-facing one
+        MappingObj->SetStringField(Field.AuthoredName, Field.InternalName);
     }
     
     return MappingObj;
@@ -606,23 +1226,6 @@ UScriptStruct* FDataTableService::FindStruct(const FString& StructName)
     return nullptr;
 }
 
-TMap<FString, FString> FDataTableService::BuildGuidToStructNameMap(const UScriptStruct* RowStruct)
-{
-    TMap<FString, FString> Map;
-    for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
-    {
-        FProperty* Property = *PropIt;
-        FString GuidName = Property->GetName(); // This is the GUID name
-        FString StructName = Property->GetAuthoredName(); // This is the original struct name
-        Map.Add(GuidName, StructName);
-        if (GuidName != StructName)
-        {
-            UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Mapping GUID property '%s' to struct property '%s'"), *GuidName, *StructName);
-        }
-    }
-    return Map;
-}
-
 TSharedPtr<FJsonObject> FDataTableService::TransformJsonToStructNames(const TSharedPtr<FJsonObject>& InJson, const TMap<FString, FString>& GuidToStructMap)
 {
     TSharedPtr<FJsonObject> OutJson = MakeShared<FJsonObject>();
@@ -678,17 +1281,18 @@ void FDataTableService::SaveAndSyncDataTable(UDataTable* DataTable)
 {
     if (DataTable)
     {
-        UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Attempting to save asset: '%s'"), *DataTable->GetPathName());
-        bool bSaved = UEditorAssetLibrary::SaveAsset(DataTable->GetPathName(), false);
-        if (bSaved)
-        {
-            UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Asset saved successfully"));
-        }
-        else
+        // Saving is the slowest step; don't start it for a client that has stopped waiting
+        if (FMCPCommandHandle::IsCurrentCancelled())
         {
-            UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Failed to save asset"));
+            UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Command cancelled, leaving '%s' dirty without saving"), *DataTable->GetPathName());
+            return;
         }
         
+        // Queue the save; consecutive row edits to one table are written once at the next flush
+        DataTable->MarkPackageDirty();
+        FAssetDirtySet::Get().MarkDirty(DataTable, EPendingAssetWork::Save);
+        UE_LOG(LogTemp, Verbose, TEXT("MCP DataTable: Queued save of '%s'"), *DataTable->GetPathName());
+        
         UEditorAssetLibrary::SyncBrowserToObjects({ DataTable->GetPathName() });
     }
 }
@@ -771,61 +1375,29 @@ void FDataTableService::FillMissingFields(const UScriptStruct* RowStruct, const
         return;
     }
     
-    UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Auto-filling missing fields for struct: '%s'"), *RowStruct->GetName());
-    
-    for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
+    int32 FilledCount = 0;
+    for (const FStructSchemaField& Field : FStructSchemaCache::Get().GetSchema(RowStruct)->Fields)
     {
-        FProperty* Property = *PropIt;
-        FString PropertyName = Property->GetName();
+        // A field may be given by its internal or its authored name
+        if (RowData->HasField(Field.InternalName) || RowData->HasField(Field.AuthoredName))
+        {
+            continue;
+        }
         
-        if (!RowData->HasField(PropertyName))
+        // Auto-fill with the struct's default value, or an empty string if it has no JSON form
+        if (Field.DefaultValue.IsValid())
         {
-            // Auto-fill with appropriate default value based on property type
-            if (Property->IsA<FBoolProperty>())
-            {
-                RowData->SetBoolField(PropertyName, false);
-                UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Auto-filled bool property '%s' with false"), *PropertyName);
-            }
-            else if (Property->IsA<FIntProperty>())
-            {
-                RowData->SetNumberField(PropertyName, 0);
-                UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Auto-filled int property '%s' with 0"), *PropertyName);
-            }
-            else if (Property->IsA<FFloatProperty>())
-            {
-                RowData->SetNumberField(PropertyName, 0.0f);
-                UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Auto-filled float property '%s' with 0.0"), *PropertyName);
-            }
-            else if (Property->IsA<FStrProperty>())
-            {
-                RowData->SetStringField(PropertyName, TEXT(""));
-                UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Auto-filled string property '%s' with empty string"), *PropertyName);
-            }
-            else if (Property->IsA<FTextProperty>())
-            {
-                RowData->SetStringField(PropertyName, TEXT(""));
-                UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Auto-filled text property '%s' with empty string"), *PropertyName);
-            }
-            else if (Property->IsA<FArrayProperty>())
-            {
-                // Create empty array for array properties
-                TArray<TSharedPtr<FJsonValue>> EmptyArray;
-                RowData->SetArrayField(PropertyName, EmptyArray);
-                UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Auto-filled array property '%s' with empty array"), *PropertyName);
-            }
-            else if (Property->IsA<FStructProperty>())
-            {
-                // For struct properties, create empty object
-                TSharedPtr<FJsonObject> EmptyStruct = MakeShared<FJsonObject>();
-                RowData->SetObjectField(PropertyName, EmptyStruct);
-                UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Auto-filled struct property '%s' with empty object"), *PropertyName);
-            }
-            else
-            {
-                // For other types, try to set a null value or empty string as fallback
-                RowData->SetStringField(PropertyName, TEXT(""));
-                UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Auto-filled unknown property type '%s' with empty string"), *PropertyName);
-            }
+            RowData->SetField(Field.InternalName, Field.DefaultValue);
         }
+        else
+        {
+            RowData->SetStringField(Field.InternalName, TEXT(""));
+        }
+        ++FilledCount;
+    }
+    
+    if (FilledCount > 0)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("MCP DataTable: Auto-filled %d missing fields of struct '%s' with defaults"), FilledCount, *RowStruct->GetName());
     }
 }
@@ -1,4 +1,6 @@
 #include "Services/EditorService.h"
+#include "Services/LevelActorIndex.h"
+#include "Services/AssetDirtySet.h"
 #include "Utils/UnrealMCPCommonUtils.h"
 #include "Editor.h"
 #include "EditorViewportClient.h"
@@ -60,35 +62,184 @@ TArray<AActor*> FEditorService::GetActorsInLevel()
     return AllActors;
 }
 
-TArray<AActor*> FEditorService::FindActorsByName(const FString& Pattern)
+bool FEditorService::QueryActorsInLevel(const FActorQueryParams& Params, FActorQueryResult& OutResult, FString& OutError)
 {
-    TArray<AActor*> AllActors = GetActorsInLevel();
-    TArray<AActor*> MatchingActors;
+    OutResult.Actors.Reset();
+    OutResult.NextCursor.Reset();
     
-    for (AActor* Actor : AllActors)
+    if (!Params.IsValid(OutError))
     {
-        if (Actor && Actor->GetName().MatchesWildcard(Pattern))
+        return false;
+    }
+    
+    UWorld* World = GetEditorWorld();
+    if (!World)
+    {
+        OutError = TEXT("Failed to get editor world");
+        return false;
+    }
+    
+    const TArray<ULevel*>& Levels = World->GetLevels();
+    
+    // The cursor is "<level index>:<actor index>:<name of the last actor returned>"; the index
+    // is where the next page starts and the name finds that spot again if actors were added
+    // or removed in between
+    int32 StartLevel = 0;
+    int32 StartActor = 0;
+    if (!Params.Cursor.IsEmpty())
+    {
+        TArray<FString> CursorParts;
+        Params.Cursor.ParseIntoArray(CursorParts, TEXT(":"), false);
+        if (CursorParts.Num() != 3 || !CursorParts[0].IsNumeric() || !CursorParts[1].IsNumeric())
         {
-            MatchingActors.Add(Actor);
+            OutError = FString::Printf(TEXT("Invalid cursor: %s"), *Params.Cursor);
+            return false;
+        }
+        StartLevel = FCString::Atoi(*CursorParts[0]);
+        StartActor = FCString::Atoi(*CursorParts[1]);
+
+        // IsNumeric accepts a sign; a negative index would read before the start of the arrays
+        if (StartLevel < 0 || StartActor < 0)
+        {
+            OutError = FString::Printf(TEXT("Invalid cursor: %s"), *Params.Cursor);
+            return false;
+        }
+
+        // Past the end just means the levels shrank since the last page; the loops below then find nothing
+        StartLevel = FMath::Min(StartLevel, Levels.Num());
+
+        const FString& LastName = CursorParts[2];
+        if (Levels.IsValidIndex(StartLevel) && Levels[StartLevel])
+        {
+            const TArray<AActor*>& LevelActors = Levels[StartLevel]->Actors;
+            const int32 LastIndex = StartActor - 1;
+            if (!LevelActors.IsValidIndex(LastIndex) || !LevelActors[LastIndex] || LevelActors[LastIndex]->GetName() != LastName)
+            {
+                const int32 MovedIndex = LevelActors.IndexOfByPredicate([&LastName](const AActor* Actor)
+                {
+                    return Actor && Actor->GetName() == LastName;
+                });
+                if (MovedIndex != INDEX_NONE)
+                {
+                    StartActor = MovedIndex + 1;
+                }
+            }
         }
     }
     
-    return MatchingActors;
+    const FName TagName = Params.Tag.IsEmpty() ? NAME_None : FName(*Params.Tag);
+    TMap<const UClass*, bool> ClassMatches;
+    int32 LastLevel = INDEX_NONE;
+    int32 LastActor = INDEX_NONE;
+    
+    for (int32 LevelIndex = StartLevel; LevelIndex < Levels.Num(); ++LevelIndex)
+    {
+        // Same levels GetAllActorsOfClass visits
+        const ULevel* Level = Levels[LevelIndex];
+        if (!Level || !Level->bIsVisible)
+        {
+            continue;
+        }
+        
+        const TArray<AActor*>& LevelActors = Level->Actors;
+        for (int32 ActorIndex = (LevelIndex == StartLevel ? StartActor : 0); ActorIndex < LevelActors.Num(); ++ActorIndex)
+        {
+            AActor* Actor = LevelActors[ActorIndex];
+            if (!IsValid(Actor) || !ActorMatchesQuery(Actor, Params, TagName, ClassMatches))
+            {
+                continue;
+            }
+            
+            if (OutResult.Actors.Num() == Params.Limit)
+            {
+                // Another match exists, so the page is not the last one
+                OutResult.NextCursor = FString::Printf(TEXT("%d:%d:%s"), LastLevel, LastActor + 1, *OutResult.Actors.Last()->GetName());
+                return true;
+            }
+            
+            OutResult.Actors.Add(Actor);
+            LastLevel = LevelIndex;
+            LastActor = ActorIndex;
+        }
+    }
+    
+    return true;
 }
 
-AActor* FEditorService::FindActorByName(const FString& ActorName)
+bool FEditorService::ActorMatchesQuery(AActor* Actor, const FActorQueryParams& Params, FName TagName, TMap<const UClass*, bool>& ClassMatches)
+{
+    // Cheapest filters first
+    if (Params.bHasBounds && !Params.Bounds.IsInsideOrOn(Actor->GetActorLocation()))
+    {
+        return false;
+    }
+    
+    if (!Params.Tag.IsEmpty() && !Actor->ActorHasTag(TagName))
+    {
+        return false;
+    }
+    
+    if (!Params.ClassName.IsEmpty())
+    {
+        const UClass* ActorClass = Actor->GetClass();
+        bool* CachedMatch = ClassMatches.Find(ActorClass);
+        if (!CachedMatch)
+        {
+            bool bMatch = false;
+            for (const UClass* Class = ActorClass; Class && !bMatch; Class = Class->GetSuperClass())
+            {
+                FString ClassName = Class->GetName();
+                bMatch = ClassName == Params.ClassName || (ClassName.RemoveFromEnd(TEXT("_C")) && ClassName == Params.ClassName);
+            }
+            CachedMatch = &ClassMatches.Add(ActorClass, bMatch);
+        }
+        if (!*CachedMatch)
+        {
+            return false;
+        }
+    }
+    
+    if (!Params.FolderPath.IsEmpty())
+    {
+        // The folder itself or any folder below it
+        const FString ActorFolder = Actor->GetFolderPath().ToString();
+        const int32 FolderLen = Params.FolderPath.Len();
+        if (!ActorFolder.StartsWith(Params.FolderPath) || (ActorFolder.Len() > FolderLen && ActorFolder[FolderLen] != TEXT('/')))
+        {
+            return false;
+        }
+    }
+    
+    if (!Params.NamePattern.IsEmpty() &&
+        !Actor->GetName().MatchesWildcard(Params.NamePattern) &&
+        !Actor->GetActorLabel().MatchesWildcard(Params.NamePattern))
+    {
+        return false;
+    }
+    
+    return true;
+}
+
+TArray<AActor*> FEditorService::FindActorsByName(const FString& Pattern)
 {
     TArray<AActor*> AllActors = GetActorsInLevel();
+    TArray<AActor*> MatchingActors;
     
     for (AActor* Actor : AllActors)
     {
-        if (Actor && Actor->GetName() == ActorName)
+        if (Actor && Actor->GetName().MatchesWildcard(Pattern))
         {
-            return Actor;
+            MatchingActors.Add(Actor);
         }
     }
     
-    return nullptr;
+    return MatchingActors;
+}
+
+AActor* FEditorService::FindActorByName(const FString& ActorName)
+{
+    // Served from the per-world name and label index instead of a scan of every actor
+    return FLevelActorIndex::Get().FindByNameOrLabel(GetEditorWorld(), ActorName);
 }
 
 UClass* FEditorService::GetActorClassFromType(const FString& TypeString) const
@@ -127,7 +278,7 @@ AActor* FEditorService::SpawnActorOfType(UClass* ActorClass, const FString& Name
     }
     
     // Check if an actor with this name already exists
-    if (FindActorByName(Name))
+    if (FLevelActorIndex::Get().FindByName(World, Name))
     {
         OutError = FString::Printf(TEXT("Actor with name '%s' already exists"), *Name);
         return nullptr;
@@ -181,7 +332,7 @@ AActor* FEditorService::SpawnBlueprintActor(const FBlueprintActorSpawnParams& Pa
     }
     
     // Check if an actor with this name already exists
-    if (FindActorByName(Params.ActorName))
+    if (FLevelActorIndex::Get().FindByName(World, Params.ActorName))
     {
         OutError = FString::Printf(TEXT("Actor with name '%s' already exists"), *Params.ActorName);
         return nullptr;
@@ -195,6 +346,8 @@ AActor* FEditorService::SpawnBlueprintActor(const FBlueprintActorSpawnParams& Pa
     FActorSpawnParameters SpawnParameters;
     SpawnParameters.Name = *Params.ActorName;
     
+    // Spawn from a generated class that includes any mutation whose compile is still deferred
+    FAssetDirtySet::Get().EnsureCompiled(Blueprint);
     AActor* NewActor = World->SpawnActor<AActor>(Blueprint->GeneratedClass, SpawnTransform, SpawnParameters);
     if (!NewActor)
     {
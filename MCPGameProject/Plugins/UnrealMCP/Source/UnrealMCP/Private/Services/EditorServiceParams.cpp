@@ -44,3 +44,20 @@ bool FBlueprintActorSpawnParams::IsValid(FString& OutError) const
     
     return true;
 }
+
+bool FActorQueryParams::IsValid(FString& OutError) const
+{
+    if (Limit < 1 || Limit > MaxLimit)
+    {
+        OutError = FString::Printf(TEXT("limit must be between 1 and %d"), MaxLimit);
+        return false;
+    }
+    
+    if (bHasBounds && !Bounds.Min.ComponentwiseAllLessOrEqual(Bounds.Max))
+    {
+        OutError = TEXT("bounds_min must not be greater than bounds_max");
+        return false;
+    }
+    
+    return true;
+}
@@ -0,0 +1,433 @@
+#include "Services/LevelActorIndex.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+
+FLevelActorIndex& FLevelActorIndex::Get()
+{
+    static FLevelActorIndex Instance;
+    return Instance;
+}
+
+void FLevelActorIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FLevelActorIndex::OnActorLabelChanged);
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FLevelActorIndex::OnLevelChanged);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FLevelActorIndex::OnLevelChanged);
+    WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FLevelActorIndex::OnWorldCleanup);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FLevelActorIndex::OnUndoRedo);
+
+    // Plugins in the default loading phase start before GEngine exists
+    if (GEngine)
+    {
+        BindEngineEvents();
+    }
+    else
+    {
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FLevelActorIndex::BindEngineEvents);
+    }
+
+    bInitialized = true;
+}
+
+void FLevelActorIndex::BindEngineEvents()
+{
+    if (PostEngineInitHandle.IsValid())
+    {
+        FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+        PostEngineInitHandle.Reset();
+    }
+
+    if (GEngine)
+    {
+        ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FLevelActorIndex::OnLevelActorAdded);
+        ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FLevelActorIndex::OnLevelActorDeleted);
+        ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FLevelActorIndex::OnLevelActorListChanged);
+    }
+
+    // Anything indexed before the engine events were bound may have missed changes
+    OnLevelActorListChanged();
+}
+
+void FLevelActorIndex::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    if (PostEngineInitHandle.IsValid())
+    {
+        FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+        PostEngineInitHandle.Reset();
+    }
+
+    // GEngine may already be gone during engine shutdown
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+        GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+    }
+    ActorAddedHandle.Reset();
+    ActorDeletedHandle.Reset();
+    ActorListChangedHandle.Reset();
+
+    FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+    FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+    ActorLabelChangedHandle.Reset();
+    LevelAddedHandle.Reset();
+    LevelRemovedHandle.Reset();
+    WorldCleanupHandle.Reset();
+    UndoRedoHandle.Reset();
+
+    Worlds.Empty();
+    IndexedActorCount.store(0, std::memory_order_relaxed);
+    IndexedWorldCount.store(0, std::memory_order_relaxed);
+    bInitialized = false;
+}
+
+AActor* FLevelActorIndex::FindByName(UWorld* World, const FString& ActorName)
+{
+    check(IsInGameThread());
+    LookupCount.fetch_add(1, std::memory_order_relaxed);
+    if (!World || ActorName.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    AActor* Found = nullptr;
+    if (FWorldActors* WorldActors = GetWorldActors(World))
+    {
+        // A name that was never turned into an FName cannot be an actor name
+        const FName NameKey(*ActorName, FNAME_Find);
+        if (!NameKey.IsNone())
+        {
+            Found = FindIndexedByName(*WorldActors, NameKey);
+            if (!Found)
+            {
+                Found = ScanByName(World, ActorName, WorldActors);
+            }
+        }
+    }
+    else
+    {
+        Found = ScanByName(World, ActorName, nullptr);
+    }
+
+    if (Found)
+    {
+        HitCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    return Found;
+}
+
+AActor* FLevelActorIndex::FindByLabel(UWorld* World, const FString& ActorLabel)
+{
+    check(IsInGameThread());
+    LookupCount.fetch_add(1, std::memory_order_relaxed);
+    if (!World || ActorLabel.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    AActor* Found = nullptr;
+    if (FWorldActors* WorldActors = GetWorldActors(World))
+    {
+        Found = FirstLive(WorldActors->ByLabel.Find(ActorLabel));
+    }
+    else
+    {
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            if (It->GetActorLabel() == ActorLabel)
+            {
+                Found = *It;
+                break;
+            }
+        }
+    }
+
+    if (Found)
+    {
+        HitCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    return Found;
+}
+
+AActor* FLevelActorIndex::FindByNameOrLabel(UWorld* World, const FString& NameOrLabel)
+{
+    check(IsInGameThread());
+    FWorldActors* WorldActors = World && !NameOrLabel.IsEmpty() ? GetWorldActors(World) : nullptr;
+    if (!WorldActors)
+    {
+        if (AActor* Actor = FindByName(World, NameOrLabel))
+        {
+            return Actor;
+        }
+        return FindByLabel(World, NameOrLabel);
+    }
+
+    // Both indexed lookups come first, so finding an actor by label never pays for the scan by name
+    LookupCount.fetch_add(1, std::memory_order_relaxed);
+    const FName NameKey(*NameOrLabel, FNAME_Find);
+    AActor* Found = NameKey.IsNone() ? nullptr : FindIndexedByName(*WorldActors, NameKey);
+    if (!Found)
+    {
+        Found = FirstLive(WorldActors->ByLabel.Find(NameOrLabel));
+    }
+    if (!Found && !NameKey.IsNone())
+    {
+        Found = ScanByName(World, NameOrLabel, WorldActors);
+    }
+
+    if (Found)
+    {
+        HitCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    return Found;
+}
+
+AActor* FLevelActorIndex::FindIndexedByName(FWorldActors& WorldActors, FName NameKey)
+{
+    // An actor renamed without a label change is still filed under its old name;
+    // move it to its current one instead of reporting it
+    AActor* Found = nullptr;
+    while ((Found = FirstLive(WorldActors.ByName.Find(NameKey))) != nullptr && Found->GetFName() != NameKey)
+    {
+        AddActor(WorldActors, Found);
+    }
+    return Found;
+}
+
+AActor* FLevelActorIndex::ScanByName(UWorld* World, const FString& ActorName, FWorldActors* WorldActors)
+{
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        if (It->GetName() == ActorName)
+        {
+            // Renaming sends no event, so an indexed actor may still be filed under its old name; file it under this one
+            if (WorldActors)
+            {
+                AddActor(*WorldActors, *It);
+            }
+            return *It;
+        }
+    }
+    return nullptr;
+}
+
+void FLevelActorIndex::MarkDirty(UWorld* World)
+{
+    if (TUniquePtr<FWorldActors>* WorldActors = Worlds.Find(World))
+    {
+        (*WorldActors)->bDirty = true;
+    }
+}
+
+FLevelActorIndexStats FLevelActorIndex::GetStats() const
+{
+    FLevelActorIndexStats Stats;
+    Stats.IndexedWorlds = IndexedWorldCount.load(std::memory_order_relaxed);
+    Stats.IndexedActors = IndexedActorCount.load(std::memory_order_relaxed);
+    Stats.Lookups = LookupCount.load(std::memory_order_relaxed);
+    Stats.Hits = HitCount.load(std::memory_order_relaxed);
+    Stats.Builds = BuildCount.load(std::memory_order_relaxed);
+    Stats.LastBuildMs = LastBuildMs.load(std::memory_order_relaxed);
+    return Stats;
+}
+
+FLevelActorIndex::FWorldActors* FLevelActorIndex::GetWorldActors(UWorld* World)
+{
+    // Without the engine events the index could not be kept current
+    if (!bInitialized || !ActorAddedHandle.IsValid() || World->WorldType != EWorldType::Editor)
+    {
+        return nullptr;
+    }
+
+    TUniquePtr<FWorldActors>& WorldActors = Worlds.FindOrAdd(World);
+    if (!WorldActors.IsValid())
+    {
+        WorldActors = MakeUnique<FWorldActors>();
+        IndexedWorldCount.store(Worlds.Num(), std::memory_order_relaxed);
+    }
+
+    if (WorldActors->bDirty)
+    {
+        Build(World, *WorldActors);
+    }
+    return WorldActors.Get();
+}
+
+void FLevelActorIndex::Build(UWorld* World, FWorldActors& WorldActors)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    IndexedActorCount.fetch_sub(WorldActors.KeysByActor.Num(), std::memory_order_relaxed);
+    WorldActors.ByName.Reset();
+    WorldActors.ByLabel.Reset();
+    WorldActors.KeysByActor.Reset();
+
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        AddActor(WorldActors, *It);
+    }
+    WorldActors.bDirty = false;
+
+    const double BuildMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    LastBuildMs.store(BuildMs, std::memory_order_relaxed);
+    BuildCount.fetch_add(1, std::memory_order_relaxed);
+
+    UE_LOG(LogTemp, Verbose, TEXT("FLevelActorIndex: Indexed %d actors of %s in %.1f ms"), WorldActors.KeysByActor.Num(), *World->GetName(), BuildMs);
+}
+
+void FLevelActorIndex::AddActor(FWorldActors& WorldActors, AActor* Actor)
+{
+    if (!IsValid(Actor))
+    {
+        return;
+    }
+
+    RemoveActor(WorldActors, Actor);
+
+    FIndexedKeys Keys;
+    Keys.Name = Actor->GetFName();
+    Keys.Label = Actor->GetActorLabel();
+
+    WorldActors.ByName.FindOrAdd(Keys.Name).Add(Actor);
+    if (!Keys.Label.IsEmpty())
+    {
+        WorldActors.ByLabel.FindOrAdd(Keys.Label).Add(Actor);
+    }
+    WorldActors.KeysByActor.Add(Actor, MoveTemp(Keys));
+    IndexedActorCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FLevelActorIndex::RemoveActor(FWorldActors& WorldActors, const AActor* Actor)
+{
+    FIndexedKeys Keys;
+    if (!WorldActors.KeysByActor.RemoveAndCopyValue(Actor, Keys))
+    {
+        return;
+    }
+    IndexedActorCount.fetch_sub(1, std::memory_order_relaxed);
+
+    auto RemoveFromList = [Actor](auto& Map, const auto& Key)
+    {
+        if (FActorList* Actors = Map.Find(Key))
+        {
+            Actors->RemoveAllSwap([Actor](const TWeakObjectPtr<AActor>& Entry)
+            {
+                // Also sweep entries whose actor is gone
+                return !Entry.IsValid() || Entry.Get() == Actor;
+            });
+            if (Actors->Num() == 0)
+            {
+                Map.Remove(Key);
+            }
+        }
+    };
+    RemoveFromList(WorldActors.ByName, Keys.Name);
+    if (!Keys.Label.IsEmpty())
+    {
+        RemoveFromList(WorldActors.ByLabel, Keys.Label);
+    }
+}
+
+AActor* FLevelActorIndex::FirstLive(const FActorList* Actors)
+{
+    if (Actors)
+    {
+        for (const TWeakObjectPtr<AActor>& Actor : *Actors)
+        {
+            if (AActor* LiveActor = Actor.Get())
+            {
+                return LiveActor;
+            }
+        }
+    }
+    return nullptr;
+}
+
+FLevelActorIndex::FWorldActors* FLevelActorIndex::FindBuiltWorldActors(const AActor* Actor)
+{
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    TUniquePtr<FWorldActors>* WorldActors = Worlds.Find(Actor->GetWorld());
+    if (!WorldActors || (*WorldActors)->bDirty)
+    {
+        // Nothing to update; a dirty index is rebuilt from scratch anyway
+        return nullptr;
+    }
+    return WorldActors->Get();
+}
+
+void FLevelActorIndex::OnLevelActorAdded(AActor* Actor)
+{
+    if (FWorldActors* WorldActors = FindBuiltWorldActors(Actor))
+    {
+        AddActor(*WorldActors, Actor);
+    }
+}
+
+void FLevelActorIndex::OnLevelActorDeleted(AActor* Actor)
+{
+    if (FWorldActors* WorldActors = FindBuiltWorldActors(Actor))
+    {
+        RemoveActor(*WorldActors, Actor);
+    }
+}
+
+void FLevelActorIndex::OnActorLabelChanged(AActor* Actor)
+{
+    // Relabeling renames the object as well, so both keys are refreshed
+    if (FWorldActors* WorldActors = FindBuiltWorldActors(Actor))
+    {
+        AddActor(*WorldActors, Actor);
+    }
+}
+
+void FLevelActorIndex::OnLevelActorListChanged()
+{
+    for (TPair<TObjectKey<UWorld>, TUniquePtr<FWorldActors>>& Pair : Worlds)
+    {
+        Pair.Value->bDirty = true;
+    }
+}
+
+void FLevelActorIndex::OnLevelChanged(ULevel* Level, UWorld* World)
+{
+    MarkDirty(World);
+}
+
+void FLevelActorIndex::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    TUniquePtr<FWorldActors> WorldActors;
+    if (Worlds.RemoveAndCopyValue(World, WorldActors))
+    {
+        IndexedActorCount.fetch_sub(WorldActors->KeysByActor.Num(), std::memory_order_relaxed);
+        IndexedWorldCount.store(Worlds.Num(), std::memory_order_relaxed);
+    }
+}
+
+void FLevelActorIndex::OnUndoRedo()
+{
+    // Undo and redo restore or remove actors without the added and deleted events
+    OnLevelActorListChanged();
+}
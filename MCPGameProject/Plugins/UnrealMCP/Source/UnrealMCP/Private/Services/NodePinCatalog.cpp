@@ -0,0 +1,424 @@
+#include "Services/NodePinCatalog.h"
+#include "MCPLogging.h"
+#include "BlueprintActionDatabase.h"
+#include "BlueprintNodeSpawner.h"
+#include "BlueprintNodeSignature.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "Modules/ModuleManager.h"
+#include "Async/Async.h"
+#include "Async/Future.h"
+
+namespace
+{
+    /** One pin of a catalog node; Names ends at the first nullptr */
+    struct FStaticPinDef
+    {
+        const TCHAR* Names[2];
+        const TCHAR* PinType;
+        const TCHAR* ExpectedType;
+        const TCHAR* Description;
+        bool bIsRequired;
+        bool bIsInput;
+    };
+
+    /** One catalog node, owning Pins[FirstPin, FirstPin + NumPins); Names ends at the first nullptr */
+    struct FStaticNodeDef
+    {
+        const TCHAR* Names[3];
+        int32 FirstPin;
+        int32 NumPins;
+    };
+
+    constexpr FStaticPinDef StaticPins[] = {
+        // Create Widget
+        { { TEXT("Class"), nullptr }, TEXT("class"), TEXT("Class<UserWidget>"), TEXT("The widget class to instantiate"), true, true },
+        { { TEXT("Owning Player"), TEXT("OwningPlayer") }, TEXT("object"), TEXT("PlayerController"), TEXT("The player controller that owns this widget"), false, true },
+        { { TEXT("Return Value"), nullptr }, TEXT("object"), TEXT("UserWidget"), TEXT("The created widget instance"), false, false },
+
+        // Get Controller
+        { { TEXT("Target"), nullptr }, TEXT("object"), TEXT("Pawn"), TEXT("The pawn to get the controller from"), true, true },
+        { { TEXT("Return Value"), nullptr }, TEXT("object"), TEXT("Controller"), TEXT("The controller possessing this pawn"), false, false },
+
+        // Cast To nodes
+        { { TEXT("Object"), nullptr }, TEXT("object"), TEXT("Object"), TEXT("The object to cast"), true, true },
+        { { TEXT("Cast Success"), nullptr }, TEXT("exec"), TEXT("exec"), TEXT("Execution path if cast succeeds"), false, false },
+        { { TEXT("Cast Failed"), nullptr }, TEXT("exec"), TEXT("exec"), TEXT("Execution path if cast fails"), false, false },
+
+        // SelectFloat (KismetMathLibrary)
+        { { TEXT("A"), nullptr }, TEXT("real"), TEXT("float"), TEXT("First float value option"), true, true },
+        { { TEXT("B"), nullptr }, TEXT("real"), TEXT("float"), TEXT("Second float value option"), true, true },
+        { { TEXT("bPickA"), TEXT("Pick A") }, TEXT("bool"), TEXT("boolean"), TEXT("If true, returns A; if false, returns B"), true, true },
+        { { TEXT("ReturnValue"), TEXT("Return Value") }, TEXT("real"), TEXT("float"), TEXT("The selected float value (A or B)"), false, false },
+
+        // RandomFloat (KismetMathLibrary)
+        { { TEXT("ReturnValue"), TEXT("Return Value") }, TEXT("real"), TEXT("float"), TEXT("Random float value between 0.0 and 1.0"), false, false },
+
+        // MultiplyByPi (KismetMathLibrary)
+        { { TEXT("Value"), nullptr }, TEXT("real"), TEXT("float"), TEXT("Value to multiply by Pi"), true, true },
+        { { TEXT("ReturnValue"), TEXT("Return Value") }, TEXT("real"), TEXT("float"), TEXT("Value multiplied by Pi"), false, false },
+
+        // Get Hidden (Actor property)
+        { { TEXT("self"), TEXT("Target") }, TEXT("object"), TEXT("Actor"), TEXT("The actor to get the hidden property from"), true, true },
+        { { TEXT("bHidden"), TEXT("Hidden") }, TEXT("bool"), TEXT("boolean"), TEXT("Whether the actor is hidden"), false, false },
+
+        // For Each Loop (Map)
+        { { TEXT("execute"), TEXT("Exec") }, TEXT("exec"), TEXT("exec"), TEXT("Execution input to start the loop"), true, true },
+        { { TEXT("MapPin"), TEXT("Map") }, TEXT("wildcard"), TEXT("Map"), TEXT("The map to iterate over"), true, true },
+        { { TEXT("then"), TEXT("Loop Body") }, TEXT("exec"), TEXT("exec"), TEXT("Execution output for each iteration"), false, false },
+        { { TEXT("KeyPin"), TEXT("Key") }, TEXT("wildcard"), TEXT("Key"), TEXT("Current key in the iteration"), false, false },
+        { { TEXT("ValuePin"), TEXT("Value") }, TEXT("wildcard"), TEXT("Value"), TEXT("Current value in the iteration"), false, false },
+        { { TEXT("CompletedPin"), TEXT("Completed") }, TEXT("exec"), TEXT("exec"), TEXT("Execution output when loop completes"), false, false },
+    };
+
+    constexpr FStaticNodeDef StaticNodes[] = {
+        { { TEXT("Create Widget"), TEXT("CreateWidget"), nullptr }, 0, 3 },
+        { { TEXT("Get Controller"), TEXT("GetController"), nullptr }, 3, 2 },
+        { { TEXT("Cast to PlayerController"), TEXT("Cast to"), nullptr }, 5, 3 },
+        { { TEXT("SelectFloat"), TEXT("Select Float"), nullptr }, 8, 4 },
+        { { TEXT("RandomFloat"), TEXT("Random Float"), nullptr }, 12, 1 },
+        { { TEXT("MultiplyByPi"), TEXT("Multiply By Pi"), nullptr }, 13, 2 },
+        { { TEXT("Get Hidden"), TEXT("GetHidden"), nullptr }, 15, 2 },
+        { { TEXT("For Each Loop (Map)"), TEXT("ForEachLoop(Map)"), TEXT("For Each Loop Map") }, 17, 6 },
+    };
+
+    static_assert(StaticNodes[UE_ARRAY_COUNT(StaticNodes) - 1].FirstPin + StaticNodes[UE_ARRAY_COUNT(StaticNodes) - 1].NumPins == UE_ARRAY_COUNT(StaticPins),
+                  "Every catalog pin must belong to exactly one catalog node");
+
+    /** @return The type a pin expects, e.g. the class of an object pin */
+    FString DescribeExpectedType(const FEdGraphPinType& PinType)
+    {
+        FString ExpectedType;
+        if (UObject* SubCategoryObject = PinType.PinSubCategoryObject.Get())
+        {
+            ExpectedType = SubCategoryObject->GetName();
+        }
+        else if (!PinType.PinSubCategory.IsNone())
+        {
+            ExpectedType = PinType.PinSubCategory.ToString();
+        }
+        else
+        {
+            ExpectedType = PinType.PinCategory.ToString();
+        }
+
+        if (PinType.IsArray())
+        {
+            return FString::Printf(TEXT("Array<%s>"), *ExpectedType);
+        }
+        if (PinType.IsSet())
+        {
+            return FString::Printf(TEXT("Set<%s>"), *ExpectedType);
+        }
+        if (PinType.IsMap())
+        {
+            return FString::Printf(TEXT("Map<%s>"), *ExpectedType);
+        }
+        return ExpectedType;
+    }
+}
+
+TSharedRef<FJsonObject> FNodePinInfo::ToJson() const
+{
+    TSharedRef<FJsonObject> PinObj = MakeShared<FJsonObject>();
+    PinObj->SetStringField(TEXT("pin_type"), PinType);
+    PinObj->SetStringField(TEXT("expected_type"), ExpectedType);
+    PinObj->SetStringField(TEXT("description"), Description);
+    PinObj->SetBoolField(TEXT("is_required"), bIsRequired);
+    PinObj->SetBoolField(TEXT("is_input"), bIsInput);
+    return PinObj;
+}
+
+const FNodePinInfo* FNodePinSet::FindPin(const FString& PinName) const
+{
+    const int32* PinIndex = PinsByKey.Find(FNodePinCatalog::NormalizeName(PinName));
+    return PinIndex ? &Pins[*PinIndex] : nullptr;
+}
+
+void FNodePinSet::AddPinName(const FString& PinName, int32 PinIndex)
+{
+    const FString Key = FNodePinCatalog::NormalizeName(PinName);
+    if (!PinsByKey.Contains(Key))
+    {
+        PinNames.Add(PinName);
+        PinsByKey.Add(Key, PinIndex);
+    }
+}
+
+FNodePinCatalog& FNodePinCatalog::Get()
+{
+    static FNodePinCatalog Instance;
+    return Instance;
+}
+
+FNodePinCatalog::FNodePinCatalog()
+{
+    for (const FStaticNodeDef& NodeDef : StaticNodes)
+    {
+        TSharedRef<FNodePinSet> PinSet = MakeShared<FNodePinSet>();
+        PinSet->NodeKey = NodeDef.Names[0];
+        PinSet->Pins.Reserve(NodeDef.NumPins);
+
+        for (int32 PinIndex = 0; PinIndex < NodeDef.NumPins; ++PinIndex)
+        {
+            const FStaticPinDef& PinDef = StaticPins[NodeDef.FirstPin + PinIndex];
+
+            FNodePinInfo& Pin = PinSet->Pins.AddDefaulted_GetRef();
+            Pin.PinType = PinDef.PinType;
+            Pin.ExpectedType = PinDef.ExpectedType;
+            Pin.Description = PinDef.Description;
+            Pin.bIsRequired = PinDef.bIsRequired;
+            Pin.bIsInput = PinDef.bIsInput;
+
+            for (const TCHAR* PinName : PinDef.Names)
+            {
+                if (PinName)
+                {
+                    PinSet->AddPinName(PinName, PinIndex);
+                }
+            }
+        }
+
+        for (const TCHAR* NodeName : NodeDef.Names)
+        {
+            if (NodeName)
+            {
+                CatalogNodes.Add(NormalizeName(NodeName), PinSet);
+                CatalogNodeNames.Add(NodeName);
+            }
+        }
+    }
+}
+
+FString FNodePinCatalog::NormalizeName(const FString& Name)
+{
+    FString Normalized;
+    Normalized.Reserve(Name.Len());
+    for (TCHAR Character : Name)
+    {
+        if (!FChar::IsWhitespace(Character))
+        {
+            Normalized.AppendChar(FChar::ToLower(Character));
+        }
+    }
+    return Normalized;
+}
+
+TSharedPtr<const FNodePinSet> FNodePinCatalog::FindNode(const FString& NodeName, bool& bOutTimedOut)
+{
+    bOutTimedOut = false;
+    const FString NormalizedName = NormalizeName(NodeName);
+    if (const TSharedPtr<const FNodePinSet>* CatalogNode = CatalogNodes.Find(NormalizedName))
+    {
+        return *CatalogNode;
+    }
+
+    if (NormalizedName.IsEmpty())
+    {
+        return nullptr;
+    }
+    if (IsInGameThread())
+    {
+        return FindTemplateNode(NormalizedName);
+    }
+
+    // get_node_pin_info runs on worker threads: cached templates are served directly, and
+    // only a name seen for the first time waits for the game thread to scan the action database
+    TSharedPtr<const FNodePinSet> CachedPins;
+    if (FindCachedTemplate(NormalizedName, CachedPins))
+    {
+        return CachedPins;
+    }
+
+    TSharedRef<TPromise<TSharedPtr<const FNodePinSet>>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<TSharedPtr<const FNodePinSet>>, ESPMode::ThreadSafe>();
+    TFuture<TSharedPtr<const FNodePinSet>> Future = Promise->GetFuture();
+    AsyncTask(ENamedThreads::GameThread, [this, Promise, NormalizedName]()
+    {
+        Promise->SetValue(FindTemplateNode(NormalizedName));
+    });
+
+    // Batch waves keep the game thread free (or pump its tasks while they wait on the pool), so this
+    // normally resolves within a frame; the timeout only guards against a game thread blocked elsewhere
+    if (!Future.WaitFor(FTimespan::FromMilliseconds(TemplateLookupTimeoutMs)))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("FNodePinCatalog: Game thread did not resolve node '%s' within %d ms"), *NormalizedName, TemplateLookupTimeoutMs);
+        bOutTimedOut = true;
+        return nullptr;
+    }
+    return Future.Get();
+}
+
+bool FNodePinCatalog::FindCachedTemplate(const FString& NormalizedName, TSharedPtr<const FNodePinSet>& OutPins)
+{
+    FScopeLock Lock(&TemplateLock);
+    if (const TSharedPtr<const FNodePinSet>* CachedPins = TemplatePinsByName.Find(NormalizedName))
+    {
+        OutPins = *CachedPins;
+        return true;
+    }
+    if (TemplateMisses.Contains(NormalizedName))
+    {
+        OutPins.Reset();
+        return true;
+    }
+    return false;
+}
+
+TSharedPtr<const FNodePinSet> FNodePinCatalog::FindTemplateNode(const FString& NormalizedName)
+{
+    check(IsInGameThread());
+
+    FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+    if (!EntryUpdatedHandle.IsValid())
+    {
+        EntryUpdatedHandle = ActionDatabase.OnEntryUpdated().AddRaw(this, &FNodePinCatalog::OnActionDatabaseChanged);
+        EntryRemovedHandle = ActionDatabase.OnEntryRemoved().AddRaw(this, &FNodePinCatalog::OnActionDatabaseChanged);
+    }
+
+    TSharedPtr<const FNodePinSet> CachedPins;
+    if (FindCachedTemplate(NormalizedName, CachedPins))
+    {
+        return CachedPins;
+    }
+
+    // Scan the action database once for this name; function calls are matched on the
+    // function name first, which is much cheaper than formatting a node title
+    const UBlueprintNodeSpawner* MatchedSpawner = nullptr;
+    UEdGraphNode* MatchedTemplate = nullptr;
+    for (const auto& ActionPair : ActionDatabase.GetAllActions())
+    {
+        for (const UBlueprintNodeSpawner* NodeSpawner : ActionPair.Value)
+        {
+            if (!NodeSpawner || !IsValid(NodeSpawner))
+            {
+                continue;
+            }
+
+            UEdGraphNode* TemplateNode = NodeSpawner->GetTemplateNode();
+            if (!TemplateNode)
+            {
+                continue;
+            }
+
+            bool bMatches = false;
+            if (const UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
+            {
+                if (const UFunction* Function = FunctionNode->GetTargetFunction())
+                {
+                    bMatches = NormalizeName(Function->GetName()) == NormalizedName
+                        || NormalizeName(UK2Node_CallFunction::GetUserFacingFunctionName(Function).ToString()) == NormalizedName;
+                }
+            }
+            else
+            {
+                bMatches = NormalizeName(TemplateNode->GetNodeTitle(ENodeTitleType::ListView).ToString()) == NormalizedName;
+            }
+
+            if (bMatches)
+            {
+                MatchedSpawner = NodeSpawner;
+                MatchedTemplate = TemplateNode;
+                break;
+            }
+        }
+
+        if (MatchedSpawner)
+        {
+            break;
+        }
+    }
+
+    FScopeLock Lock(&TemplateLock);
+    if (!MatchedSpawner)
+    {
+        if (TemplateMisses.Num() >= MaxTemplateMisses)
+        {
+            TemplateMisses.Reset();
+        }
+        TemplateMisses.Add(NormalizedName);
+        UE_LOG(LogTemp, Verbose, TEXT("FNodePinCatalog: No node template matches '%s'"), *NormalizedName);
+        return nullptr;
+    }
+
+    // Several names (title, function name) can resolve to the same node; describe it only once
+    const FGuid Signature = MatchedSpawner->GetSpawnerSignature().AsGuid();
+    TSharedPtr<const FNodePinSet> PinSet;
+    if (const TSharedPtr<const FNodePinSet>* CachedPins = TemplatePinsBySignature.Find(Signature))
+    {
+        PinSet = *CachedPins;
+    }
+    else
+    {
+        PinSet = DescribeTemplatePins(MatchedTemplate->GetNodeTitle(ENodeTitleType::ListView).ToString(), MatchedTemplate);
+        TemplatePinsBySignature.Add(Signature, PinSet);
+        UE_LOG(LogTemp, Verbose, TEXT("FNodePinCatalog: Derived %d pins for '%s' from %s"),
+               PinSet->Pins.Num(), *PinSet->NodeKey, *MatchedTemplate->GetClass()->GetName());
+    }
+
+    TemplatePinsByName.Add(NormalizedName, PinSet);
+    return PinSet;
+}
+
+TSharedRef<FNodePinSet> FNodePinCatalog::DescribeTemplatePins(const FString& NodeKey, const UEdGraphNode* TemplateNode)
+{
+    TSharedRef<FNodePinSet> PinSet = MakeShared<FNodePinSet>();
+    PinSet->NodeKey = NodeKey;
+    PinSet->bFromTemplate = true;
+
+    for (const UEdGraphPin* GraphPin : TemplateNode->Pins)
+    {
+        if (!GraphPin || GraphPin->bHidden)
+        {
+            continue;
+        }
+
+        const bool bIsInput = GraphPin->Direction == EGPD_Input;
+        const bool bIsExec = GraphPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+        const bool bHasDefault = !GraphPin->DefaultValue.IsEmpty() || GraphPin->DefaultObject != nullptr || !GraphPin->DefaultTextValue.IsEmpty();
+
+        const int32 PinIndex = PinSet->Pins.Num();
+        FNodePinInfo& Pin = PinSet->Pins.AddDefaulted_GetRef();
+        Pin.PinType = GraphPin->PinType.PinCategory.ToString();
+        Pin.ExpectedType = DescribeExpectedType(GraphPin->PinType);
+        Pin.Description = !GraphPin->PinToolTip.IsEmpty()
+            ? GraphPin->PinToolTip
+            : FString::Printf(TEXT("%s pin of %s"), bIsInput ? TEXT("Input") : TEXT("Output"), *NodeKey);
+        Pin.bIsRequired = bIsInput && (bIsExec || !bHasDefault);
+        Pin.bIsInput = bIsInput;
+
+        PinSet->AddPinName(GraphPin->PinName.ToString(), PinIndex);
+        PinSet->AddPinName(GraphPin->GetDisplayName().ToString(), PinIndex);
+    }
+
+    return PinSet;
+}
+
+void FNodePinCatalog::ClearTemplateCache()
+{
+    FScopeLock Lock(&TemplateLock);
+    TemplatePinsBySignature.Empty();
+    TemplatePinsByName.Empty();
+    TemplateMisses.Empty();
+}
+
+void FNodePinCatalog::Shutdown()
+{
+    // The action database lives in BlueprintGraph, which may already be gone during engine shutdown
+    if (EntryUpdatedHandle.IsValid() && FModuleManager::Get().IsModuleLoaded(TEXT("BlueprintGraph")))
+    {
+        FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+        ActionDatabase.OnEntryUpdated().Remove(EntryUpdatedHandle);
+        ActionDatabase.OnEntryRemoved().Remove(EntryRemovedHandle);
+    }
+    EntryUpdatedHandle.Reset();
+    EntryRemovedHandle.Reset();
+
+    ClearTemplateCache();
+}
+
+void FNodePinCatalog::OnActionDatabaseChanged(UObject* ActionKey)
+{
+    ClearTemplateCache();
+}
@@ -0,0 +1,364 @@
+#include "Services/ObjectResolutionCache.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Hash/CityHash.h"
+#include "Misc/StringBuilder.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/GarbageCollection.h"
+#include <type_traits>
+
+static_assert(sizeof(FWeakObjectPtr) == sizeof(uint64) && std::is_trivially_copyable_v<FWeakObjectPtr>,
+    "FObjectResolutionCache packs a weak object pointer into one atomic word");
+
+FObjectResolutionKindStats FObjectResolutionCacheStats::GetTotals() const
+{
+    FObjectResolutionKindStats Totals;
+    for (const FObjectResolutionKindStats& KindStats : Kinds)
+    {
+        Totals.TotalRequests += KindStats.TotalRequests;
+        Totals.CacheHits += KindStats.CacheHits;
+        Totals.CacheMisses += KindStats.CacheMisses;
+        Totals.CachedCount += KindStats.CachedCount;
+        Totals.InvalidatedCount += KindStats.InvalidatedCount;
+    }
+    return Totals;
+}
+
+FObjectResolutionCache& FObjectResolutionCache::Get()
+{
+    static FObjectResolutionCache Instance;
+    return Instance;
+}
+
+void FObjectResolutionCache::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FObjectResolutionCache::OnAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FObjectResolutionCache::OnAssetRenamed);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FObjectResolutionCache::OnReloadComplete);
+    PackageReloadedHandle = FCoreUObjectDelegates::OnPackageReloaded.AddRaw(this, &FObjectResolutionCache::OnPackageReloaded);
+    bInitialized = true;
+}
+
+void FObjectResolutionCache::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    // The asset registry may already be gone during engine shutdown
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    FCoreUObjectDelegates::OnPackageReloaded.Remove(PackageReloadedHandle);
+
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    ReloadCompleteHandle.Reset();
+    PackageReloadedHandle.Reset();
+    bInitialized = false;
+
+    FScopeLock Lock(&WriteLock);
+    for (FKindTable& Table : Tables)
+    {
+        ClearTable(Table);
+    }
+}
+
+UObject* FObjectResolutionCache::Find(EResolvedObjectKind Kind, const FString& Key)
+{
+    FKindTable& Table = Tables[static_cast<int32>(Kind)];
+    Table.TotalRequests.fetch_add(1, std::memory_order_relaxed);
+
+    uint64 KeyNameBits = 0;
+    if (!PackKeyName(Key, FNAME_Find, KeyNameBits))
+    {
+        return nullptr;
+    }
+
+    const uint64 KeyHash = HashKey(Key);
+    const uint64 CurrentGeneration = GetGeneration();
+    uint32 SlotIndex = static_cast<uint32>(KeyHash) & (SlotsPerKind - 1);
+
+    for (int32 Probe = 0; Probe < MaxProbes; ++Probe, SlotIndex = (SlotIndex + 1) & (SlotsPerKind - 1))
+    {
+        const FSlot& Slot = Table.Slots[SlotIndex];
+
+        // Copy the slot out, retrying while a writer is updating it
+        uint64 SlotHash = 0;
+        uint64 SlotNameBits = 0;
+        uint64 SlotGeneration = 0;
+        uint64 SlotObjectBits = 0;
+        for (;;)
+        {
+            const uint32 SequenceBefore = Slot.Sequence.load(std::memory_order_acquire);
+            if (SequenceBefore & 1)
+            {
+                FPlatformProcess::YieldThread();
+                continue;
+            }
+            SlotHash = Slot.KeyHash.load(std::memory_order_relaxed);
+            SlotNameBits = Slot.KeyNameBits.load(std::memory_order_relaxed);
+            SlotGeneration = Slot.Generation.load(std::memory_order_relaxed);
+            SlotObjectBits = Slot.WeakObjectBits.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (Slot.Sequence.load(std::memory_order_relaxed) == SequenceBefore)
+            {
+                break;
+            }
+        }
+
+        if (SlotHash == 0)
+        {
+            // Slots are never emptied individually, so an empty slot ends the probe sequence
+            return nullptr;
+        }
+        if (SlotHash != KeyHash || SlotNameBits != KeyNameBits)
+        {
+            continue;
+        }
+
+        UObject* Object = nullptr;
+        if (SlotGeneration == CurrentGeneration)
+        {
+            // Worker lanes look objects up too; GC must not run while the weak pointer is resolved
+            TOptional<FGCScopeGuard> GCGuard;
+            if (!IsInGameThread())
+            {
+                GCGuard.Emplace();
+            }
+            Object = UnpackWeakObject(SlotObjectBits).Get();
+        }
+        if (!Object)
+        {
+            Table.InvalidatedCount.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        Table.CacheHits.fetch_add(1, std::memory_order_relaxed);
+        return Object;
+    }
+
+    return nullptr;
+}
+
+void FObjectResolutionCache::Store(EResolvedObjectKind Kind, const FString& Key, UObject* Object)
+{
+    if (!Object)
+    {
+        return;
+    }
+
+    uint64 KeyNameBits = 0;
+    if (!PackKeyName(Key, FNAME_Add, KeyNameBits))
+    {
+        return;
+    }
+
+    FKindTable& Table = Tables[static_cast<int32>(Kind)];
+    const uint64 KeyHash = HashKey(Key);
+    const uint64 ObjectBits = PackWeakObject(TWeakObjectPtr<UObject>(Object));
+
+    FScopeLock Lock(&WriteLock);
+
+    // Reuse the key's slot if it has one, otherwise take the first empty slot of its probe sequence
+    FSlot* TargetSlot = nullptr;
+    uint32 SlotIndex = static_cast<uint32>(KeyHash) & (SlotsPerKind - 1);
+    for (int32 Probe = 0; Probe < MaxProbes; ++Probe, SlotIndex = (SlotIndex + 1) & (SlotsPerKind - 1))
+    {
+        FSlot& Slot = Table.Slots[SlotIndex];
+        const uint64 SlotHash = Slot.KeyHash.load(std::memory_order_relaxed);
+        if ((SlotHash == KeyHash && Slot.KeyNameBits.load(std::memory_order_relaxed) == KeyNameBits) || SlotHash == 0)
+        {
+            TargetSlot = &Slot;
+            break;
+        }
+    }
+
+    if (!TargetSlot || (TargetSlot->KeyHash.load(std::memory_order_relaxed) == 0 && Table.OccupiedSlots.load(std::memory_order_relaxed) >= MaxOccupiedSlots))
+    {
+        // Stale entries are only ever overwritten, so a full table is cleared and refilled by later misses
+        UE_LOG(LogTemp, Verbose, TEXT("FObjectResolutionCache: Clearing full %s table"), GetKindName(Kind));
+        ClearTable(Table);
+        TargetSlot = &Table.Slots[static_cast<uint32>(KeyHash) & (SlotsPerKind - 1)];
+    }
+
+    if (TargetSlot->KeyHash.load(std::memory_order_relaxed) == 0)
+    {
+        Table.OccupiedSlots.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const uint32 Sequence = TargetSlot->Sequence.load(std::memory_order_relaxed);
+    TargetSlot->Sequence.store(Sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    TargetSlot->KeyHash.store(KeyHash, std::memory_order_relaxed);
+    TargetSlot->KeyNameBits.store(KeyNameBits, std::memory_order_relaxed);
+    TargetSlot->Generation.store(GetGeneration(), std::memory_order_relaxed);
+    TargetSlot->WeakObjectBits.store(ObjectBits, std::memory_order_relaxed);
+    TargetSlot->Sequence.store(Sequence + 2, std::memory_order_release);
+
+    UE_LOG(LogTemp, Verbose, TEXT("FObjectResolutionCache: Cached %s '%s'"), GetKindName(Kind), *Key);
+}
+
+void FObjectResolutionCache::Invalidate(const TCHAR* Reason)
+{
+    const uint64 NewGeneration = Generation.fetch_add(1, std::memory_order_acq_rel) + 1;
+    UE_LOG(LogTemp, Verbose, TEXT("FObjectResolutionCache: Generation %llu (%s)"), NewGeneration, Reason);
+}
+
+FObjectResolutionCacheStats FObjectResolutionCache::GetStats() const
+{
+    FObjectResolutionCacheStats Stats;
+    Stats.Generation = GetGeneration();
+
+    for (int32 KindIndex = 0; KindIndex < static_cast<int32>(EResolvedObjectKind::Count); ++KindIndex)
+    {
+        const FKindTable& Table = Tables[KindIndex];
+        FObjectResolutionKindStats& KindStats = Stats.Kinds[KindIndex];
+        KindStats.TotalRequests = Table.TotalRequests.load(std::memory_order_relaxed);
+        KindStats.CacheHits = Table.CacheHits.load(std::memory_order_relaxed);
+        KindStats.CacheMisses = KindStats.TotalRequests - KindStats.CacheHits;
+        KindStats.InvalidatedCount = Table.InvalidatedCount.load(std::memory_order_relaxed);
+
+        // Only entries of the current generation count as cached
+        for (const FSlot& Slot : Table.Slots)
+        {
+            if (Slot.KeyHash.load(std::memory_order_relaxed) != 0 && Slot.Generation.load(std::memory_order_relaxed) == Stats.Generation)
+            {
+                KindStats.CachedCount++;
+            }
+        }
+    }
+    return Stats;
+}
+
+void FObjectResolutionCache::ResetStats()
+{
+    for (FKindTable& Table : Tables)
+    {
+        Table.TotalRequests.store(0, std::memory_order_relaxed);
+        Table.CacheHits.store(0, std::memory_order_relaxed);
+        Table.InvalidatedCount.store(0, std::memory_order_relaxed);
+    }
+    UE_LOG(LogTemp, Log, TEXT("FObjectResolutionCache: Cache statistics reset"));
+}
+
+const TCHAR* FObjectResolutionCache::GetKindName(EResolvedObjectKind Kind)
+{
+    switch (Kind)
+    {
+    case EResolvedObjectKind::Blueprint:
+        return TEXT("blueprint");
+    case EResolvedObjectKind::WidgetBlueprint:
+        return TEXT("widget_blueprint");
+    case EResolvedObjectKind::Struct:
+        return TEXT("struct");
+    case EResolvedObjectKind::DataTable:
+        return TEXT("data_table");
+    case EResolvedObjectKind::Class:
+        return TEXT("class");
+    default:
+        return TEXT("unknown");
+    }
+}
+
+uint64 FObjectResolutionCache::HashKey(const FString& Key)
+{
+    TStringBuilder<256> LowerKey;
+    for (TCHAR Character : Key)
+    {
+        LowerKey.AppendChar(FChar::ToLower(Character));
+    }
+
+    const uint64 Hash = CityHash64(reinterpret_cast<const char*>(LowerKey.GetData()), LowerKey.Len() * sizeof(TCHAR));
+    return Hash != 0 ? Hash : 1;
+}
+
+bool FObjectResolutionCache::PackKeyName(const FString& Key, EFindName FindType, uint64& OutBits)
+{
+    if (Key.IsEmpty() || Key.Len() >= NAME_SIZE)
+    {
+        return false;
+    }
+
+    const FName KeyName(*Key, FindType);
+    if (KeyName.IsNone())
+    {
+        return false;
+    }
+
+    OutBits = (static_cast<uint64>(KeyName.GetComparisonIndex().ToUnstableInt()) << 32) | static_cast<uint32>(KeyName.GetNumber());
+    return true;
+}
+
+uint64 FObjectResolutionCache::PackWeakObject(const TWeakObjectPtr<UObject>& WeakObject)
+{
+    uint64 Bits = 0;
+    FMemory::Memcpy(&Bits, &WeakObject, sizeof(Bits));
+    return Bits;
+}
+
+TWeakObjectPtr<UObject> FObjectResolutionCache::UnpackWeakObject(uint64 Bits)
+{
+    TWeakObjectPtr<UObject> WeakObject;
+    FMemory::Memcpy(&WeakObject, &Bits, sizeof(Bits));
+    return WeakObject;
+}
+
+void FObjectResolutionCache::ClearTable(FKindTable& Table)
+{
+    int32 ClearedCount = 0;
+    for (FSlot& Slot : Table.Slots)
+    {
+        if (Slot.KeyHash.load(std::memory_order_relaxed) == 0)
+        {
+            continue;
+        }
+
+        const uint32 Sequence = Slot.Sequence.load(std::memory_order_relaxed);
+        Slot.Sequence.store(Sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        Slot.KeyHash.store(0, std::memory_order_relaxed);
+        Slot.KeyNameBits.store(0, std::memory_order_relaxed);
+        Slot.Generation.store(0, std::memory_order_relaxed);
+        Slot.WeakObjectBits.store(0, std::memory_order_relaxed);
+        Slot.Sequence.store(Sequence + 2, std::memory_order_release);
+        ClearedCount++;
+    }
+    Table.OccupiedSlots.store(0, std::memory_order_relaxed);
+    Table.InvalidatedCount.fetch_add(ClearedCount, std::memory_order_relaxed);
+}
+
+void FObjectResolutionCache::OnAssetRemoved(const FAssetData& AssetData)
+{
+    Invalidate(TEXT("asset deleted"));
+}
+
+void FObjectResolutionCache::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    Invalidate(TEXT("asset renamed"));
+}
+
+void FObjectResolutionCache::OnReloadComplete(EReloadCompleteReason Reason)
+{
+    Invalidate(TEXT("hot reload"));
+}
+
+void FObjectResolutionCache::OnPackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event)
+{
+    if (Phase == EPackageReloadPhase::PostPackageFixup)
+    {
+        Invalidate(TEXT("package reloaded"));
+    }
+}
@@ -8,6 +8,7 @@
 #include "Engine/UserDefinedStruct.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Kismet2/StructureEditorUtils.h"
+#include "Services/StructSchemaCache.h"
 #include "UnrealEd.h"
 #include "AssetToolsModule.h"
 #include "Factories/StructureFactory.h"
@@ -147,16 +148,16 @@ TArray<FString> FProjectService::ListFolderContents(const FString& FolderPath, b
             AssetPath = AssetPath.Replace(TEXT("Content/"), TEXT("/Game/"));
         }
         
-        if (!UEditorAssetLibrary::DoesDirectoryExist(AssetPath))
+        // Query the asset registry directly; list_folder_contents may run off the game thread
+        FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
+        IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+        
+        if (!AssetRegistry.PathExists(AssetPath))
         {
             OutError = FString::Printf(TEXT("Content directory does not exist: %s"), *AssetPath);
             return Contents;
         }
         
-        // Get subdirectories using AssetRegistry
-        FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-        IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-        
         TArray<FString> SubPaths;
         AssetRegistry.GetSubPaths(AssetPath, SubPaths, false);
         
@@ -165,11 +166,12 @@ TArray<FString> FProjectService::ListFolderContents(const FString& FolderPath, b
             Contents.Add(FString::Printf(TEXT("FOLDER: %s"), *SubPath));
         }
         
-        // Get assets (UE 5.6 compatible)
-        TArray<FString> Assets = UEditorAssetLibrary::ListAssets(AssetPath, false, false);
-        for (const FString& Asset : Assets)
+        // Get assets directly in this folder
+        TArray<FAssetData> Assets;
+        AssetRegistry.GetAssetsByPath(FName(*AssetPath), Assets, false);
+        for (const FAssetData& Asset : Assets)
         {
-            Contents.Add(FString::Printf(TEXT("ASSET: %s"), *Asset));
+            Contents.Add(FString::Printf(TEXT("ASSET: %s"), *Asset.GetSoftObjectPath().ToString()));
         }
     }
     else
@@ -224,36 +226,7 @@ FString FProjectService::GetProjectDirectory() const
 
 FString FProjectService::GetPropertyTypeString(const FProperty* Property) const
 {
-    if (!Property) return TEXT("Unknown");
-    
-    // Handle array properties first
-    if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
-    {
-        // Get the type of array elements
-        FString ElementType = GetPropertyTypeString(ArrayProp->Inner);
-        return ElementType + TEXT("[]");
-    }
-    
-    if (Property->IsA<FBoolProperty>()) return TEXT("Boolean");
-    if (Property->IsA<FIntProperty>()) return TEXT("Integer");
-    if (Property->IsA<FFloatProperty>() || Property->IsA<FDoubleProperty>()) return TEXT("Float");
-    if (Property->IsA<FStrProperty>()) return TEXT("String");
-    if (Property->IsA<FNameProperty>()) return TEXT("Name");
-    if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
-    {
-        if (StructProp->Struct == TBaseStructure<FVector>::Get()) return TEXT("Vector");
-        if (StructProp->Struct == TBaseStructure<FRotator>::Get()) return TEXT("Rotator");
-        if (StructProp->Struct == TBaseStructure<FTransform>::Get()) return TEXT("Transform");
-        if (StructProp->Struct == TBaseStructure<FLinearColor>::Get()) return TEXT("Color");
-        // For custom structs, strip the 'F' prefix if present
-        FString StructName = StructProp->Struct->GetName();
-        if (StructName.StartsWith(TEXT("F")) && StructName.Len() > 1)
-        {
-            StructName = StructName.RightChop(1);
-        }
-        return StructName;
-    }
-    return TEXT("Unknown");
+    return FStructSchemaCache::DescribePropertyType(Property);
 }
 
 bool FProjectService::ResolvePropertyType(const FString& PropertyType, FEdGraphPinType& OutPinType) const
@@ -502,8 +475,9 @@ bool FProjectService::CreateStruct(const FString& StructName, const FString& Pat
         FStructureEditorUtils::RemoveVariable(NewStruct, Guid);
     }
 
-    // Final compilation and save
+    // Final compilation and save; a bare compile sends no change notification, so drop the cached schema here
     FStructureEditorUtils::CompileStructure(NewStruct);
+    FStructSchemaCache::Get().Invalidate(NewStruct);
     NewStruct->MarkPackageDirty();
     FAssetRegistryModule::AssetCreated(NewStruct);
 
@@ -608,8 +582,9 @@ bool FProjectService::UpdateStruct(const FString& StructName, const FString& Pat
         FStructureEditorUtils::RemoveVariable(ExistingStruct, Guid);
     }
 
-    // Final compilation and save
+    // Final compilation and save; a bare compile sends no change notification, so drop the cached schema here
     FStructureEditorUtils::CompileStructure(ExistingStruct);
+    FStructSchemaCache::Get().Invalidate(ExistingStruct);
     ExistingStruct->MarkPackageDirty();
 
     return true;
@@ -704,24 +679,17 @@ TArray<TSharedPtr<FJsonObject>> FProjectService::ShowStructVariables(const FStri
         return Variables;
     }
 
-    // Get all properties from the struct
-    for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+    // Get all properties from the struct's cached schema, shared with the DataTable commands
+    for (const FStructSchemaField& Field : FStructSchemaCache::Get().GetSchema(Struct)->Fields)
     {
-        FProperty* Property = *PropIt;
-        if (!Property)
-        {
-            continue;
-        }
-
         TSharedPtr<FJsonObject> VarObj = MakeShared<FJsonObject>();
-        VarObj->SetStringField(TEXT("name"), Property->GetName());
-        VarObj->SetStringField(TEXT("type"), GetPropertyTypeString(Property));
+        VarObj->SetStringField(TEXT("name"), Field.InternalName);
+        VarObj->SetStringField(TEXT("type"), Field.TypeName);
         
         // Get tooltip/description if available
-        FString Tooltip = Property->GetToolTipText().ToString();
-        if (!Tooltip.IsEmpty())
+        if (!Field.Tooltip.IsEmpty())
         {
-            VarObj->SetStringField(TEXT("description"), Tooltip);
+            VarObj->SetStringField(TEXT("description"), Field.Tooltip);
         }
 
         Variables.Add(VarObj);
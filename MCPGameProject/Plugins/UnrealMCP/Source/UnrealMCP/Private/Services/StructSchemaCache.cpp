@@ -0,0 +1,179 @@
+#include "Services/StructSchemaCache.h"
+#include "Engine/UserDefinedStruct.h"
+#include "JsonObjectConverter.h"
+#include "Kismet2/StructureEditorUtils.h"
+#include "UObject/StructOnScope.h"
+
+class FStructSchemaCache::FStructChangeListener : public FStructureEditorUtils::INotifyOnStructChanged
+{
+public:
+    // Properties are destroyed during the change, so drop the schemas before it as well as after
+    virtual void PreChange(const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType) override
+    {
+        FStructSchemaCache::Get().InvalidateUserDefinedStructs();
+    }
+
+    virtual void PostChange(const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType) override
+    {
+        FStructSchemaCache::Get().InvalidateUserDefinedStructs();
+    }
+};
+
+FStructSchemaCache& FStructSchemaCache::Get()
+{
+    static FStructSchemaCache Instance;
+    return Instance;
+}
+
+void FStructSchemaCache::Initialize()
+{
+    check(IsInGameThread());
+    if (!ChangeListener)
+    {
+        // The listener registers itself with the structure editor's change manager
+        ChangeListener = MakeUnique<FStructChangeListener>();
+    }
+}
+
+void FStructSchemaCache::Shutdown()
+{
+    ChangeListener.Reset();
+    Entries.Empty();
+    CachedCount = 0;
+}
+
+TSharedRef<const FStructSchema> FStructSchemaCache::GetSchema(const UScriptStruct* Struct)
+{
+    check(IsInGameThread());
+    check(Struct);
+
+    ++LookupCount;
+    const TObjectKey<UScriptStruct> StructKey(Struct);
+    if (const FEntry* Entry = Entries.Find(StructKey))
+    {
+        if (Entry->PropertyLink == Struct->PropertyLink && Entry->StructureSize == Struct->GetStructureSize())
+        {
+            return Entry->Schema.ToSharedRef();
+        }
+        ++InvalidationCount;
+    }
+
+    ++BuildCount;
+    FEntry& Entry = Entries.Add(StructKey);
+    Entry.Schema = BuildSchema(Struct);
+    Entry.PropertyLink = Struct->PropertyLink;
+    Entry.StructureSize = Struct->GetStructureSize();
+    CachedCount = Entries.Num();
+    return Entry.Schema.ToSharedRef();
+}
+
+void FStructSchemaCache::Invalidate(const UScriptStruct* Struct)
+{
+    check(IsInGameThread());
+    if (Struct && Entries.Remove(Struct) > 0)
+    {
+        ++InvalidationCount;
+        CachedCount = Entries.Num();
+    }
+}
+
+FStructSchemaCacheStats FStructSchemaCache::GetStats() const
+{
+    FStructSchemaCacheStats Stats;
+    Stats.CachedStructs = CachedCount.load();
+    Stats.Lookups = LookupCount.load();
+    Stats.Builds = BuildCount.load();
+    Stats.Invalidations = InvalidationCount.load();
+    return Stats;
+}
+
+void FStructSchemaCache::ResetStats()
+{
+    LookupCount = 0;
+    BuildCount = 0;
+    InvalidationCount = 0;
+}
+
+FString FStructSchemaCache::DescribePropertyType(const FProperty* Property)
+{
+    if (!Property) return TEXT("Unknown");
+
+    // Handle array properties first
+    if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+    {
+        return DescribePropertyType(ArrayProp->Inner) + TEXT("[]");
+    }
+
+    if (Property->IsA<FBoolProperty>()) return TEXT("Boolean");
+    if (Property->IsA<FIntProperty>()) return TEXT("Integer");
+    if (Property->IsA<FFloatProperty>() || Property->IsA<FDoubleProperty>()) return TEXT("Float");
+    if (Property->IsA<FStrProperty>()) return TEXT("String");
+    if (Property->IsA<FNameProperty>()) return TEXT("Name");
+    if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+    {
+        if (StructProp->Struct == TBaseStructure<FVector>::Get()) return TEXT("Vector");
+        if (StructProp->Struct == TBaseStructure<FRotator>::Get()) return TEXT("Rotator");
+        if (StructProp->Struct == TBaseStructure<FTransform>::Get()) return TEXT("Transform");
+        if (StructProp->Struct == TBaseStructure<FLinearColor>::Get()) return TEXT("Color");
+        // For custom structs, strip the 'F' prefix if present
+        FString StructName = StructProp->Struct->GetName();
+        if (StructName.StartsWith(TEXT("F")) && StructName.Len() > 1)
+        {
+            StructName = StructName.RightChop(1);
+        }
+        return StructName;
+    }
+    return TEXT("Unknown");
+}
+
+TSharedRef<const FStructSchema> FStructSchemaCache::BuildSchema(const UScriptStruct* Struct)
+{
+    TSharedRef<FStructSchema> Schema = MakeShared<FStructSchema>();
+
+    // Defaults are read from one default constructed instance; a user defined struct's instance carries its edited defaults
+    FStructOnScope Defaults(Struct);
+
+    for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+    {
+        FProperty* Property = *PropIt;
+        const int32 FieldIndex = Schema->Fields.Num();
+
+        FStructSchemaField& Field = Schema->Fields.AddDefaulted_GetRef();
+        Field.Property = Property;
+        Field.AuthoredName = Property->GetAuthoredName();
+        Field.InternalName = Property->GetName();
+        Field.TypeName = DescribePropertyType(Property);
+        Field.Tooltip = Property->GetToolTipText().ToString();
+        Field.DefaultValue = FJsonObjectConverter::UPropertyToJsonValue(Property, Property->ContainerPtrToValuePtr<void>(Defaults.GetStructMemory()));
+
+        Schema->AuthoredNameByInternalName.Add(Field.InternalName, Field.AuthoredName);
+
+        // The first field wins if two fields share a name ignoring case
+        if (!Schema->FieldIndexByName.Contains(Field.AuthoredName))
+        {
+            Schema->FieldIndexByName.Add(Field.AuthoredName, FieldIndex);
+        }
+        if (!Schema->FieldIndexByName.Contains(Field.InternalName))
+        {
+            Schema->FieldIndexByName.Add(Field.InternalName, FieldIndex);
+        }
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("MCP StructSchemaCache: Built schema of '%s' with %d fields"), *Struct->GetName(), Schema->Fields.Num());
+    return Schema;
+}
+
+void FStructSchemaCache::InvalidateUserDefinedStructs()
+{
+    check(IsInGameThread());
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        const UScriptStruct* Struct = It.Key().ResolveObjectPtr();
+        if (!Struct || Struct->IsA<UUserDefinedStruct>())
+        {
+            It.RemoveCurrent();
+            ++InvalidationCount;
+        }
+    }
+    CachedCount = Entries.Num();
+}
@@ -2,6 +2,9 @@
 #include "Services/UMG/WidgetComponentService.h"
 #include "Services/UMG/WidgetValidationService.h"
 #include "Utils/UnrealMCPCommonUtils.h"
+#include "Services/AssetDiscoveryService.h"
+#include "Services/ObjectResolutionCache.h"
+#include "Services/AssetDirtySet.h"
 #include "WidgetBlueprint.h"
 #include "Blueprint/UserWidget.h"
 #include "Blueprint/WidgetTree.h"
@@ -213,12 +216,11 @@ bool FUMGService::SetWidgetProperties(const FString& BlueprintName, const FStrin
         }
     }
 
-    // Save the blueprint if any properties were set
+    // Queue a compile and save if any properties were set
     if (OutSuccessProperties.Num() > 0)
     {
         WidgetBlueprint->MarkPackageDirty();
-        FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-        UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+        FAssetDirtySet::Get().MarkDirty(WidgetBlueprint, EPendingAssetWork::CompileAndSave);
     }
 
     return OutSuccessProperties.Num() > 0;
@@ -411,8 +413,7 @@ bool FUMGService::SetWidgetPlacement(const FString& BlueprintName, const FString
     if (bResult)
     {
         WidgetBlueprint->MarkPackageDirty();
-        FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-        UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+        FAssetDirtySet::Get().MarkDirty(WidgetBlueprint, EPendingAssetWork::CompileAndSave);
     }
 
     return bResult;
@@ -507,10 +508,9 @@ bool FUMGService::AddChildWidgetComponentToParent(const FString& BlueprintName,
         return false;
     }
 
-    // Save the blueprint
+    // Queue the compile and save
     WidgetBlueprint->MarkPackageDirty();
-    FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-    UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+    FAssetDirtySet::Get().MarkDirty(WidgetBlueprint, EPendingAssetWork::CompileAndSave);
 
     return true;
 }
@@ -557,63 +557,26 @@ bool FUMGService::CreateParentAndChildWidgetComponents(const FString& BlueprintN
         return false;
     }
 
-    // Save the blueprint
+    // Queue the compile and save
     WidgetBlueprint->MarkPackageDirty();
-    FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-    UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+    FAssetDirtySet::Get().MarkDirty(WidgetBlueprint, EPendingAssetWork::CompileAndSave);
 
     return true;
 }
 
 UWidgetBlueprint* FUMGService::FindWidgetBlueprint(const FString& BlueprintNameOrPath) const
 {
-    // Check if we already have a full path
-    if (BlueprintNameOrPath.StartsWith(TEXT("/Game/")))
+    FObjectResolutionCache& ResolutionCache = FObjectResolutionCache::Get();
+    if (UWidgetBlueprint* CachedBlueprint = ResolutionCache.Find<UWidgetBlueprint>(EResolvedObjectKind::WidgetBlueprint, BlueprintNameOrPath))
     {
-        UObject* Asset = UEditorAssetLibrary::LoadAsset(BlueprintNameOrPath);
-        return Cast<UWidgetBlueprint>(Asset);
+        return CachedBlueprint;
     }
 
-    // Try common directories
-    TArray<FString> SearchPaths = {
-        FUnrealMCPCommonUtils::BuildGamePath(FString::Printf(TEXT("Widgets/%s"), *BlueprintNameOrPath)),
-        FUnrealMCPCommonUtils::BuildGamePath(FString::Printf(TEXT("UI/%s"), *BlueprintNameOrPath)),
-        FUnrealMCPCommonUtils::BuildGamePath(FString::Printf(TEXT("UMG/%s"), *BlueprintNameOrPath)),
-        FUnrealMCPCommonUtils::BuildGamePath(FString::Printf(TEXT("Interface/%s"), *BlueprintNameOrPath))
-    };
-
-    for (const FString& SearchPath : SearchPaths)
-    {
-        UObject* Asset = UEditorAssetLibrary::LoadAsset(SearchPath);
-        UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Asset);
-        if (WidgetBlueprint)
-        {
-            return WidgetBlueprint;
-        }
-    }
-
-    // Use asset registry to search everywhere
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    TArray<FAssetData> AssetData;
-
-    FARFilter Filter;
-    Filter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
-    Filter.PackagePaths.Add(FName(TEXT("/Game")));
-    Filter.bRecursivePaths = true;
-    AssetRegistryModule.Get().GetAssets(Filter, AssetData);
-
-    for (const FAssetData& Asset : AssetData)
-    {
-        FString AssetName = Asset.AssetName.ToString();
-        if (AssetName.Equals(BlueprintNameOrPath, ESearchCase::IgnoreCase))
-        {
-            FString AssetPath = Asset.GetSoftObjectPath().ToString();
-            UObject* LoadedAsset = UEditorAssetLibrary::LoadAsset(AssetPath);
-            return Cast<UWidgetBlueprint>(LoadedAsset);
-        }
-    }
-
-    return nullptr;
+    // Resolved through the asset name index, with misses remembered until an asset is added or renamed,
+    // so polling for a widget that does not exist yet never reaches the package loader
+    UWidgetBlueprint* WidgetBlueprint = FAssetDiscoveryService::Get().FindWidgetBlueprint(BlueprintNameOrPath);
+    ResolutionCache.Store(EResolvedObjectKind::WidgetBlueprint, BlueprintNameOrPath, WidgetBlueprint);
+    return WidgetBlueprint;
 }
 
 UWidgetBlueprint* FUMGService::CreateWidgetBlueprintInternal(const FString& Name, UClass* ParentClass, const FString& Path) const
@@ -683,11 +646,10 @@ UWidgetBlueprint* FUMGService::CreateWidgetBlueprintInternal(const FString& Name
         }
     }
 
-    // Finalize and save
+    // Finalize and queue the compile and save
     FAssetRegistryModule::AssetCreated(WidgetBlueprint);
-    FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
     Package->MarkPackageDirty();
-    UEditorAssetLibrary::SaveAsset(FullPath, false);
+    FAssetDirtySet::Get().MarkDirty(WidgetBlueprint, EPendingAssetWork::CompileAndSave);
 
     return WidgetBlueprint;
 }
@@ -843,10 +805,9 @@ bool FUMGService::CreateEventBinding(UWidgetBlueprint* WidgetBlueprint, UWidget*
     EventNode->AllocateDefaultPins();
     EventNode->ReconstructNode();
 
-    // Save the blueprint
+    // Queue the compile and save
     WidgetBlueprint->MarkPackageDirty();
-    FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-    UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+    FAssetDirtySet::Get().MarkDirty(WidgetBlueprint, EPendingAssetWork::CompileAndSave);
 
     return true;
 }
@@ -960,10 +921,9 @@ bool FUMGService::CreateTextBlockBindingFunction(UWidgetBlueprint* WidgetBluepri
         GetVarOutputPin->MakeLinkTo(ResultInputPin);
     }
 
-    // Save the blueprint
+    // Queue the compile and save
     WidgetBlueprint->MarkPackageDirty();
-    FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-    UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+    FAssetDirtySet::Get().MarkDirty(WidgetBlueprint, EPendingAssetWork::CompileAndSave);
 
     return true;
 }
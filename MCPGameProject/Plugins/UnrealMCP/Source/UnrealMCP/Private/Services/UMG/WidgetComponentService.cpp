@@ -1,4 +1,5 @@
 #include "Services/UMG/WidgetComponentService.h"
+#include "Services/AssetDirtySet.h"
 #include "Editor/UMGEditor/Public/WidgetBlueprint.h"
 #include "Blueprint/WidgetTree.h"
 #include "Components/TextBlock.h"
@@ -1529,11 +1530,8 @@ void FWidgetComponentService::SaveWidgetBlueprint(UWidgetBlueprint* WidgetBluepr
     // Mark the blueprint as dirty
     WidgetBlueprint->MarkPackageDirty();
     
-    // Compile the blueprint
-    FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+    // Queue the compile and save; adding many components costs one of each at the next flush
+    FAssetDirtySet::Get().MarkDirty(WidgetBlueprint, EPendingAssetWork::CompileAndSave);
     
-    // Save the asset
-    UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
-    
-    UE_LOG(LogTemp, Log, TEXT("Saved widget blueprint: %s"), *WidgetBlueprint->GetName());
+    UE_LOG(LogTemp, Verbose, TEXT("Queued compile and save of widget blueprint: %s"), *WidgetBlueprint->GetName());
 }
@@ -8,6 +8,29 @@
 #include "Misc/DateTime.h"
 #include "Dom/JsonObject.h"
 #include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "MCPFrameProtocol.h"
+#include "Services/BlueprintActionSearchIndex.h"
+#include "Services/BlueprintActionResultCache.h"
+#include "Services/AssetNameIndex.h"
+#include "Services/LevelActorIndex.h"
+#include "Services/IEditorService.h"
+#include "Services/DataTableService.h"
+#include "Services/StructSchemaCache.h"
+#include "Engine/Scene.h"
+#include "Engine/DataTable.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Kismet2/StructureEditorUtils.h"
+#include "EdGraphSchema_K2.h"
+#include "EngineUtils.h"
+#include "Engine/Blueprint.h"
+#include "Commands/BlueprintAction/UnrealMCPBlueprintActionCommands.h"
+#include "BlueprintActionDatabase.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Editor.h"
+#include "Engine/World.h"
 
 // Forward declarations
 void BenchmarkCommandRegistryPerformance();
@@ -15,6 +38,15 @@ void BenchmarkComponentFactoryPerformance();
 void BenchmarkWidgetFactoryPerformance();
 void BenchmarkServiceLayerPerformance();
 void BenchmarkEndToEndCommandPerformance();
+void BenchmarkFramedProtocolThroughput();
+void BenchmarkJsonExecutionPath();
+void BenchmarkUtf8ResponseEncoding();
+void BenchmarkBlueprintActionSearchIndex();
+void BenchmarkBlueprintActionResultCache();
+void BenchmarkAssetNameIndex();
+void BenchmarkLevelActorIndex();
+void BenchmarkDataTableBulkImportExport();
+void BenchmarkStructSchemaCache();
 
 /**
  * Performance benchmark test for the refactored MCP system
@@ -45,6 +77,33 @@ void RunPerformanceBenchmarkTest()
     // Benchmark 5: End-to-End Command Performance
     BenchmarkEndToEndCommandPerformance();
     
+    // Benchmark 6: Wire protocol framing throughput
+    BenchmarkFramedProtocolThroughput();
+    
+    // Benchmark 7: DOM execution path vs string round-trips
+    BenchmarkJsonExecutionPath();
+    
+    // Benchmark 8: UTF-8 frame encoder vs FString + conversion
+    BenchmarkUtf8ResponseEncoding();
+    
+    // Benchmark 9: Blueprint action search index build and query latency
+    BenchmarkBlueprintActionSearchIndex();
+    
+    // Benchmark 10: Memoized get_actions_for_class / pin / hierarchy results
+    BenchmarkBlueprintActionResultCache();
+    
+    // Benchmark 11: Asset name lookups through the asset name index
+    BenchmarkAssetNameIndex();
+    
+    // Benchmark 12: Actor lookups through the level actor index vs a level scan
+    BenchmarkLevelActorIndex();
+    
+    // Benchmark 13: Streaming DataTable import and paginated export at 10k and 100k rows
+    BenchmarkDataTableBulkImportExport();
+    
+    // Benchmark 14: Field lookups through the struct schema cache vs a reflection walk
+    BenchmarkStructSchemaCache();
+    
     // Get final memory stats
     FPlatformMemoryStats FinalMemory = FPlatformMemory::GetStats();
     UE_LOG(LogTemp, Warning, TEXT("Final Memory Usage: %.2f MB"), 
@@ -246,6 +305,789 @@ void BenchmarkEndToEndCommandPerformance()
            HeavyCommandsPerSecond, Duration.GetTotalMilliseconds() / 10);
 }
 
+/**
+ * Build a UTF-8 command of roughly PayloadBytes, shaped like an add_rows_to_datatable batch
+ */
+static TArray<uint8> BuildBenchmarkCommand(int32 PayloadBytes)
+{
+    FString Rows;
+    int32 RowIndex = 0;
+    while (Rows.Len() < PayloadBytes)
+    {
+        Rows += FString::Printf(TEXT("%s{\"row_name\":\"Row_%d\",\"row_data\":{\"Damage\":%d,\"Name\":\"Sword %d\"}}"),
+                                RowIndex > 0 ? TEXT(",") : TEXT(""), RowIndex, RowIndex * 3, RowIndex);
+        ++RowIndex;
+    }
+
+    FString Command = FString::Printf(TEXT("{\"type\":\"add_rows_to_datatable\",\"params\":{\"datatable_name\":\"DT_Bench\",\"rows\":[%s]}}"), *Rows);
+    FTCHARToUTF8 Utf8Command(*Command, Command.Len());
+
+    TArray<uint8> Bytes;
+    Bytes.Append(reinterpret_cast<const uint8*>(Utf8Command.Get()), Utf8Command.Length());
+    return Bytes;
+}
+
+/**
+ * Benchmark frame reassembly and parsing for 1 KB, 64 KB and 4 MB commands
+ * Simulates socket reads of 64 KB into the decoder for each framing mode
+ */
+void BenchmarkFramedProtocolThroughput()
+{
+    UE_LOG(LogTemp, Warning, TEXT("--- Framed Protocol Throughput Benchmark ---"));
+    
+    const int32 ReadChunkBytes = 64 * 1024;
+    const int32 PayloadSizes[] = { 1024, 64 * 1024, 4 * 1024 * 1024 };
+    const EMCPFramingMode Modes[] = { EMCPFramingMode::Json, EMCPFramingMode::NewlineDelimited, EMCPFramingMode::LengthPrefixed };
+    
+    for (int32 PayloadSize : PayloadSizes)
+    {
+        const TArray<uint8> Command = BuildBenchmarkCommand(PayloadSize);
+        
+        // Keep total traffic per measurement around 64 MB so small frames are not timer-bound
+        const int32 NumMessages = FMath::Clamp((64 * 1024 * 1024) / Command.Num(), 8, 20000);
+        
+        for (EMCPFramingMode Mode : Modes)
+        {
+            // Encode the stream once, outside the timed region
+            TArray<uint8> Stream;
+            Stream.Reserve((Command.Num() + FMCPFrameDecoder::LengthPrefixSize + 1) * NumMessages);
+            for (int32 i = 0; i < NumMessages; ++i)
+            {
+                if (Mode == EMCPFramingMode::LengthPrefixed)
+                {
+                    uint8 Prefix[FMCPFrameDecoder::LengthPrefixSize];
+                    FMCPFrameDecoder::EncodeLengthPrefix(static_cast<uint32>(Command.Num()), Prefix);
+                    Stream.Append(Prefix, FMCPFrameDecoder::LengthPrefixSize);
+                }
+                Stream.Append(Command);
+                if (Mode == EMCPFramingMode::NewlineDelimited)
+                {
+                    Stream.Add('\n');
+                }
+            }
+            
+            FMCPFrameDecoder Decoder(64 * 1024 * 1024);
+            Decoder.SetMode(Mode);
+            
+            int32 FramesDecoded = 0;
+            int32 FramesParsed = 0;
+            double ReassemblySeconds = 0.0;
+            double ParseSeconds = 0.0;
+            
+            for (int32 Offset = 0; Offset < Stream.Num(); Offset += ReadChunkBytes)
+            {
+                const int32 ChunkBytes = FMath::Min(ReadChunkBytes, Stream.Num() - Offset);
+                
+                // Stands in for Socket->Recv writing into the decoder, not timed
+                FMemory::Memcpy(Decoder.PrepareWrite(ChunkBytes), Stream.GetData() + Offset, ChunkBytes);
+                Decoder.CommitWrite(ChunkBytes);
+                
+                FUtf8StringView Frame;
+                while (true)
+                {
+                    double FrameStart = FPlatformTime::Seconds();
+                    if (Decoder.NextFrame(Frame) != EMCPFrameResult::Frame)
+                    {
+                        ReassemblySeconds += FPlatformTime::Seconds() - FrameStart;
+                        break;
+                    }
+                    ReassemblySeconds += FPlatformTime::Seconds() - FrameStart;
+                    ++FramesDecoded;
+                    
+                    double ParseStart = FPlatformTime::Seconds();
+                    TSharedPtr<FJsonObject> Parsed;
+                    TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(Frame);
+                    if (FJsonSerializer::Deserialize(Reader, Parsed) && Parsed.IsValid())
+                    {
+                        ++FramesParsed;
+                    }
+                    ParseSeconds += FPlatformTime::Seconds() - ParseStart;
+                }
+            }
+            
+            const double TotalMB = Stream.Num() / (1024.0 * 1024.0);
+            UE_LOG(LogTemp, Warning, TEXT("✓ %s framing, %d KB commands: %d/%d frames, reassembly %.1f MB/s, reassembly+parse %.1f MB/s (buffer capacity %d KB)"),
+                   FMCPFrameDecoder::ModeToString(Mode), Command.Num() / 1024, FramesParsed, NumMessages,
+                   TotalMB / FMath::Max(ReassemblySeconds, 1e-9),
+                   TotalMB / FMath::Max(ReassemblySeconds + ParseSeconds, 1e-9),
+                   Decoder.GetCapacity() / 1024);
+        }
+    }
+}
+
+/**
+ * Benchmark get_actors_in_level on a 10k-actor level through the string API
+ * (params serialized, result parsed back) and through ExecuteCommandJson,
+ * paging through every actor at the maximum page size
+ */
+void BenchmarkJsonExecutionPath()
+{
+    UE_LOG(LogTemp, Warning, TEXT("--- JSON Execution Path Benchmark ---"));
+    
+    FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World || !Registry.IsCommandRegistered(TEXT("get_actors_in_level")))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("✗ Skipped: no editor world or get_actors_in_level is not registered"));
+        return;
+    }
+    
+    // Populate the level with transient actors
+    const int32 NumActors = 10000;
+    TArray<AActor*> SpawnedActors;
+    SpawnedActors.Reserve(NumActors);
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.ObjectFlags |= RF_Transient;
+    for (int32 i = 0; i < NumActors; ++i)
+    {
+        const FVector Location(i % 100 * 100.0, i / 100 * 100.0, 0.0);
+        if (AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams))
+        {
+            SpawnedActors.Add(Actor);
+        }
+    }
+    
+    TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+    Params->SetNumberField(TEXT("limit"), FActorQueryParams::MaxLimit);
+    const int32 NumIterations = 5;
+    
+    // String path: what the bridge did before ExecuteCommandJson
+    int64 IntermediateBytes = 0;
+    double StringSeconds = 0.0;
+    int32 StringActorCount = 0;
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        double Start = FPlatformTime::Seconds();
+        
+        IntermediateBytes = 0;
+        StringActorCount = 0;
+        Params->RemoveField(TEXT("cursor"));
+        FString NextCursor;
+        do
+        {
+            FString ParamsString;
+            TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ParamsString);
+            FJsonSerializer::Serialize(Params.ToSharedRef(), Writer);
+            
+            FString ResultString = Registry.ExecuteCommand(TEXT("get_actors_in_level"), ParamsString);
+            
+            TSharedPtr<FJsonObject> Result;
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResultString);
+            FJsonSerializer::Deserialize(Reader, Result);
+            
+            IntermediateBytes += (ParamsString.Len() + ResultString.Len()) * sizeof(TCHAR);
+            const TArray<TSharedPtr<FJsonValue>>* Actors = nullptr;
+            if (Result.IsValid() && Result->TryGetArrayField(TEXT("actors"), Actors))
+            {
+                StringActorCount += Actors->Num();
+            }
+            NextCursor.Reset();
+            if (Result.IsValid() && Result->TryGetStringField(TEXT("next_cursor"), NextCursor))
+            {
+                Params->SetStringField(TEXT("cursor"), NextCursor);
+            }
+        }
+        while (!NextCursor.IsEmpty());
+        
+        StringSeconds += FPlatformTime::Seconds() - Start;
+    }
+    
+    // DOM path: the result object is used as-is
+    double JsonSeconds = 0.0;
+    int32 ActorCount = 0;
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        double Start = FPlatformTime::Seconds();
+        
+        ActorCount = 0;
+        Params->RemoveField(TEXT("cursor"));
+        FString NextCursor;
+        do
+        {
+            TSharedPtr<FJsonObject> Result = Registry.ExecuteCommandJson(TEXT("get_actors_in_level"), Params);
+            
+            const TArray<TSharedPtr<FJsonValue>>* Actors = nullptr;
+            if (Result.IsValid() && Result->TryGetArrayField(TEXT("actors"), Actors))
+            {
+                ActorCount += Actors->Num();
+            }
+            NextCursor.Reset();
+            if (Result.IsValid() && Result->TryGetStringField(TEXT("next_cursor"), NextCursor))
+            {
+                Params->SetStringField(TEXT("cursor"), NextCursor);
+            }
+        }
+        while (!NextCursor.IsEmpty());
+        
+        JsonSeconds += FPlatformTime::Seconds() - Start;
+    }
+    
+    const double StringMs = StringSeconds * 1000.0 / NumIterations;
+    const double JsonMs = JsonSeconds * 1000.0 / NumIterations;
+    UE_LOG(LogTemp, Warning, TEXT("%s get_actors_in_level (%d actors in pages of %d): string path %.2f ms, DOM path %.2f ms (%.1fx)"),
+           ActorCount == StringActorCount && ActorCount >= SpawnedActors.Num() ? TEXT("✓") : TEXT("✗"),
+           ActorCount, FActorQueryParams::MaxLimit, StringMs, JsonMs, StringMs / FMath::Max(JsonMs, 1e-6));
+    UE_LOG(LogTemp, Warning, TEXT("✓ Intermediate JSON text avoided per call: %.2f MB (one serialize + one parse of the result)"),
+           IntermediateBytes / (1024.0 * 1024.0));
+    
+    for (AActor* Actor : SpawnedActors)
+    {
+        World->DestroyActor(Actor);
+    }
+}
+
+/**
+ * Benchmark encoding the actors of a 50k-actor level, gathered from every
+ * get_actors_in_level page into one response, for the wire:
+ * FString serialization + UTF-8 conversion + framed copy, versus FMCPFrameEncoder
+ * writing UTF-8 straight into a reused frame buffer
+ */
+void BenchmarkUtf8ResponseEncoding()
+{
+    UE_LOG(LogTemp, Warning, TEXT("--- UTF-8 Response Encoding Benchmark ---"));
+    
+    FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World || !Registry.IsCommandRegistered(TEXT("get_actors_in_level")))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("✗ Skipped: no editor world or get_actors_in_level is not registered"));
+        return;
+    }
+    
+    const int32 NumActors = 50000;
+    TArray<AActor*> SpawnedActors;
+    SpawnedActors.Reserve(NumActors);
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.ObjectFlags |= RF_Transient;
+    for (int32 i = 0; i < NumActors; ++i)
+    {
+        const FVector Location(i % 250 * 100.0, i / 250 * 100.0, 0.0);
+        if (AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams))
+        {
+            SpawnedActors.Add(Actor);
+        }
+    }
+    
+    // A non-ASCII label makes character and byte counts differ
+    const FString NonAsciiLabel = TEXT("Acteur_Géant_Ω");
+    if (SpawnedActors.Num() > 0)
+    {
+        SpawnedActors[0]->SetActorLabel(NonAsciiLabel);
+    }
+    
+    // Page through every actor, with labels so the non-ASCII one is in the payload
+    TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+    Params->SetNumberField(TEXT("limit"), FActorQueryParams::MaxLimit);
+    TArray<TSharedPtr<FJsonValue>> Fields;
+    for (const TCHAR* FieldName : { TEXT("name"), TEXT("label"), TEXT("class"), TEXT("location"), TEXT("rotation"), TEXT("scale") })
+    {
+        Fields.Add(MakeShared<FJsonValueString>(FieldName));
+    }
+    Params->SetArrayField(TEXT("fields"), Fields);
+    TArray<TSharedPtr<FJsonValue>> AllActors;
+    FString NextCursor;
+    do
+    {
+        TSharedPtr<FJsonObject> Page = Registry.ExecuteCommandJson(TEXT("get_actors_in_level"), Params);
+        const TArray<TSharedPtr<FJsonValue>>* Actors = nullptr;
+        if (Page.IsValid() && Page->TryGetArrayField(TEXT("actors"), Actors))
+        {
+            AllActors.Append(*Actors);
+        }
+        NextCursor.Reset();
+        if (Page.IsValid() && Page->TryGetStringField(TEXT("next_cursor"), NextCursor))
+        {
+            Params->SetStringField(TEXT("cursor"), NextCursor);
+        }
+    }
+    while (!NextCursor.IsEmpty());
+    
+    auto ContainsLabel = [](const TArray<TSharedPtr<FJsonValue>>& Actors, const FString& Label)
+    {
+        return Actors.ContainsByPredicate([&Label](const TSharedPtr<FJsonValue>& Actor)
+        {
+            FString ActorLabel;
+            return Actor.IsValid() && Actor->Type == EJson::Object && Actor->AsObject()->TryGetStringField(TEXT("label"), ActorLabel) && ActorLabel == Label;
+        });
+    };
+    const bool bLabelReturned = ContainsLabel(AllActors, NonAsciiLabel);
+    
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetArrayField(TEXT("actors"), AllActors);
+    Result->SetNumberField(TEXT("count"), AllActors.Num());
+    TSharedRef<FJsonObject> Envelope = MakeShared<FJsonObject>();
+    Envelope->SetStringField(TEXT("status"), TEXT("success"));
+    Envelope->SetObjectField(TEXT("result"), Result);
+    
+    const int32 NumIterations = 5;
+    
+    // Old path: TCHAR text, converted copy, framed copy
+    TArray<uint8> LegacyFrame;
+    double LegacySeconds = 0.0;
+    int64 LegacyPeakBytes = 0;
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        double Start = FPlatformTime::Seconds();
+        
+        FString ResponseString;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResponseString);
+        FJsonSerializer::Serialize(Envelope, Writer);
+        
+        FTCHARToUTF8 Utf8Response(*ResponseString, ResponseString.Len());
+        LegacyFrame.Reset();
+        LegacyFrame.AddUninitialized(FMCPFrameDecoder::LengthPrefixSize);
+        FMCPFrameDecoder::EncodeLengthPrefix(static_cast<uint32>(Utf8Response.Length()), LegacyFrame.GetData());
+        LegacyFrame.Append(reinterpret_cast<const uint8*>(Utf8Response.Get()), Utf8Response.Length());
+        
+        LegacySeconds += FPlatformTime::Seconds() - Start;
+        LegacyPeakBytes = ResponseString.GetAllocatedSize() + Utf8Response.Length() + LegacyFrame.GetAllocatedSize();
+    }
+    
+    // New path: one UTF-8 buffer, reused across responses like a connection's SendBuffer
+    TArray<uint8> Frame;
+    double EncoderSeconds = 0.0;
+    int32 PayloadBytes = 0;
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        double Start = FPlatformTime::Seconds();
+        PayloadBytes = FMCPFrameEncoder::EncodeJson(Envelope, EMCPFramingMode::LengthPrefixed, Frame);
+        EncoderSeconds += FPlatformTime::Seconds() - Start;
+    }
+    const int64 EncoderPeakBytes = Frame.GetAllocatedSize();
+    
+    // The frame must decode back to the same document, with the prefix counting bytes
+    FMCPFrameDecoder Decoder(Frame.Num());
+    Decoder.SetMode(EMCPFramingMode::LengthPrefixed);
+    FMemory::Memcpy(Decoder.PrepareWrite(Frame.Num()), Frame.GetData(), Frame.Num());
+    Decoder.CommitWrite(Frame.Num());
+    FUtf8StringView DecodedFrame;
+    TSharedPtr<FJsonObject> RoundTrip;
+    const TSharedPtr<FJsonObject>* RoundTripResult = nullptr;
+    const TArray<TSharedPtr<FJsonValue>>* RoundTripActors = nullptr;
+    bool bRoundTripOk = Decoder.NextFrame(DecodedFrame) == EMCPFrameResult::Frame
+        && DecodedFrame.Len() == PayloadBytes
+        && FJsonSerializer::Deserialize(TJsonReaderFactory<UTF8CHAR>::CreateFromView(DecodedFrame), RoundTrip)
+        && RoundTrip.IsValid()
+        && RoundTrip->TryGetObjectField(TEXT("result"), RoundTripResult)
+        && (*RoundTripResult)->TryGetArrayField(TEXT("actors"), RoundTripActors)
+        && ContainsLabel(*RoundTripActors, NonAsciiLabel);
+    
+    const double LegacyMs = LegacySeconds * 1000.0 / NumIterations;
+    const double EncoderMs = EncoderSeconds * 1000.0 / NumIterations;
+    UE_LOG(LogTemp, Warning, TEXT("✓ %d-actor response (%.2f MB on the wire): FString path %.2f ms, UTF-8 encoder %.2f ms (%.1fx)"),
+           AllActors.Num(), PayloadBytes / (1024.0 * 1024.0), LegacyMs, EncoderMs, LegacyMs / FMath::Max(EncoderMs, 1e-6));
+    UE_LOG(LogTemp, Warning, TEXT("✓ Peak response buffers: FString path %.2f MB, UTF-8 encoder %.2f MB"),
+           LegacyPeakBytes / (1024.0 * 1024.0), EncoderPeakBytes / (1024.0 * 1024.0));
+    UE_LOG(LogTemp, Warning, TEXT("%s Non-ASCII label '%s' returned by get_actors_in_level"),
+           bLabelReturned ? TEXT("✓") : TEXT("✗"), *NonAsciiLabel);
+    UE_LOG(LogTemp, Warning, TEXT("%s Non-ASCII payload round-trips through length-prefixed framing"),
+           bRoundTripOk ? TEXT("✓") : TEXT("✗"));
+    
+    for (AActor* Actor : SpawnedActors)
+    {
+        World->DestroyActor(Actor);
+    }
+}
+
+/**
+ * Benchmark the blueprint action search index over the full action database:
+ * time to build the index, then average latency of typical search_blueprint_actions queries
+ */
+void BenchmarkBlueprintActionSearchIndex()
+{
+    UE_LOG(LogTemp, Warning, TEXT("--- Blueprint Action Search Index Benchmark ---"));
+    
+    // Make sure every action is registered so the build covers the whole engine action set
+    FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+    ActionDatabase.RefreshAll();
+    
+    FBlueprintActionSearchIndex& SearchIndex = FBlueprintActionSearchIndex::Get();
+    SearchIndex.Rebuild();
+    const FBlueprintActionSearchIndexStats BuildStats = SearchIndex.GetStats();
+    UE_LOG(LogTemp, Warning, TEXT("✓ Indexed %d actions from %d database entries (%d trigrams) in %.1f ms"),
+           BuildStats.IndexedActions, ActionDatabase.GetAllActions().Num(), BuildStats.TrigramCount, BuildStats.LastBuildMs);
+    
+    struct FBenchmarkQuery
+    {
+        const TCHAR* Query;
+        const TCHAR* Category;
+        int32 MaxResults;
+    };
+    const FBenchmarkQuery Queries[] = {
+        { TEXT("print"), TEXT(""), 50 },
+        { TEXT("GetActorLocation"), TEXT(""), 50 },
+        { TEXT("branch"), TEXT("flow"), 20 },
+        { TEXT("vector"), TEXT("math"), 50 },
+        { TEXT("add"), TEXT(""), 200 },
+        { TEXT("ma"), TEXT(""), 50 },
+        { TEXT("no_such_action_xyz"), TEXT(""), 50 }
+    };
+    
+    const int32 NumIterations = 200;
+    TArray<FBlueprintActionSearchEntry> Results;
+    double WorstAverageMs = 0.0;
+    
+    for (const FBenchmarkQuery& Query : Queries)
+    {
+        double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumIterations; ++i)
+        {
+            SearchIndex.Search(Query.Query, Query.Category, Query.MaxResults, Results);
+        }
+        const double AverageMs = (FPlatformTime::Seconds() - Start) * 1000.0 / NumIterations;
+        WorstAverageMs = FMath::Max(WorstAverageMs, AverageMs);
+        
+        UE_LOG(LogTemp, Warning, TEXT("  '%s' [%s] max %d: %d results, %.3f ms per query"),
+               Query.Query, Query.Category, Query.MaxResults, Results.Num(), AverageMs);
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("%s Slowest average query latency: %.3f ms"),
+           WorstAverageMs < 1.0 ? TEXT("✓") : TEXT("✗"), WorstAverageMs);
+}
+
+/**
+ * Benchmark the memoized action queries: the first (uncached) call for each common class
+ * and pin type against repeated calls served from FBlueprintActionResultCache
+ */
+void BenchmarkBlueprintActionResultCache()
+{
+    UE_LOG(LogTemp, Warning, TEXT("--- Blueprint Action Result Cache Benchmark ---"));
+    
+    FBlueprintActionResultCache& ResultCache = FBlueprintActionResultCache::Get();
+    ResultCache.Invalidate(TEXT("benchmark"));
+    ResultCache.ResetCacheStats();
+    
+    const TCHAR* ClassNames[] = { TEXT("Actor"), TEXT("Character"), TEXT("UserWidget"), TEXT("PlayerController") };
+    const int32 NumIterations = 200;
+    
+    for (const TCHAR* ClassName : ClassNames)
+    {
+        double Start = FPlatformTime::Seconds();
+        UUnrealMCPBlueprintActionCommands::GetActionsForClass(ClassName, TEXT(""), 50);
+        const double ColdMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+        
+        Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumIterations; ++i)
+        {
+            UUnrealMCPBlueprintActionCommands::GetActionsForClass(ClassName, TEXT(""), 50);
+        }
+        const double WarmMs = (FPlatformTime::Seconds() - Start) * 1000.0 / NumIterations;
+        
+        Start = FPlatformTime::Seconds();
+        UUnrealMCPBlueprintActionCommands::GetActionsForClassHierarchy(ClassName, TEXT(""), 50);
+        const double HierarchyColdMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+        
+        Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumIterations; ++i)
+        {
+            UUnrealMCPBlueprintActionCommands::GetActionsForClassHierarchy(ClassName, TEXT(""), 50);
+        }
+        const double HierarchyWarmMs = (FPlatformTime::Seconds() - Start) * 1000.0 / NumIterations;
+        
+        UE_LOG(LogTemp, Warning, TEXT("  %s: class %.2f ms cold / %.4f ms cached, hierarchy %.2f ms cold / %.4f ms cached"),
+               ClassName, ColdMs, WarmMs, HierarchyColdMs, HierarchyWarmMs);
+    }
+    
+    double Start = FPlatformTime::Seconds();
+    UUnrealMCPBlueprintActionCommands::GetActionsForPin(TEXT("object"), TEXT("PlayerController"), TEXT(""), 50);
+    const double PinColdMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+    
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        UUnrealMCPBlueprintActionCommands::GetActionsForPin(TEXT("object"), TEXT("PlayerController"), TEXT(""), 50);
+    }
+    const double PinWarmMs = (FPlatformTime::Seconds() - Start) * 1000.0 / NumIterations;
+    UE_LOG(LogTemp, Warning, TEXT("  object/PlayerController pin: %.2f ms cold / %.4f ms cached"), PinColdMs, PinWarmMs);
+    
+    const FBlueprintActionResultCacheStats Stats = ResultCache.GetCacheStats();
+    UE_LOG(LogTemp, Warning, TEXT("%s Result cache: %d requests, %d hits, %d misses (%.1f%% hit ratio), %d cached results"),
+           Stats.CacheHits > 0 ? TEXT("✓") : TEXT("✗"), Stats.TotalRequests, Stats.CacheHits, Stats.CacheMisses,
+           Stats.GetHitRatio() * 100.0f, Stats.CachedCount);
+}
+
+/**
+ * Benchmark short-name and path lookups through FAssetNameIndex, for names that exist
+ * and names that do not; neither case loads a package
+ */
+void BenchmarkAssetNameIndex()
+{
+    UE_LOG(LogTemp, Warning, TEXT("--- Asset Name Index Benchmark ---"));
+    
+    FAssetNameIndex& AssetIndex = FAssetNameIndex::Get();
+    const FAssetNameIndexStats BuildStats = AssetIndex.GetStats();
+    UE_LOG(LogTemp, Warning, TEXT("  Indexed %d assets under %d names in %.1f ms"),
+           BuildStats.IndexedAssets, BuildStats.DistinctNames, BuildStats.InitialBuildMs);
+    
+    // Pick an existing blueprint so the hit path is measured against a real asset
+    const TArray<FTopLevelAssetPath> BlueprintClassPaths = FAssetNameIndex::GetClassPathsDerivedFrom(UBlueprint::StaticClass());
+    TArray<FString> Blueprints;
+    AssetIndex.FindContaining(FString(), ESearchCase::IgnoreCase, BlueprintClassPaths, TEXT("/Game"), Blueprints);
+    const FString HitPath = Blueprints.Num() > 0 ? Blueprints[0] : FString();
+    const FString HitName = FPaths::GetBaseFilename(HitPath);
+    
+    const int32 NumIterations = 10000;
+    FAssetNameIndexEntry Entry;
+    
+    double Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        AssetIndex.FindBestByName(HitName, BlueprintClassPaths, TEXT("/Game"), TConstArrayView<FName>(), Entry);
+    }
+    const double HitUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumIterations;
+    
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        AssetIndex.FindBestByName(TEXT("BP_NoSuchBlueprint_xyz"), BlueprintClassPaths, TEXT("/Game"), TConstArrayView<FName>(), Entry);
+    }
+    const double MissUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumIterations;
+    
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        AssetIndex.FindByPath(HitPath, Entry);
+    }
+    const double PathUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumIterations;
+    
+    UE_LOG(LogTemp, Warning, TEXT("  '%s': %.2f us by name, %.2f us by path; missing name: %.2f us"),
+           *HitName, HitUs, PathUs, MissUs);
+    UE_LOG(LogTemp, Warning, TEXT("%s Slowest lookup: %.2f us"),
+           FMath::Max3(HitUs, MissUs, PathUs) < 100.0 ? TEXT("✓") : TEXT("✗"), FMath::Max3(HitUs, MissUs, PathUs));
+}
+
+/**
+ * Benchmark actor lookups by name and by label through FLevelActorIndex against the
+ * linear level scan it replaced
+ */
+void BenchmarkLevelActorIndex()
+{
+    UE_LOG(LogTemp, Warning, TEXT("--- Level Actor Index Benchmark ---"));
+    
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("  No editor world, skipped"));
+        return;
+    }
+    
+    // Look up the last actor the iterator visits, the worst case for a scan
+    AActor* Target = nullptr;
+    int32 NumActors = 0;
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        Target = *It;
+        ++NumActors;
+    }
+    if (!Target)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("  Level has no actors, skipped"));
+        return;
+    }
+    const FString TargetName = Target->GetName();
+    const FString TargetLabel = Target->GetActorLabel();
+    
+    FLevelActorIndex& ActorIndex = FLevelActorIndex::Get();
+    
+    // The first lookup builds the index
+    double Start = FPlatformTime::Seconds();
+    ActorIndex.FindByName(World, TargetName);
+    const double FirstLookupMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+    
+    const int32 NumScanIterations = 100;
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumScanIterations; ++i)
+    {
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            if (It->GetName() == TargetName)
+            {
+                break;
+            }
+        }
+    }
+    const double ScanUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumScanIterations;
+    
+    const int32 NumIterations = 10000;
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        ActorIndex.FindByName(World, TargetName);
+    }
+    const double NameUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumIterations;
+    
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        ActorIndex.FindByLabel(World, TargetLabel);
+    }
+    const double LabelUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumIterations;
+    
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        ActorIndex.FindByName(World, TEXT("NoSuchActor_xyz"));
+    }
+    const double MissUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumIterations;
+    
+    UE_LOG(LogTemp, Warning, TEXT("  %d actors; first lookup (builds index): %.2f ms"), NumActors, FirstLookupMs);
+    UE_LOG(LogTemp, Warning, TEXT("  Scan: %.2f us; by name: %.2f us, by label: %.2f us, missing name: %.2f us"),
+           ScanUs, NameUs, LabelUs, MissUs);
+    UE_LOG(LogTemp, Warning, TEXT("%s Slowest indexed lookup: %.2f us"),
+           FMath::Max3(NameUs, LabelUs, MissUs) < 10.0 ? TEXT("✓") : TEXT("✗"), FMath::Max3(NameUs, LabelUs, MissUs));
+}
+
+/**
+ * Benchmark import_datatable_rows and export_datatable_rows at 10k and 100k rows in both
+ * formats, on a transient table whose row struct has one field of each common type
+ */
+void BenchmarkDataTableBulkImportExport()
+{
+    UE_LOG(LogTemp, Warning, TEXT("--- DataTable Bulk Import/Export Benchmark ---"));
+    
+    UUserDefinedStruct* RowStruct = FStructureEditorUtils::CreateUserDefinedStruct(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UUserDefinedStruct::StaticClass(), TEXT("MCPBenchmarkRow")), RF_Transient);
+    if (!RowStruct)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("  Could not create the row struct, skipped"));
+        return;
+    }
+    
+    // A new struct starts with one placeholder bool variable, which is replaced by these
+    const TArray<TPair<FString, FEdGraphPinType>> Fields = {
+        { TEXT("Id"), FEdGraphPinType(UEdGraphSchema_K2::PC_Int, NAME_None, nullptr, EPinContainerType::None, false, FEdGraphTerminalType()) },
+        { TEXT("Score"), FEdGraphPinType(UEdGraphSchema_K2::PC_Real, UEdGraphSchema_K2::PC_Double, nullptr, EPinContainerType::None, false, FEdGraphTerminalType()) },
+        { TEXT("Label"), FEdGraphPinType(UEdGraphSchema_K2::PC_String, NAME_None, nullptr, EPinContainerType::None, false, FEdGraphTerminalType()) },
+        { TEXT("Tag"), FEdGraphPinType(UEdGraphSchema_K2::PC_Name, NAME_None, nullptr, EPinContainerType::None, false, FEdGraphTerminalType()) },
+        { TEXT("Enabled"), FEdGraphPinType(UEdGraphSchema_K2::PC_Boolean, NAME_None, nullptr, EPinContainerType::None, false, FEdGraphTerminalType()) }
+    };
+    TArray<FGuid> PlaceholderGuids;
+    for (const FStructVariableDescription& Desc : FStructureEditorUtils::GetVarDesc(RowStruct))
+    {
+        PlaceholderGuids.Add(Desc.VarGuid);
+    }
+    for (const TPair<FString, FEdGraphPinType>& Field : Fields)
+    {
+        FStructureEditorUtils::AddVariable(RowStruct, Field.Value);
+        FStructureEditorUtils::RenameVariable(RowStruct, FStructureEditorUtils::GetVarDesc(RowStruct).Last().VarGuid, Field.Key);
+    }
+    for (const FGuid& Guid : PlaceholderGuids)
+    {
+        FStructureEditorUtils::RemoveVariable(RowStruct, Guid);
+    }
+    FStructureEditorUtils::CompileStructure(RowStruct);
+    
+    UDataTable* DataTable = NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+    DataTable->RowStruct = RowStruct;
+    
+    FDataTableService DataTableService;
+    double SlowestRowsPerSecond = TNumericLimits<double>::Max();
+    
+    for (const int32 NumRows : { 10000, 100000 })
+    {
+        FString JsonLines;
+        FString Csv = TEXT("---,Id,Score,Label,Tag,Enabled\n");
+        for (int32 i = 0; i < NumRows; ++i)
+        {
+            JsonLines += FString::Printf(TEXT("{\"row_name\":\"Row_%d\",\"row_data\":{\"Id\":%d,\"Score\":%.2f,\"Label\":\"Item %d, bulk\",\"Tag\":\"T%d\",\"Enabled\":%s}}\n"),
+                i, i, i * 0.25, i, i % 64, (i % 2) ? TEXT("true") : TEXT("false"));
+            Csv += FString::Printf(TEXT("Row_%d,%d,%.2f,\"Item %d, bulk\",T%d,%s\n"),
+                i, i, i * 0.25, i, i % 64, (i % 2) ? TEXT("True") : TEXT("False"));
+        }
+        
+        for (const EDataTableRowFormat Format : { EDataTableRowFormat::JsonLines, EDataTableRowFormat::Csv })
+        {
+            const TCHAR* FormatName = Format == EDataTableRowFormat::Csv ? TEXT("CSV") : TEXT("JSONL");
+            
+            FDataTableImportParams ImportParams;
+            ImportParams.Format = Format;
+            ImportParams.Data = Format == EDataTableRowFormat::Csv ? Csv : JsonLines;
+            ImportParams.bReplace = true;
+            FDataTableImportResult ImportResult;
+            FString Error;
+            if (!DataTableService.ImportDataTableRows(DataTable, ImportParams, ImportResult, Error) || ImportResult.ImportedCount != NumRows)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("  %d rows %s: import failed (%d imported, %d failed) %s"),
+                       NumRows, FormatName, ImportResult.ImportedCount, ImportResult.ErrorCount, *Error);
+                SlowestRowsPerSecond = 0.0;
+                continue;
+            }
+            
+            // Page through the whole table at the maximum page size
+            FDataTableExportParams ExportParams;
+            ExportParams.Format = Format;
+            ExportParams.Limit = FDataTableExportParams::MaxLimit;
+            int32 ExportedRows = 0;
+            double ExportMs = 0.0;
+            do
+            {
+                FDataTableExportResult ExportResult;
+                DataTableService.ExportDataTableRows(DataTable, ExportParams, ExportResult, Error);
+                ExportedRows += ExportResult.RowCount;
+                ExportMs += ExportResult.DurationMs;
+                ExportParams.Cursor = ExportResult.NextCursor;
+            }
+            while (!ExportParams.Cursor.IsEmpty());
+            const double ExportRowsPerSecond = ExportMs > 0.0 ? ExportedRows * 1000.0 / ExportMs : 0.0;
+            
+            UE_LOG(LogTemp, Warning, TEXT("  %d rows %s: import %.1f ms (%.0f rows/s), export %.1f ms (%.0f rows/s)"),
+                   NumRows, FormatName, ImportResult.DurationMs, ImportResult.GetRowsPerSecond(), ExportMs, ExportRowsPerSecond);
+            SlowestRowsPerSecond = FMath::Min3(SlowestRowsPerSecond, ImportResult.GetRowsPerSecond(), ExportRowsPerSecond);
+        }
+    }
+    
+    DataTable->EmptyTable();
+    UE_LOG(LogTemp, Warning, TEXT("%s Slowest: %.0f rows/s"),
+           SlowestRowsPerSecond >= 50000.0 ? TEXT("✓") : TEXT("✗"), SlowestRowsPerSecond);
+}
+
+/**
+ * Benchmark field lookups through FStructSchemaCache against the per-call reflection walk
+ * it replaced, on a struct with several hundred fields
+ */
+void BenchmarkStructSchemaCache()
+{
+    UE_LOG(LogTemp, Warning, TEXT("--- Struct Schema Cache Benchmark ---"));
+    
+    const UScriptStruct* Struct = FPostProcessSettings::StaticStruct();
+    FStructSchemaCache& SchemaCache = FStructSchemaCache::Get();
+    SchemaCache.Invalidate(Struct);
+    
+    double Start = FPlatformTime::Seconds();
+    const TSharedRef<const FStructSchema> Schema = SchemaCache.GetSchema(Struct);
+    const double BuildMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+    
+    // The last field is the worst case for a walk
+    const FString TargetName = Schema->Fields.Num() > 0 ? Schema->Fields.Last().AuthoredName : FString();
+    
+    const int32 NumWalkIterations = 1000;
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumWalkIterations; ++i)
+    {
+        // What each row paid before: build the name map, then find the field
+        TMap<FString, FString> NameMap;
+        for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+        {
+            NameMap.Add(PropIt->GetName(), PropIt->GetAuthoredName());
+        }
+        NameMap.Find(TargetName);
+    }
+    const double WalkUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumWalkIterations;
+    
+    const int32 NumIterations = 100000;
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        SchemaCache.GetSchema(Struct)->FindField(TargetName);
+    }
+    const double CachedUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumIterations;
+    
+    UE_LOG(LogTemp, Warning, TEXT("  %s: %d fields, schema built in %.2f ms"), *Struct->GetName(), Schema->Fields.Num(), BuildMs);
+    UE_LOG(LogTemp, Warning, TEXT("  Reflection walk: %.2f us; cached lookup: %.3f us"), WalkUs, CachedUs);
+    UE_LOG(LogTemp, Warning, TEXT("%s Cached lookup: %.3f us"),
+           CachedUs < 1.0 ? TEXT("✓") : TEXT("✗"), CachedUs);
+}
+
 /**
  * Memory usage benchmark
  */
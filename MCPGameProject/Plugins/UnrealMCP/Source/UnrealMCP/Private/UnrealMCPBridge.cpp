@@ -1,5 +1,7 @@
 #include "UnrealMCPBridge.h"
 #include "MCPServerRunnable.h"
+#include "MCPServerConfig.h"
+#include "MCPLogging.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
 #include "HAL/RunnableThread.h"
@@ -61,6 +63,8 @@
 #include "Commands/BlueprintAction/UnrealMCPBlueprintActionCommandsHandler.h"
 #include "Commands/EditorCommandRegistration.h"
 #include "Commands/DataTableCommandRegistration.h"
+#include "Commands/Batch/ExecuteBatchCommand.h"
+#include "Services/AssetDirtySet.h"
 
 // Default settings
 #define MCP_SERVER_HOST "127.0.0.1"
@@ -74,6 +78,8 @@ UUnrealMCPBridge::UUnrealMCPBridge()
     ProjectCommands = MakeShared<FUnrealMCPProjectCommands>();
     UMGCommands = MakeShared<FUnrealMCPUMGCommands>();
     BlueprintActionCommands = MakeShared<FUnrealMCPBlueprintActionCommandsHandler>();
+    
+    BuildLegacyCommandRoutes();
 }
 
 UUnrealMCPBridge::~UUnrealMCPBridge()
@@ -86,6 +92,114 @@ UUnrealMCPBridge::~UUnrealMCPBridge()
     BlueprintActionCommands.Reset();
 }
 
+// Build the name -> handler table for commands that have not moved to the registry yet
+void UUnrealMCPBridge::BuildLegacyCommandRoutes()
+{
+    // Earlier lists win when a command appears in more than one
+    auto AddRoutes = [this](TArrayView<const TCHAR* const> CommandNames, auto Handler)
+    {
+        for (const TCHAR* CommandName : CommandNames)
+        {
+            FName CommandKey(CommandName);
+            if (!LegacyCommandRoutes.Contains(CommandKey))
+            {
+                LegacyCommandRoutes.Add(CommandKey, [Handler](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+                {
+                    return Handler->HandleCommand(CommandType, Params);
+                });
+            }
+        }
+    };
+    
+    static const TCHAR* const EditorCommandsList[] = {
+        TEXT("get_actors_in_level"), 
+        TEXT("find_actors_by_name"),
+        TEXT("spawn_actor"),
+        TEXT("create_actor"),
+        TEXT("delete_actor"), 
+        TEXT("set_actor_transform"),
+        TEXT("get_actor_properties"),
+        TEXT("set_actor_property"),
+        TEXT("set_light_property"),
+        TEXT("spawn_blueprint_actor"),
+        TEXT("focus_viewport"), 
+        TEXT("take_screenshot")
+    };
+    AddRoutes(EditorCommandsList, EditorCommands);
+    
+    static const TCHAR* const BlueprintCommandsList[] = {
+        TEXT("create_blueprint"), 
+        TEXT("add_component_to_blueprint"), 
+        TEXT("set_component_property"), 
+        TEXT("set_physics_properties"), 
+        TEXT("compile_blueprint"), 
+        TEXT("set_blueprint_property"), 
+        TEXT("set_static_mesh_properties"),
+        TEXT("set_pawn_properties"),
+        TEXT("call_function_by_name"),
+        TEXT("add_interface_to_blueprint"),
+        TEXT("create_blueprint_interface"),
+        TEXT("list_blueprint_components"),
+        TEXT("create_custom_blueprint_function")
+    };
+    AddRoutes(BlueprintCommandsList, BlueprintCommands);
+    
+    static const TCHAR* const BlueprintNodeCommandsList[] = {
+        TEXT("connect_blueprint_nodes"), 
+        TEXT("find_blueprint_nodes"),
+        TEXT("add_blueprint_event_node"),
+        // TEXT("add_blueprint_input_action_node"),  // REMOVED: Use create_node_by_action_name instead
+        // TEXT("add_enhanced_input_action_node"),  // REMOVED: Use create_node_by_action_name instead
+        TEXT("add_blueprint_function_node"),
+        TEXT("add_blueprint_get_component_node"),
+        TEXT("add_blueprint_variable"),
+        TEXT("add_blueprint_custom_event_node"),
+        TEXT("get_variable_info"),
+        TEXT("create_node_by_action_name")
+    };
+    AddRoutes(BlueprintNodeCommandsList, BlueprintNodeCommands);
+    
+    static const TCHAR* const ProjectCommandsList[] = {
+        TEXT("create_input_mapping"),
+        TEXT("create_enhanced_input_action"),
+        TEXT("create_input_mapping_context"),
+        TEXT("add_mapping_to_context"),
+        TEXT("list_input_actions"),
+        TEXT("list_input_mapping_contexts"),
+        TEXT("create_folder"),
+        TEXT("create_struct"),
+        TEXT("update_struct"),
+        TEXT("get_project_dir"),
+        TEXT("show_struct_variables"),
+        TEXT("list_folder_contents")
+    };
+    AddRoutes(ProjectCommandsList, ProjectCommands);
+    
+    static const TCHAR* const UMGCommandsList[] = {
+        TEXT("create_umg_widget_blueprint"),
+        TEXT("bind_widget_component_event"),
+        TEXT("set_text_block_widget_component_binding"),
+        TEXT("add_widget_to_viewport"),
+        TEXT("create_parent_and_child_widget_components"),
+        TEXT("add_child_widget_component_to_parent"),
+        TEXT("check_widget_component_exists"),
+        TEXT("set_widget_component_placement"),
+        TEXT("get_widget_container_component_dimensions"),
+        TEXT("add_widget_component_to_widget"),
+        TEXT("set_widget_component_property"),
+        TEXT("get_widget_component_layout")
+    };
+    AddRoutes(UMGCommandsList, UMGCommands);
+    
+    static const TCHAR* const BlueprintActionCommandsList[] = {
+        TEXT("get_actions_for_pin"),
+        TEXT("get_actions_for_class"),
+        TEXT("get_node_pin_info"),
+        TEXT("create_node_by_action_name")
+    };
+    AddRoutes(BlueprintActionCommandsList, BlueprintActionCommands);
+}
+
 // Initialize subsystem
 void UUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -99,9 +213,43 @@ void UUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
     FIPv4Address::Parse(MCP_SERVER_HOST, ServerAddress);
 
     // Register new command system
+    FUnrealMCPCommandRegistry::Get().BeginBatch();
     FEditorCommandRegistration::RegisterAllCommands();
     FDataTableCommandRegistration::RegisterAllCommands();
     
+    // Commands from connection threads are drained on the game thread in per-frame batches
+    GameThreadDispatcher = MakeShared<FMCPGameThreadDispatcher>(
+        [this](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+        {
+            return ExecuteCommandOnGameThread(CommandType, Params);
+        },
+        FMCPServerConfig::Load().GameThreadBudgetMs);
+    GameThreadDispatcher->Start();
+    
+    // Commands that don't need the game thread run concurrently on the worker pool
+    WorkerLane = MakeShared<FMCPWorkerCommandLane>(
+        [this](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+        {
+            return ExecuteCommandOnWorkerThread(CommandType, Params);
+        });
+    
+    // Batched operations use the same routing as individual commands, legacy handlers included
+    FUnrealMCPCommandRegistry::Get().RegisterCommand(MakeShared<FExecuteBatchCommand>(
+        [this](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+        {
+            return ExecuteCommandOnGameThread(CommandType, Params);
+        },
+        [this](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+        {
+            return ExecuteCommandOnWorkerThread(CommandType, Params);
+        },
+        [this](TFunction<void()> Work)
+        {
+            // Each wave's game-thread work shares the dispatcher's queue and frame budget with other commands
+            return GameThreadDispatcher->EnqueueWork(MoveTemp(Work));
+        }));
+    FUnrealMCPCommandRegistry::Get().EndBatch();
+    
     // Start the server automatically
     StartServer();
 }
@@ -112,10 +260,28 @@ void UUnrealMCPBridge::Deinitialize()
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Shutting down"));
     
     // Unregister editor commands
+    FUnrealMCPCommandRegistry::Get().BeginBatch();
     FEditorCommandRegistration::UnregisterAllCommands();
     FDataTableCommandRegistration::UnregisterAllCommands();
+    FUnrealMCPCommandRegistry::Get().UnregisterCommand(TEXT("execute_batch"));
+    FUnrealMCPCommandRegistry::Get().EndBatch();
+    
+    // Fail queued commands first so no connection thread is left waiting on the game thread
+    if (GameThreadDispatcher.IsValid())
+    {
+        GameThreadDispatcher->Shutdown();
+    }
+    if (WorkerLane.IsValid())
+    {
+        WorkerLane->Shutdown();
+    }
     
     StopServer();
+    GameThreadDispatcher.Reset();
+    WorkerLane.Reset();
+    
+    // Commit what clients modified while the editor can still save
+    FAssetDirtySet::Get().Flush();
 }
 
 // Start the MCP server
@@ -155,8 +321,9 @@ void UUnrealMCPBridge::StartServer()
         return;
     }
 
-    // Start listening
-    if (!NewListenerSocket->Listen(5))
+    // Start listening; the backlog covers a burst of clients connecting at once
+    const int32 ListenBacklog = FMath::Max(5, FMCPServerConfig::Load().MaxConnections);
+    if (!NewListenerSocket->Listen(ListenBacklog))
     {
         UE_LOG(LogTemp, Error, TEXT("UnrealMCPBridge: Failed to start listening"));
         return;
@@ -215,216 +382,180 @@ void UUnrealMCPBridge::StopServer()
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Server stopped"));
 }
 
-// Execute a command received from a client
-FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+namespace
 {
-    UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Executing command: %s"), *CommandType);
-    
-    // Create a promise to wait for the result
-    TPromise<FString> Promise;
-    TFuture<FString> Future = Promise.GetFuture();
-    
-    // Queue execution on Game Thread
-    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
+    // Wrap a command result in the {"status", "result"/"error"} envelope
+    void FillResponseEnvelope(const TSharedRef<FJsonObject>& ResponseJson, const TSharedPtr<FJsonObject>& ResultJson)
     {
-        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+        // Check if the result contains an error
+        bool bSuccess = true;
+        FString ErrorMessage;
         
-        try
+        if (ResultJson->HasField(TEXT("success")))
         {
-            TSharedPtr<FJsonObject> ResultJson;
-            
-            if (CommandType == TEXT("ping"))
+            bSuccess = ResultJson->GetBoolField(TEXT("success"));
+            if (!bSuccess && ResultJson->HasField(TEXT("error")))
             {
-                ResultJson = MakeShareable(new FJsonObject);
-                ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+                ErrorMessage = ResultJson->GetStringField(TEXT("error"));
             }
-            else
+        }
+        
+        if (bSuccess)
+        {
+            // Set success status and include the result
+            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+            ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+        }
+        else
+        {
+            // Set error status and include the error message
+            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+            ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+            
+            // Keep the error type of commands that tell retryable failures apart, e.g. "timeout"
+            FString ErrorType;
+            if (ResultJson->TryGetStringField(TEXT("error_type"), ErrorType))
             {
-                // Define command arrays for better maintenance
-                static const TArray<FString> EditorCommands = {
-                    TEXT("get_actors_in_level"), 
-                    TEXT("find_actors_by_name"),
-                    TEXT("spawn_actor"),
-                    TEXT("create_actor"),
-                    TEXT("delete_actor"), 
-                    TEXT("set_actor_transform"),
-                    TEXT("get_actor_properties"),
-                    TEXT("set_actor_property"),
-                    TEXT("set_light_property"),
-                    TEXT("spawn_blueprint_actor"),
-                    TEXT("focus_viewport"), 
-                    TEXT("take_screenshot")
-                };
-                
-                static const TArray<FString> BlueprintCommandsList = {
-                    TEXT("create_blueprint"), 
-                    TEXT("add_component_to_blueprint"), 
-                    TEXT("set_component_property"), 
-                    TEXT("set_physics_properties"), 
-                    TEXT("compile_blueprint"), 
-                    TEXT("set_blueprint_property"), 
-                    TEXT("set_static_mesh_properties"),
-                    TEXT("set_pawn_properties"),
-                    TEXT("call_function_by_name"),
-                    TEXT("add_interface_to_blueprint"),
-                    TEXT("create_blueprint_interface"),
-                    TEXT("list_blueprint_components"),
-                    TEXT("create_custom_blueprint_function")
-                };
-                
-                static const TArray<FString> BlueprintNodeCommandsList = {
-                    TEXT("connect_blueprint_nodes"), 
-                    TEXT("find_blueprint_nodes"),
-                    TEXT("add_blueprint_event_node"),
-                    // TEXT("add_blueprint_input_action_node"),  // REMOVED: Use create_node_by_action_name instead
-                    // TEXT("add_enhanced_input_action_node"),  // REMOVED: Use create_node_by_action_name instead
-                    TEXT("add_blueprint_function_node"),
-                    TEXT("add_blueprint_get_component_node"),
-                    TEXT("add_blueprint_variable"),
-                    TEXT("add_blueprint_custom_event_node"),
-                    TEXT("get_variable_info"),
-                    TEXT("create_node_by_action_name")
-                };
-                
-                static const TArray<FString> ProjectCommandsList = {
-                    TEXT("create_input_mapping"),
-                    TEXT("create_enhanced_input_action"),
-                    TEXT("create_input_mapping_context"),
-                    TEXT("add_mapping_to_context"),
-                    TEXT("list_input_actions"),
-                    TEXT("list_input_mapping_contexts"),
-                    TEXT("create_folder"),
-                    TEXT("create_struct"),
-                    TEXT("update_struct"),
-                    TEXT("get_project_dir"),
-                    TEXT("show_struct_variables"),
-                    TEXT("list_folder_contents")
-                };
-                
-                static const TArray<FString> UMGCommandsList = {
-                    TEXT("create_umg_widget_blueprint"),
-                    TEXT("bind_widget_component_event"),
-                    TEXT("set_text_block_widget_component_binding"),
-                    TEXT("add_widget_to_viewport"),
-                    TEXT("create_parent_and_child_widget_components"),
-                    TEXT("add_child_widget_component_to_parent"),
-                    TEXT("check_widget_component_exists"),
-                    TEXT("set_widget_component_placement"),
-                    TEXT("get_widget_container_component_dimensions"),
-                    TEXT("add_widget_component_to_widget"),
-                    TEXT("set_widget_component_property"),
-                    TEXT("get_widget_component_layout")
-                };
-                
-                static const TArray<FString> BlueprintActionCommandsList = {
-                    TEXT("get_actions_for_pin"),
-                    TEXT("get_actions_for_class"),
-                    TEXT("get_node_pin_info"),
-                    TEXT("create_node_by_action_name")
-                };
-                
-                // First check the new command registry system
-                FUnrealMCPCommandRegistry& CommandRegistry = FUnrealMCPCommandRegistry::Get();
-                if (CommandRegistry.IsCommandRegistered(CommandType))
-                {
-                    // Convert TSharedPtr<FJsonObject> to JSON string for new command interface
-                    FString ParamsString;
-                    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ParamsString);
-                    FJsonSerializer::Serialize(Params.ToSharedRef(), Writer);
-                    
-                    // Execute command through new registry
-                    FString CommandResult = CommandRegistry.ExecuteCommand(CommandType, ParamsString);
-                    
-                    // Parse result back to JSON object
-                    TSharedPtr<FJsonObject> ParsedResult;
-                    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(CommandResult);
-                    if (FJsonSerializer::Deserialize(Reader, ParsedResult) && ParsedResult.IsValid())
-                    {
-                        ResultJson = ParsedResult;
-                    }
-                    else
-                    {
-                        // If parsing fails, create error response
-                        ResultJson = MakeShared<FJsonObject>();
-                        ResultJson->SetBoolField(TEXT("success"), false);
-                        ResultJson->SetStringField(TEXT("error"), TEXT("Failed to parse command result"));
-                    }
-                }
-                // Fall back to legacy command handlers
-                else if (EditorCommands.Contains(CommandType))
-                {
-                    ResultJson = this->EditorCommands->HandleCommand(CommandType, Params);
-                }
-                else if (BlueprintCommandsList.Contains(CommandType))
-                {
-                    ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
-                }
-                else if (BlueprintNodeCommandsList.Contains(CommandType))
-                {
-                    ResultJson = BlueprintNodeCommands->HandleCommand(CommandType, Params);
-                }
-                else if (ProjectCommandsList.Contains(CommandType))
-                {
-                    ResultJson = ProjectCommands->HandleCommand(CommandType, Params);
-                }
-                else if (UMGCommandsList.Contains(CommandType))
-                {
-                    ResultJson = UMGCommands->HandleCommand(CommandType, Params);
-                }
-                else if (BlueprintActionCommandsList.Contains(CommandType))
-                {
-                    ResultJson = BlueprintActionCommands->HandleCommand(CommandType, Params);
-                }
-                else
-                {
-                    ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                    ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
-                    
-                    FString ResultString;
-                    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-                    FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-                    Promise.SetValue(ResultString);
-                    return;
-                }
+                ResponseJson->SetStringField(TEXT("error_type"), ErrorType);
             }
+        }
+    }
+}
+
+// Execute a command received from a client, blocking until the command has produced the response or timed out
+FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, double TimeoutSeconds)
+{
+    FString ResultString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
+    FJsonSerializer::Serialize(ExecuteCommandJson(CommandType, Params, TimeoutSeconds), Writer);
+    return ResultString;
+}
+
+// Execute a command and return the response envelope without serializing it
+TSharedRef<FJsonObject> UUnrealMCPBridge::ExecuteCommandJson(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, double TimeoutSeconds)
+{
+    UE_LOG_MCP_NETWORK_VERBOSE(TEXT("UnrealMCPBridge: Executing command: %s"), *CommandType);
+    
+    // Create a promise to wait for the result
+    TSharedRef<TPromise<TSharedPtr<FJsonObject>>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<TSharedPtr<FJsonObject>>, ESPMode::ThreadSafe>();
+    TFuture<TSharedPtr<FJsonObject>> Future = Promise->GetFuture();
+    
+    FMCPCommandHandleRef Handle = ExecuteCommandAsync(CommandType, Params, [Promise](const TSharedRef<FJsonObject>& ResponseJson)
+    {
+        Promise->SetValue(ResponseJson);
+    }, TimeoutSeconds);
+    
+    // The handle completes exactly once, so a timeout fulfils the promise and a late result is dropped
+    if (TimeoutSeconds > 0.0)
+    {
+        while (!Future.WaitFor(FTimespan::FromSeconds(FMath::Max(Handle->GetRemainingSeconds(), 0.001))))
+        {
+            Handle->CheckDeadline();
+        }
+    }
+    
+    return Future.Get().ToSharedRef();
+}
+
+// Queue a command on the lane matching its thread affinity and report the response object through a callback
+FMCPCommandHandleRef UUnrealMCPBridge::ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FMCPCommandCompletion OnComplete, double TimeoutSeconds, FMCPCommandProgress OnProgress)
+{
+    FMCPCommandHandleRef Handle = MakeShared<FMCPCommandHandle, ESPMode::ThreadSafe>(CommandType, TimeoutSeconds, MoveTemp(OnComplete), MoveTemp(OnProgress));
+    
+    if (!GameThreadDispatcher.IsValid() || !WorkerLane.IsValid())
+    {
+        TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), TEXT("MCP bridge is not initialized"));
+        Handle->Complete(ResponseJson);
+        return Handle;
+    }
+    
+    const EMCPCommandThreadAffinity Affinity = FUnrealMCPCommandRegistry::Get().GetCommandThreadAffinity(CommandType);
+    bool bUseWorkerLane = Affinity == EMCPCommandThreadAffinity::AnyThread;
+    if (Affinity == EMCPCommandThreadAffinity::AssetRegistrySafe)
+    {
+        // During the initial scan the registry is still being filled from the game thread
+        IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+        bUseWorkerLane = AssetRegistry && !AssetRegistry->IsLoadingAssets();
+    }
+    
+    if (bUseWorkerLane)
+    {
+        WorkerLane->Enqueue(Handle, Params);
+    }
+    else
+    {
+        GameThreadDispatcher->Enqueue(Handle, Params);
+    }
+    
+    return Handle;
+}
+
+FMCPGameThreadDispatcherStats UUnrealMCPBridge::GetGameThreadDispatcherStats() const
+{
+    return GameThreadDispatcher.IsValid() ? GameThreadDispatcher->GetStats() : FMCPGameThreadDispatcherStats();
+}
+
+int32 UUnrealMCPBridge::GetWorkerLaneInFlight() const
+{
+    return WorkerLane.IsValid() ? WorkerLane->GetInFlightCount() : 0;
+}
+
+// Route a command to its handler and wrap the result in the {"status", "result"/"error"} envelope
+TSharedRef<FJsonObject> UUnrealMCPBridge::ExecuteCommandOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    check(IsInGameThread());
+    
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    try
+    {
+        TSharedPtr<FJsonObject> ResultJson;
+        
+        if (CommandType == TEXT("ping"))
+        {
+            ResultJson = MakeShareable(new FJsonObject);
+            ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+        }
+        else
+        {
+            // Registry commands take precedence over the legacy handlers; neither lookup takes a lock
+            FUnrealMCPCommandRegistry& CommandRegistry = FUnrealMCPCommandRegistry::Get();
+            const FName CommandKey(*CommandType, FNAME_Find);
+            const FLegacyCommandHandler* LegacyHandler = CommandKey.IsNone() ? nullptr : LegacyCommandRoutes.Find(CommandKey);
             
-            // Check if the result contains an error
-            bool bSuccess = true;
-            FString ErrorMessage;
-            
-            if (ResultJson->HasField(TEXT("success")))
+            if (TSharedPtr<IUnrealMCPCommand> Command = CommandRegistry.FindCommand(CommandType))
             {
-                bSuccess = ResultJson->GetBoolField(TEXT("success"));
-                if (!bSuccess && ResultJson->HasField(TEXT("error")))
-                {
-                    ErrorMessage = ResultJson->GetStringField(TEXT("error"));
-                }
+                // Hand the parsed params straight to the registry; no string round-trip
+                ResultJson = CommandRegistry.ExecuteCommandJson(Command, Params);
             }
-            
-            if (bSuccess)
+            else if (LegacyHandler)
             {
-                // Set success status and include the result
-                ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-                ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+                ResultJson = (*LegacyHandler)(CommandType, Params);
             }
             else
             {
-                // Set error status and include the error message
                 ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+                ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
+                return ResponseJson;
             }
         }
-        catch (const std::exception& e)
-        {
-            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-            ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
-        }
         
-        FString ResultString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-        Promise.SetValue(ResultString);
-    });
+        FillResponseEnvelope(ResponseJson, ResultJson);
+    }
+    catch (const std::exception& e)
+    {
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+    }
     
-    return Future.Get();
-}
\ No newline at end of file
+    return ResponseJson;
+}
+
+// Run a registry command that declared it does not need the game thread
+TSharedRef<FJsonObject> UUnrealMCPBridge::ExecuteCommandOnWorkerThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    FillResponseEnvelope(ResponseJson, FUnrealMCPCommandRegistry::Get().ExecuteCommandJson(CommandType, Params));
+    return ResponseJson;
+}
@@ -3,6 +3,15 @@
 #include "Factories/ComponentFactory.h"
 #include "Factories/WidgetFactory.h"
 #include "Services/ObjectPoolManager.h"
+#include "Services/BlueprintActionSearchIndex.h"
+#include "Services/BlueprintActionResultCache.h"
+#include "Services/NodePinCatalog.h"
+#include "Services/AssetNameIndex.h"
+#include "Services/ObjectResolutionCache.h"
+#include "Services/LevelActorIndex.h"
+#include "Services/AssetDirtySet.h"
+#include "Services/BlueprintCompileCache.h"
+#include "Services/StructSchemaCache.h"
 #include "Commands/UnrealMCPMainDispatcher.h"
 #include "MCPLogging.h"
 #include "Modules/ModuleManager.h"
@@ -37,6 +46,24 @@ void FUnrealMCPModule::StartupModule()
 	
 	UE_LOG_MCP_INFO("WidgetFactory initialized with default widget types");
 	
+	// Index asset names so lookups by short name never scan the asset registry
+	FAssetNameIndex::Get().Initialize();
+	FObjectResolutionCache::Get().Initialize();
+	
+	UE_LOG_MCP_INFO("Asset name index and object resolution cache initialized");
+	
+	// Index level actors by name and label so actor commands never scan the level
+	FLevelActorIndex::Get().Initialize();
+	
+	// Hold back compiles and saves so repeated edits to one asset are committed once
+	FAssetDirtySet::Get().Initialize();
+	
+	// Remember successful compiles so an unchanged blueprint is not compiled again
+	FBlueprintCompileCache::Get().Initialize();
+	
+	// Walk each row struct once; user defined struct edits drop the cached schemas
+	FStructSchemaCache::Get().Initialize();
+	
 	// Initialize the command dispatcher and registry
 	FUnrealMCPMainDispatcher& Dispatcher = FUnrealMCPMainDispatcher::Get();
 	Dispatcher.Initialize();
@@ -55,6 +82,27 @@ void FUnrealMCPModule::ShutdownModule()
 	
 	UE_LOG_MCP_INFO("Command dispatcher shut down and commands unregistered");
 	
+	// Stop listening to the blueprint action database
+	FBlueprintActionSearchIndex::Get().Shutdown();
+	FBlueprintActionResultCache::Get().Shutdown();
+	FNodePinCatalog::Get().Shutdown();
+	
+	// Stop listening to the asset registry
+	FAssetNameIndex::Get().Shutdown();
+	FObjectResolutionCache::Get().Shutdown();
+	
+	// Stop listening to level actor events
+	FLevelActorIndex::Get().Shutdown();
+	
+	// Stop the deferred commit ticker; the bridge flushed on deinitialize
+	FAssetDirtySet::Get().Shutdown();
+	
+	// Stop listening to package dirty events
+	FBlueprintCompileCache::Get().Shutdown();
+	
+	// Stop listening to user defined struct changes
+	FStructSchemaCache::Get().Shutdown();
+	
 	// Shutdown the ObjectPoolManager
 	FObjectPoolManager& PoolManager = FObjectPoolManager::Get();
 	PoolManager.Shutdown();
@@ -23,6 +23,9 @@
 #include "Engine/Selection.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Services/AssetNameIndex.h"
+#include "Services/LevelActorIndex.h"
+#include "Services/AssetDirtySet.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "BlueprintNodeSpawner.h"
 #include "BlueprintActionDatabase.h"
@@ -179,109 +182,43 @@ UBlueprint* FUnrealMCPCommonUtils::FindBlueprintByName(const FString& BlueprintN
         NormalizedName = NormalizedName.LeftChop(7);
     }
     
-    // Handle absolute vs relative paths
-    bool bIsAbsolutePath = NormalizedName.StartsWith(TEXT("/"));
-    if (bIsAbsolutePath)
+    // Step 2: Resolve explicit paths through the asset name index; nothing is loaded unless the asset exists
+    FAssetNameIndex& AssetIndex = FAssetNameIndex::Get();
+    FAssetNameIndexEntry Entry;
+    if (NormalizedName.Contains(TEXT("/")))
     {
-        // If it's an absolute path starting with /Game/, use it directly
-        if (NormalizedName.StartsWith(TEXT("/Game/")))
+        // Paths not rooted at /Game/ are taken as relative to /Game
+        FString AssetPath = NormalizedName;
+        if (!AssetPath.StartsWith(TEXT("/Game/")))
         {
-            UE_LOG(LogTemp, Display, TEXT("Using absolute path: %s"), *NormalizedName);
-            UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *NormalizedName);
-            if (Blueprint)
-            {
-                return Blueprint;
-            }
-        }
-        // If it starts with / but not /Game/, prepend /Game/
-        else
-        {
-            NormalizedName = FString(TEXT("/Game")) + NormalizedName;
-            UE_LOG(LogTemp, Display, TEXT("Converted to game path: %s"), *NormalizedName);
-            UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *NormalizedName);
-            if (Blueprint)
-            {
-                return Blueprint;
-            }
+            AssetPath = AssetPath.StartsWith(TEXT("/")) ? FString(TEXT("/Game")) + AssetPath : FString(TEXT("/Game/")) + AssetPath;
         }
-    }
-    else
-    {
-        // For relative paths, extract any subdirectories
-        FString SubPath;
-        FString BaseName;
-        if (NormalizedName.Contains(TEXT("/")))
-        {
-            NormalizedName.Split(TEXT("/"), &SubPath, &BaseName, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-            // Reconstruct with /Game/ prefix
-            NormalizedName = FString::Printf(TEXT("/Game/%s/%s"), *SubPath, *BaseName);
-            UE_LOG(LogTemp, Display, TEXT("Reconstructed path with subdirectory: %s"), *NormalizedName);
-            UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *NormalizedName);
-            if (Blueprint)
-            {
-                return Blueprint;
-            }
-        }
-        else
-        {
-            BaseName = NormalizedName;
-        }
-
-        // Try standard locations for relative paths
-        TArray<FString> DefaultPaths = {
-            FString::Printf(TEXT("/Game/Blueprints/%s"), *BaseName),
-            FString::Printf(TEXT("/Game/%s"), *BaseName)
-        };
-
-        // Try each default path
-        for (const FString& Path : DefaultPaths)
+        
+        if (AssetIndex.FindByPath(AssetPath, Entry))
         {
-            UE_LOG(LogTemp, Display, TEXT("Trying blueprint at path: %s"), *Path);
-            UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *Path);
-            if (Blueprint)
+            if (UBlueprint* Blueprint = Cast<UBlueprint>(Entry.ObjectPath.TryLoad()))
             {
+                UE_LOG(LogTemp, Verbose, TEXT("Found blueprint at path: %s"), *Entry.ObjectPathString);
                 return Blueprint;
             }
         }
     }
-
-    // If still not found, use asset registry for a thorough search
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    TArray<FAssetData> AllBlueprintAssetData;
     
-    // Create a filter for blueprints and widget blueprints
-    FARFilter Filter;
-    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-    Filter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
-    Filter.PackagePaths.Add(TEXT("/Game"));
-    Filter.bRecursivePaths = true;
-
-    UE_LOG(LogTemp, Display, TEXT("Performing Asset Registry search for: %s"), *NormalizedName);
-    AssetRegistryModule.Get().GetAssets(Filter, AllBlueprintAssetData);
-    UE_LOG(LogTemp, Display, TEXT("Found %d total blueprint assets"), AllBlueprintAssetData.Num());
-
-    // First try exact name match
-    FString SearchName = FPaths::GetBaseFilename(NormalizedName);
-    for (const FAssetData& Asset : AllBlueprintAssetData)
-    {
-        if (Asset.AssetName.ToString() == SearchName)
-        {
-            UE_LOG(LogTemp, Display, TEXT("Found exact match: %s"), *Asset.GetObjectPathString());
-            return Cast<UBlueprint>(Asset.GetAsset());
-        }
-    }
-
-    // If exact match fails, try case-insensitive match
-    for (const FAssetData& Asset : AllBlueprintAssetData)
+    // Step 3: Look the short name up among blueprint assets under /Game, preferring
+    // an exact-case match, then /Game/Blueprints, then /Game
+    static const FName PreferredFolders[] = { FName(TEXT("/Game/Blueprints")), FName(TEXT("/Game")) };
+    const TArray<FTopLevelAssetPath> BlueprintClassPaths = FAssetNameIndex::GetClassPathsDerivedFrom(UBlueprint::StaticClass());
+    const FString SearchName = FPaths::GetBaseFilename(NormalizedName);
+    if (AssetIndex.FindBestByName(SearchName, BlueprintClassPaths, TEXT("/Game"), PreferredFolders, Entry))
     {
-        if (Asset.AssetName.ToString().Equals(SearchName, ESearchCase::IgnoreCase))
+        if (UBlueprint* Blueprint = Cast<UBlueprint>(Entry.ObjectPath.TryLoad()))
         {
-            UE_LOG(LogTemp, Warning, TEXT("Found case-insensitive match: %s"), *Asset.GetObjectPathString());
-            return Cast<UBlueprint>(Asset.GetAsset());
+            UE_LOG(LogTemp, Verbose, TEXT("Found blueprint by name: %s"), *Entry.ObjectPathString);
+            return Blueprint;
         }
     }
 
-    UE_LOG(LogTemp, Error, TEXT("Blueprint '%s' not found after exhaustive search"), *BlueprintName);
+    UE_LOG(LogTemp, Error, TEXT("Blueprint '%s' not found in the asset registry"), *BlueprintName);
     return nullptr;
 }
 
@@ -336,7 +273,8 @@ UK2Node_Event* FUnrealMCPCommonUtils::CreateEventNode(UEdGraph* Graph, const FSt
     // No existing node found, create a new one
     UK2Node_Event* EventNode = nullptr;
     
-    // Find the function to create the event
+    // Find the function to create the event, compiling first if a deferred compile is pending
+    FAssetDirtySet::Get().EnsureCompiled(Blueprint);
     UClass* BlueprintClass = Blueprint->GeneratedClass;
     UFunction* EventFunction = BlueprintClass->FindFunctionByName(FName(*EventName));
     
@@ -388,6 +326,8 @@ UK2Node_VariableGet* FUnrealMCPCommonUtils::CreateVariableGetNode(UEdGraph* Grap
     
     UK2Node_VariableGet* VariableGetNode = NewObject<UK2Node_VariableGet>(Graph);
     
+    // A variable added by a mutation whose compile is deferred is not on the generated class yet
+    FAssetDirtySet::Get().EnsureCompiled(Blueprint);
     FName VarName(*VariableName);
     FProperty* Property = FindFProperty<FProperty>(Blueprint->GeneratedClass, VarName);
     
@@ -415,6 +355,8 @@ UK2Node_VariableSet* FUnrealMCPCommonUtils::CreateVariableSetNode(UEdGraph* Grap
     
     UK2Node_VariableSet* VariableSetNode = NewObject<UK2Node_VariableSet>(Graph);
     
+    // A variable added by a mutation whose compile is deferred is not on the generated class yet
+    FAssetDirtySet::Get().EnsureCompiled(Blueprint);
     FName VarName(*VariableName);
     FProperty* Property = FindFProperty<FProperty>(Blueprint->GeneratedClass, VarName);
     
@@ -1245,21 +1187,12 @@ bool FUnrealMCPCommonUtils::ParseRotator(const TArray<TSharedPtr<FJsonValue>>& J
     return false;
 }
 
-// FindActorByName implementation might already exist, ensure it's suitable or adapt
 AActor* FUnrealMCPCommonUtils::FindActorByName(const FString& ActorName)
 {
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World) return nullptr;
 
-    for (TActorIterator<AActor> It(World); It; ++It)
-    {
-        AActor* Actor = *It;
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            return Actor;
-        }
-    }
-    return nullptr;
+    return FLevelActorIndex::Get().FindByNameOrLabel(World, ActorName);
 }
 
 bool FUnrealMCPCommonUtils::CallFunctionByName(UObject* Target, const FString& FunctionName, const TArray<FString>& StringParams, FString& OutError)
@@ -1298,23 +1231,9 @@ TArray<FString> FUnrealMCPCommonUtils::FindAssetsByType(const FString& AssetType
 {
     TArray<FString> FoundAssets;
     
-    // Get the Asset Registry
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-    
-    // Create filter for asset type
-    FARFilter Filter;
-    Filter.PackagePaths.Add(FName(*SearchPath));
-    Filter.bRecursivePaths = true;
-    Filter.ClassPaths.Add(FTopLevelAssetPath(*AssetType));
-    
-    TArray<FAssetData> AssetDataList;
-    AssetRegistry.GetAssets(Filter, AssetDataList);
-    
-    for (const FAssetData& AssetData : AssetDataList)
-    {
-        FoundAssets.Add(AssetData.GetSoftObjectPath().ToString());
-    }
+    // Every asset of the type under the search path; served from the asset name index
+    const FTopLevelAssetPath ClassPath(*AssetType);
+    FAssetNameIndex::Get().FindContaining(FString(), ESearchCase::IgnoreCase, MakeArrayView(&ClassPath, 1), SearchPath, FoundAssets);
     
     UE_LOG(LogTemp, Display, TEXT("Found %d assets of type '%s' in path '%s'"), FoundAssets.Num(), *AssetType, *SearchPath);
     return FoundAssets;
@@ -1323,28 +1242,7 @@ TArray<FString> FUnrealMCPCommonUtils::FindAssetsByType(const FString& AssetType
 TArray<FString> FUnrealMCPCommonUtils::FindAssetsByName(const FString& AssetName, const FString& SearchPath)
 {
     TArray<FString> FoundAssets;
-    
-    // Get the Asset Registry
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-    
-    // Create filter for search path
-    FARFilter Filter;
-    Filter.PackagePaths.Add(FName(*SearchPath));
-    Filter.bRecursivePaths = true;
-    
-    TArray<FAssetData> AssetDataList;
-    AssetRegistry.GetAssets(Filter, AssetDataList);
-    
-    for (const FAssetData& AssetData : AssetDataList)
-    {
-        FString AssetBaseName = FPaths::GetBaseFilename(AssetData.AssetName.ToString());
-        if (AssetBaseName.Contains(AssetName, ESearchCase::IgnoreCase) || 
-            AssetData.AssetName.ToString().Contains(AssetName, ESearchCase::IgnoreCase))
-        {
-            FoundAssets.Add(AssetData.GetSoftObjectPath().ToString());
-        }
-    }
+    FAssetNameIndex::Get().FindContaining(AssetName, ESearchCase::IgnoreCase, TConstArrayView<FTopLevelAssetPath>(), SearchPath, FoundAssets);
     
     UE_LOG(LogTemp, Display, TEXT("Found %d assets matching name '%s' in path '%s'"), FoundAssets.Num(), *AssetName, *SearchPath);
     return FoundAssets;
@@ -1353,28 +1251,8 @@ TArray<FString> FUnrealMCPCommonUtils::FindAssetsByName(const FString& AssetName
 TArray<FString> FUnrealMCPCommonUtils::FindWidgetBlueprints(const FString& WidgetName, const FString& SearchPath)
 {
     TArray<FString> FoundWidgets;
-    
-    // Get the Asset Registry
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-    
-    // Create filter for Widget Blueprints
-    FARFilter Filter;
-    Filter.PackagePaths.Add(FName(*SearchPath));
-    Filter.bRecursivePaths = true;
-    Filter.ClassPaths.Add(FTopLevelAssetPath(TEXT("/Script/UMGEditor"), TEXT("WidgetBlueprint")));
-    
-    TArray<FAssetData> AssetDataList;
-    AssetRegistry.GetAssets(Filter, AssetDataList);
-    
-    for (const FAssetData& AssetData : AssetDataList)
-    {
-        if (WidgetName.IsEmpty() || 
-            AssetData.AssetName.ToString().Contains(WidgetName, ESearchCase::IgnoreCase))
-        {
-            FoundWidgets.Add(AssetData.GetSoftObjectPath().ToString());
-        }
-    }
+    const FTopLevelAssetPath ClassPath(TEXT("/Script/UMGEditor"), TEXT("WidgetBlueprint"));
+    FAssetNameIndex::Get().FindContaining(WidgetName, ESearchCase::IgnoreCase, MakeArrayView(&ClassPath, 1), SearchPath, FoundWidgets);
     
     UE_LOG(LogTemp, Display, TEXT("Found %d widget blueprints matching '%s' in path '%s'"), FoundWidgets.Num(), *WidgetName, *SearchPath);
     return FoundWidgets;
@@ -1383,28 +1261,8 @@ TArray<FString> FUnrealMCPCommonUtils::FindWidgetBlueprints(const FString& Widge
 TArray<FString> FUnrealMCPCommonUtils::FindBlueprints(const FString& BlueprintName, const FString& SearchPath)
 {
     TArray<FString> FoundBlueprints;
-    
-    // Get the Asset Registry
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-    
-    // Create filter for Blueprints
-    FARFilter Filter;
-    Filter.PackagePaths.Add(FName(*SearchPath));
-    Filter.bRecursivePaths = true;
-    Filter.ClassPaths.Add(FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("Blueprint")));
-    
-    TArray<FAssetData> AssetDataList;
-    AssetRegistry.GetAssets(Filter, AssetDataList);
-    
-    for (const FAssetData& AssetData : AssetDataList)
-    {
-        if (BlueprintName.IsEmpty() || 
-            AssetData.AssetName.ToString().Contains(BlueprintName, ESearchCase::IgnoreCase))
-        {
-            FoundBlueprints.Add(AssetData.GetSoftObjectPath().ToString());
-        }
-    }
+    const FTopLevelAssetPath ClassPath(TEXT("/Script/Engine"), TEXT("Blueprint"));
+    FAssetNameIndex::Get().FindContaining(BlueprintName, ESearchCase::IgnoreCase, MakeArrayView(&ClassPath, 1), SearchPath, FoundBlueprints);
     
     UE_LOG(LogTemp, Display, TEXT("Found %d blueprints matching '%s' in path '%s'"), FoundBlueprints.Num(), *BlueprintName, *SearchPath);
     return FoundBlueprints;
@@ -1413,28 +1271,8 @@ TArray<FString> FUnrealMCPCommonUtils::FindBlueprints(const FString& BlueprintNa
 TArray<FString> FUnrealMCPCommonUtils::FindDataTables(const FString& TableName, const FString& SearchPath)
 {
     TArray<FString> FoundTables;
-    
-    // Get the Asset Registry
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-    
-    // Create filter for Data Tables
-    FARFilter Filter;
-    Filter.PackagePaths.Add(FName(*SearchPath));
-    Filter.bRecursivePaths = true;
-    Filter.ClassPaths.Add(FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("DataTable")));
-    
-    TArray<FAssetData> AssetDataList;
-    AssetRegistry.GetAssets(Filter, AssetDataList);
-    
-    for (const FAssetData& AssetData : AssetDataList)
-    {
-        if (TableName.IsEmpty() || 
-            AssetData.AssetName.ToString().Contains(TableName, ESearchCase::IgnoreCase))
-        {
-            FoundTables.Add(AssetData.GetSoftObjectPath().ToString());
-        }
-    }
+    const FTopLevelAssetPath ClassPath(TEXT("/Script/Engine"), TEXT("DataTable"));
+    FAssetNameIndex::Get().FindContaining(TableName, ESearchCase::IgnoreCase, MakeArrayView(&ClassPath, 1), SearchPath, FoundTables);
     
     UE_LOG(LogTemp, Display, TEXT("Found %d data tables matching '%s' in path '%s'"), FoundTables.Num(), *TableName, *SearchPath);
     return FoundTables;
@@ -1451,12 +1289,14 @@ UClass* FUnrealMCPCommonUtils::FindWidgetClass(const FString& WidgetPath)
         if (DirectClass && DirectClass->IsChildOf(UUserWidget::StaticClass()))
         {
             UE_LOG(LogTemp, Display, TEXT("FindWidgetClass: Found class via direct loading: %s"), *DirectClass->GetName());
+            FAssetDirtySet::Get().EnsureCompiled(UBlueprint::GetBlueprintFromClass(DirectClass));
             return DirectClass;
         }
     }
     
-    // Strategy 2: Asset-based loading
+    // Strategy 2: Asset-based loading; the widget blueprint lookup already covers every folder
     UBlueprint* WidgetBlueprint = FindWidgetBlueprint(WidgetPath);
+    FAssetDirtySet::Get().EnsureCompiled(WidgetBlueprint);
     if (WidgetBlueprint && WidgetBlueprint->GeneratedClass)
     {
         UClass* GeneratedClass = WidgetBlueprint->GeneratedClass;
@@ -1467,36 +1307,6 @@ UClass* FUnrealMCPCommonUtils::FindWidgetClass(const FString& WidgetPath)
         }
     }
     
-    // Strategy 3: Search using asset discovery
-    TArray<FString> CommonPaths = GetCommonAssetSearchPaths(WidgetPath);
-    for (const FString& SearchPath : CommonPaths)
-    {
-        UE_LOG(LogTemp, Display, TEXT("FindWidgetClass: Trying search path: %s"), *SearchPath);
-        
-        // Try loading as blueprint asset first
-        if (UEditorAssetLibrary::DoesAssetExist(SearchPath))
-        {
-            UObject* Asset = UEditorAssetLibrary::LoadAsset(SearchPath);
-            if (UBlueprint* BP = Cast<UBlueprint>(Asset))
-            {
-                if (BP->GeneratedClass && BP->GeneratedClass->IsChildOf(UUserWidget::StaticClass()))
-                {
-                    UE_LOG(LogTemp, Display, TEXT("FindWidgetClass: Found widget class via asset search: %s"), *BP->GeneratedClass->GetName());
-                    return BP->GeneratedClass;
-                }
-            }
-        }
-        
-        // Try loading as class with _C suffix
-        FString ClassPath = FString::Printf(TEXT("%s.%s_C"), *SearchPath, *FPaths::GetBaseFilename(SearchPath));
-        UClass* Class = LoadObject<UClass>(nullptr, *ClassPath);
-        if (Class && Class->IsChildOf(UUserWidget::StaticClass()))
-        {
-            UE_LOG(LogTemp, Display, TEXT("FindWidgetClass: Found widget class via class path: %s"), *Class->GetName());
-            return Class;
-        }
-    }
-    
     UE_LOG(LogTemp, Warning, TEXT("FindWidgetClass: Could not find widget class for: %s"), *WidgetPath);
     return nullptr;
 }
@@ -1505,36 +1315,40 @@ UBlueprint* FUnrealMCPCommonUtils::FindWidgetBlueprint(const FString& WidgetPath
 {
     UE_LOG(LogTemp, Display, TEXT("FindWidgetBlueprint: Searching for widget blueprint: %s"), *WidgetPath);
     
-    // Strategy 1: Direct asset loading
-    if (UEditorAssetLibrary::DoesAssetExist(WidgetPath))
+    FAssetNameIndex& AssetIndex = FAssetNameIndex::Get();
+    FAssetNameIndexEntry Entry;
+    
+    // Strategy 1: Explicit asset path
+    if (AssetIndex.FindByPath(WidgetPath, Entry))
     {
-        UObject* Asset = UEditorAssetLibrary::LoadAsset(WidgetPath);
-        if (UBlueprint* BP = Cast<UBlueprint>(Asset))
+        if (UBlueprint* BP = Cast<UBlueprint>(Entry.ObjectPath.TryLoad()))
         {
             UE_LOG(LogTemp, Display, TEXT("FindWidgetBlueprint: Found blueprint via direct loading: %s"), *BP->GetName());
             return BP;
         }
     }
     
-    // Strategy 2: Search using common paths
-    TArray<FString> CommonPaths = GetCommonAssetSearchPaths(WidgetPath);
-    for (const FString& SearchPath : CommonPaths)
+    // Strategy 2: Exact short name, preferring the folders widgets usually live in
+    static const FName PreferredFolders[] = {
+        FName(TEXT("/Game")),
+        FName(TEXT("/Game/Blueprints")),
+        FName(TEXT("/Game/UI")),
+        FName(TEXT("/Game/Widgets")),
+        FName(TEXT("/Game/Data"))
+    };
+    const FTopLevelAssetPath ClassPath(TEXT("/Script/UMGEditor"), TEXT("WidgetBlueprint"));
+    const FString WidgetName = FPaths::GetBaseFilename(WidgetPath);
+    if (AssetIndex.FindBestByName(WidgetName, MakeArrayView(&ClassPath, 1), FString(), PreferredFolders, Entry))
     {
-        UE_LOG(LogTemp, Display, TEXT("FindWidgetBlueprint: Trying search path: %s"), *SearchPath);
-        
-        if (UEditorAssetLibrary::DoesAssetExist(SearchPath))
+        if (UBlueprint* BP = Cast<UBlueprint>(Entry.ObjectPath.TryLoad()))
         {
-            UObject* Asset = UEditorAssetLibrary::LoadAsset(SearchPath);
-            if (UBlueprint* BP = Cast<UBlueprint>(Asset))
-            {
-                UE_LOG(LogTemp, Display, TEXT("FindWidgetBlueprint: Found blueprint via asset search: %s"), *BP->GetName());
-                return BP;
-            }
+            UE_LOG(LogTemp, Display, TEXT("FindWidgetBlueprint: Found blueprint via asset search: %s"), *BP->GetName());
+            return BP;
         }
     }
     
-    // Strategy 3: Use asset registry search
-    TArray<FString> FoundWidgets = FindWidgetBlueprints(FPaths::GetBaseFilename(WidgetPath));
+    // Strategy 3: Partial name match
+    TArray<FString> FoundWidgets = FindWidgetBlueprints(WidgetName);
     for (const FString& FoundPath : FoundWidgets)
     {
         UObject* Asset = UEditorAssetLibrary::LoadAsset(FoundPath);
@@ -1571,22 +1385,19 @@ UObject* FUnrealMCPCommonUtils::FindAssetByName(const FString& AssetName, const
 {
     UE_LOG(LogTemp, Display, TEXT("FindAssetByName: Searching for asset '%s' of type '%s'"), *AssetName, *AssetType);
     
-    TArray<FString> FoundAssets;
+    TArray<FTopLevelAssetPath> ClassPaths;
     if (!AssetType.IsEmpty())
     {
-        FoundAssets = FindAssetsByType(AssetType);
-    }
-    else
-    {
-        FoundAssets = FindAssetsByName(AssetName);
+        ClassPaths.Add(FTopLevelAssetPath(*AssetType));
     }
     
-    for (const FString& AssetPath : FoundAssets)
+    // An exact name match wins over partial matches
+    TArray<FAssetNameIndexEntry> ExactMatches;
+    if (FAssetNameIndex::Get().FindByName(AssetName, ClassPaths, TEXT("/Game"), ExactMatches))
     {
-        if (FPaths::GetBaseFilename(AssetPath).Contains(AssetName, ESearchCase::IgnoreCase))
+        for (const FAssetNameIndexEntry& Entry : ExactMatches)
         {
-            UObject* Asset = FindAssetByPath(AssetPath);
-            if (Asset)
+            if (UObject* Asset = Entry.ObjectPath.TryLoad())
             {
                 UE_LOG(LogTemp, Display, TEXT("FindAssetByName: Found matching asset: %s"), *Asset->GetName());
                 return Asset;
@@ -1594,6 +1405,19 @@ UObject* FUnrealMCPCommonUtils::FindAssetByName(const FString& AssetName, const
         }
     }
     
+    TArray<FString> FoundAssets;
+    FAssetNameIndex::Get().FindContaining(AssetName, ESearchCase::IgnoreCase, ClassPaths, TEXT("/Game"), FoundAssets);
+    
+    for (const FString& AssetPath : FoundAssets)
+    {
+        UObject* Asset = FindAssetByPath(AssetPath);
+        if (Asset)
+        {
+            UE_LOG(LogTemp, Display, TEXT("FindAssetByName: Found matching asset: %s"), *Asset->GetName());
+            return Asset;
+        }
+    }
+    
     UE_LOG(LogTemp, Warning, TEXT("FindAssetByName: Could not find asset '%s'"), *AssetName);
     return nullptr;
 }
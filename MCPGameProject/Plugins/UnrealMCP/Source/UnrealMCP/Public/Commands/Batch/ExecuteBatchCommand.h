@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "MCPBatchOperationHandler.h"
+
+/**
+ * Command for running many commands in one request
+ * Operations are scheduled in dependency waves by UMCPBatchOperationHandler; the
+ * whole batch is answered with a single response holding every operation's result.
+ *
+ * The command runs on the worker lane: waves are scheduled there, and each wave's
+ * game-thread operations reach the game thread as one work item through the
+ * game-thread runner, under the dispatcher's frame budget.
+ */
+class UNREALMCP_API FExecuteBatchCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InGameThreadExecutor - Runs operations that need the game thread
+     * @param InAnyThreadExecutor - Runs operations whose command is thread-safe, on pool threads
+     * @param InGameThreadRunner - Hands work to the game thread
+     */
+    FExecuteBatchCommand(FMCPBatchCommandExecutor InGameThreadExecutor, FMCPBatchCommandExecutor InAnyThreadExecutor, FMCPBatchGameThreadRunner InGameThreadRunner);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("execute_batch"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool SupportsJsonExecution() const override { return true; }
+    virtual TSharedPtr<FJsonObject> ExecuteJson(const TSharedPtr<FJsonObject>& Parameters) override;
+    virtual bool ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const override;
+    virtual EMCPCommandThreadAffinity GetThreadAffinity() const override { return EMCPCommandThreadAffinity::AnyThread; }
+
+private:
+    /**
+     * Create error response object
+     * @param ErrorMessage - Error message
+     * @return JSON response object
+     */
+    TSharedPtr<FJsonObject> CreateErrorResponse(const FString& ErrorMessage) const;
+
+    /**
+     * Run work on the game thread and wait for it
+     * @return False if the work was dropped without running
+     */
+    bool RunOnGameThread(TFunction<void()> Work) const;
+
+    FMCPBatchCommandExecutor GameThreadExecutor;
+    FMCPBatchCommandExecutor AnyThreadExecutor;
+    FMCPBatchGameThreadRunner GameThreadRunner;
+};
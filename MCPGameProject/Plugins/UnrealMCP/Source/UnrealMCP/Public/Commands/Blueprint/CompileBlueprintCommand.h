@@ -7,6 +7,7 @@
 /**
  * Command for compiling Blueprint assets
  * Provides enhanced error reporting for compilation issues
+ * Returns the last result without compiling when the Blueprint is unchanged, unless force is set
  */
 class UNREALMCP_API FCompileBlueprintCommand : public IUnrealMCPCommand
 {
@@ -30,10 +31,11 @@ private:
      * Parse JSON parameters for blueprint compilation
      * @param JsonString - JSON string containing parameters
      * @param OutBlueprintName - Name of the blueprint to compile
+     * @param bOutForce - Compile even if the blueprint is unchanged since its last successful compile
      * @param OutError - Error message if parsing fails
      * @return true if parsing succeeded
      */
-    bool ParseParameters(const FString& JsonString, FString& OutBlueprintName, FString& OutError) const;
+    bool ParseParameters(const FString& JsonString, FString& OutBlueprintName, bool& bOutForce, FString& OutError) const;
     
     /**
      * Create success response JSON with compilation details
@@ -41,9 +43,11 @@ private:
      * @param CompilationTime - Time taken for compilation
      * @param Status - Compilation status message
      * @param Warnings - Array of warning messages (optional)
+     * @param bSkipped - True if the result came from the compile cache instead of a compile
+     * @param CachedCompileMs - Duration of the cached compile, reported when skipped
      * @return JSON response string
      */
-    FString CreateSuccessResponse(const FString& BlueprintName, float CompilationTime, const FString& Status = TEXT("compiled successfully"), const TArray<FString>& Warnings = TArray<FString>()) const;
+    FString CreateSuccessResponse(const FString& BlueprintName, float CompilationTime, const FString& Status = TEXT("compiled successfully"), const TArray<FString>& Warnings = TArray<FString>(), bool bSkipped = false, double CachedCompileMs = 0.0) const;
     
     /**
      * Create error response JSON with detailed compilation errors
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IBlueprintService.h"
+
+/**
+ * Command for compiling many Blueprints in one compilation manager batch
+ * Blueprints are given by name or path ("blueprint_names") and/or by a folder glob
+ * ("folder", e.g. "/Game/Generated" or "/Game/UI/*WBP_*"). Pipelined requests
+ * receive one progress frame per Blueprint as soon as its wave has compiled.
+ * Blueprints unchanged since their last successful compile are reported as skipped
+ * without being queued, unless "force" is set.
+ */
+class UNREALMCP_API FCompileBlueprintsCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InBlueprintService - Reference to the blueprint service for operations
+     */
+    explicit FCompileBlueprintsCommand(IBlueprintService& InBlueprintService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool SupportsJsonExecution() const override { return true; }
+    virtual TSharedPtr<FJsonObject> ExecuteJson(const TSharedPtr<FJsonObject>& Parameters) override;
+    virtual bool ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const override;
+
+private:
+    /** Reference to the blueprint service */
+    IBlueprintService& BlueprintService;
+    
+    /**
+     * Resolve the requested names and folder glob to Blueprints, without duplicates
+     * @param Parameters - Command parameters
+     * @param OutBlueprints - Blueprints to compile, names first, then folder matches in path order
+     * @param OutMissing - Requested names that did not resolve to a Blueprint
+     * @param OutError - Error message if the parameters are malformed
+     * @return true if the parameters were valid
+     */
+    bool ResolveBlueprints(const TSharedPtr<FJsonObject>& Parameters, TArray<UBlueprint*>& OutBlueprints, TArray<FString>& OutMissing, FString& OutError) const;
+    
+    /**
+     * Find the Blueprint assets whose object path matches a folder glob
+     * A glob without wildcards matches everything under that folder.
+     */
+    static void FindBlueprintsInFolder(const FString& FolderGlob, TArray<UBlueprint*>& OutBlueprints);
+    
+    /** @return JSON object describing one Blueprint's compile result */
+    static TSharedRef<FJsonObject> CompileResultToJson(const FBlueprintCompileResult& Result);
+};
@@ -21,6 +21,7 @@ public:
     virtual FString Execute(const FString& Parameters) override;
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual EMCPCommandThreadAffinity GetThreadAffinity() const override { return EMCPCommandThreadAffinity::AnyThread; }
 
 private:
     /** The blueprint action service instance */
@@ -33,6 +33,7 @@ private:
     static void RegisterAddBlueprintVariableCommand();
     static void RegisterSetComponentPropertyCommand();
     static void RegisterCompileBlueprintCommand();
+    static void RegisterCompileBlueprintsCommand();
     static void RegisterSetPhysicsPropertiesCommand();
     static void RegisterSetBlueprintPropertyCommand();
     static void RegisterListBlueprintComponentsCommand();
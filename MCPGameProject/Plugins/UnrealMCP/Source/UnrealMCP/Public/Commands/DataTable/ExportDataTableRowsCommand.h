@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IDataTableService.h"
+
+/**
+ * Command for exporting DataTable rows as JSON lines or CSV
+ * Returns one page of at most "limit" rows and a cursor for the next page,
+ * or writes every row from the cursor on to "file_path".
+ */
+class UNREALMCP_API FExportDataTableRowsCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InDataTableService - Reference to the DataTable service for operations
+     */
+    explicit FExportDataTableRowsCommand(IDataTableService& InDataTableService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool SupportsJsonExecution() const override { return true; }
+    virtual TSharedPtr<FJsonObject> ExecuteJson(const TSharedPtr<FJsonObject>& Parameters) override;
+    virtual bool ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const override;
+
+private:
+    /** Reference to the DataTable service */
+    IDataTableService& DataTableService;
+};
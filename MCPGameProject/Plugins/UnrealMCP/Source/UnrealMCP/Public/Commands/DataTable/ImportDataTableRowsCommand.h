@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IDataTableService.h"
+
+/**
+ * Command for importing many DataTable rows at once from JSON lines or CSV
+ * Rows are given inline ("data") or read line by line from a file ("file_path").
+ * Pipelined requests receive a progress frame every few thousand rows.
+ */
+class UNREALMCP_API FImportDataTableRowsCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InDataTableService - Reference to the DataTable service for operations
+     */
+    explicit FImportDataTableRowsCommand(IDataTableService& InDataTableService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool SupportsJsonExecution() const override { return true; }
+    virtual TSharedPtr<FJsonObject> ExecuteJson(const TSharedPtr<FJsonObject>& Parameters) override;
+    virtual bool ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const override;
+
+private:
+    /** Reference to the DataTable service */
+    IDataTableService& DataTableService;
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for compiling and saving every asset waiting in FAssetDirtySet
+ * Returns what was compiled and saved; "immediate_mode": true makes every later mutation
+ * compile and save right away, false defers them again.
+ */
+class UNREALMCP_API FFlushCommand : public IUnrealMCPCommand
+{
+public:
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("flush"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool SupportsJsonExecution() const override { return true; }
+    virtual TSharedPtr<FJsonObject> ExecuteJson(const TSharedPtr<FJsonObject>& Parameters) override;
+    virtual bool ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const override;
+};
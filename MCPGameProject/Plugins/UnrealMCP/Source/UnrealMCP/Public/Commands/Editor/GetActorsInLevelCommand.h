@@ -5,7 +5,8 @@
 #include "Services/IEditorService.h"
 
 /**
- * Command for getting all actors in the current level
+ * Command for listing the actors in the current level, one page at a time
+ * Supports class, tag, folder, bounding box and name filters and a fields projection
  * Implements the IUnrealMCPCommand interface for standardized command execution
  */
 class UNREALMCP_API FGetActorsInLevelCommand : public IUnrealMCPCommand
@@ -21,22 +22,29 @@ public:
     virtual FString Execute(const FString& Parameters) override;
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool SupportsJsonExecution() const override { return true; }
+    virtual TSharedPtr<FJsonObject> ExecuteJson(const TSharedPtr<FJsonObject>& Parameters) override;
+    virtual bool ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const override;
 
 private:
     /** Reference to the editor service */
     IEditorService& EditorService;
     
     /**
-     * Create success response JSON
-     * @param Actors - Array of actors
-     * @return JSON response string
+     * Parse the filters, page and fields of a request
+     * @param Parameters - Request parameters; may be null
+     * @param OutParams - Receives the query
+     * @param OutFields - Receives the fields to report, as a mask of EActorField values
+     * @param OutError - Error message if a parameter is invalid
+     * @return true if the parameters are valid
      */
-    FString CreateSuccessResponse(const TArray<AActor*>& Actors) const;
+    bool ParseParameters(const TSharedPtr<FJsonObject>& Parameters, FActorQueryParams& OutParams, uint32& OutFields, FString& OutError) const;
     
     /**
-     * Create error response JSON
-     * @param ErrorMessage - Error message
-     * @return JSON response string
+     * Create success response object
+     * @param Result - One page of actors and the cursor for the next one
+     * @param Fields - Fields to report for each actor
+     * @return JSON response object
      */
-    FString CreateErrorResponse(const FString& ErrorMessage) const;
+    TSharedPtr<FJsonObject> CreateSuccessResponse(const FActorQueryResult& Result, uint32 Fields) const;
 };
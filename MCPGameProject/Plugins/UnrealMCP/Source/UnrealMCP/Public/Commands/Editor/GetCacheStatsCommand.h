@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for reporting the plugin's lookup caches
+ * Returns the counters of the object resolution cache (per kind), the blueprint action
+ * result cache and the asset name index, plus the game-thread queue and worker lane load;
+ * "reset": true clears the hit counters afterwards.
+ */
+class UNREALMCP_API FGetCacheStatsCommand : public IUnrealMCPCommand
+{
+public:
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("get_cache_stats"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool SupportsJsonExecution() const override { return true; }
+    virtual TSharedPtr<FJsonObject> ExecuteJson(const TSharedPtr<FJsonObject>& Parameters) override;
+    virtual bool ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const override;
+    virtual EMCPCommandThreadAffinity GetThreadAffinity() const override { return EMCPCommandThreadAffinity::AnyThread; }
+};
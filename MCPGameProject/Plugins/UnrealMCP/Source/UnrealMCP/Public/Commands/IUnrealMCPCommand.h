@@ -3,9 +3,31 @@
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
 
+class FJsonObject;
+
+/**
+ * Which threads a command may run on
+ */
+enum class EMCPCommandThreadAffinity : uint8
+{
+    /** Touches UObjects, editor state or anything else that requires the game thread (default) */
+    GameThread,
+
+    /** Uses no engine state that requires the game thread; may run on any worker thread */
+    AnyThread,
+
+    /** Only queries the asset registry, never loads or resolves objects; may run on a worker thread */
+    AssetRegistrySafe
+};
+
 /**
  * Interface for all MCP commands that can be executed by the UnrealMCP system.
  * Provides a standardized way to execute commands, validate parameters, and get command metadata.
+ *
+ * Commands can also work on already-parsed JSON objects by overriding ExecuteJson,
+ * ValidateParamsJson and SupportsJsonExecution. The registry then skips the
+ * string round-trips entirely; commands that only implement the string API
+ * keep working through the default adapters.
  */
 class UNREALMCP_API IUnrealMCPCommand
 {
@@ -31,4 +53,34 @@ public:
      * @return True if parameters are valid, false otherwise
      */
     virtual bool ValidateParams(const FString& Parameters) const = 0;
+
+    /**
+     * Whether this command implements ExecuteJson natively
+     * @return True if the registry should call ExecuteJson instead of the string API
+     */
+    virtual bool SupportsJsonExecution() const { return false; }
+
+    /**
+     * Execute the command on a parsed parameter object
+     * The default implementation serializes the parameters, calls Execute and parses the result.
+     * @param Parameters Parsed command parameters, may be null for commands without parameters
+     * @return Result object, or null if the command produced no valid JSON
+     */
+    virtual TSharedPtr<FJsonObject> ExecuteJson(const TSharedPtr<FJsonObject>& Parameters);
+
+    /**
+     * Validate a parsed parameter object before execution
+     * The default implementation serializes the parameters and calls ValidateParams.
+     * @param Parameters Parsed command parameters, may be null for commands without parameters
+     * @return True if parameters are valid, false otherwise
+     */
+    virtual bool ValidateParamsJson(const TSharedPtr<FJsonObject>& Parameters) const;
+
+    /**
+     * Declare which threads this command may run on
+     * Only override for commands that are known to be thread-safe; the bridge runs
+     * anything other than GameThread concurrently on the worker pool.
+     * @return Thread affinity of the command
+     */
+    virtual EMCPCommandThreadAffinity GetThreadAffinity() const { return EMCPCommandThreadAffinity::GameThread; }
 };
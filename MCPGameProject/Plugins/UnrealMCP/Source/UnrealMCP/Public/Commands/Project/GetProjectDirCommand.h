@@ -17,6 +17,7 @@ public:
     virtual FString Execute(const FString& Parameters) override;
     virtual FString GetCommandName() const override { return TEXT("get_project_dir"); }
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual EMCPCommandThreadAffinity GetThreadAffinity() const override { return EMCPCommandThreadAffinity::AnyThread; }
 
 private:
     TSharedPtr<IProjectService> ProjectService;
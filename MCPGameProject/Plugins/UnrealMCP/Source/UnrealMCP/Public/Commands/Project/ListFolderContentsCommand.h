@@ -17,6 +17,7 @@ public:
     virtual FString GetCommandName() const override;
     virtual FString Execute(const FString& Parameters) override;
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual EMCPCommandThreadAffinity GetThreadAffinity() const override { return EMCPCommandThreadAffinity::AssetRegistrySafe; }
 
 private:
     TSharedPtr<IProjectService> ProjectService;
@@ -2,10 +2,18 @@
 
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
+#include <atomic>
 
 /**
  * Registry for all MCP commands
  * Provides centralized command registration, discovery, and execution
+ *
+ * Lookups are lock-free: commands live in an immutable FName-keyed snapshot
+ * that writers copy, modify and publish with an atomic pointer swap. Old
+ * snapshots are retained until the registry is destroyed, so a reader that
+ * loaded a snapshot can keep using it while a writer publishes a new one.
+ * Bulk registration at startup and shutdown is wrapped in BeginBatch/EndBatch,
+ * so each pass publishes one snapshot instead of one per command.
  */
 class UNREALMCP_API FUnrealMCPCommandRegistry
 {
@@ -23,6 +31,15 @@ public:
      */
     bool RegisterCommand(TSharedPtr<IUnrealMCPCommand> Command);
     
+    /**
+     * Collect registrations and unregistrations into one snapshot until the matching EndBatch
+     * Lookups keep seeing the previously published commands until then. Calls nest.
+     */
+    void BeginBatch();
+    
+    /** End one BeginBatch; the outermost one publishes everything changed since the batch began */
+    void EndBatch();
+    
     /**
      * Unregister a command from the registry
      * @param CommandName - Name of the command to unregister
@@ -30,6 +47,13 @@ public:
      */
     bool UnregisterCommand(const FString& CommandName);
     
+    /**
+     * Find a registered command without taking any lock
+     * @param CommandName - Name of the command to find
+     * @return The command, or null if it is not registered
+     */
+    TSharedPtr<IUnrealMCPCommand> FindCommand(const FString& CommandName) const;
+    
     /**
      * Execute a command by name
      * @param CommandName - Name of the command to execute
@@ -38,6 +62,24 @@ public:
      */
     FString ExecuteCommand(const FString& CommandName, const FString& Parameters);
     
+    /**
+     * Execute a command by name on a parsed parameter object
+     * Commands that support JSON execution run without any serialization;
+     * string-only commands are adapted with a single serialize/parse pair.
+     * @param CommandName - Name of the command to execute
+     * @param Parameters - Parsed parameters for the command
+     * @return Result object from the command, or a {"success": false} error object
+     */
+    TSharedPtr<FJsonObject> ExecuteCommandJson(const FString& CommandName, const TSharedPtr<FJsonObject>& Parameters);
+    
+    /**
+     * Execute an already resolved command on a parsed parameter object
+     * @param Command - Command returned by FindCommand
+     * @param Parameters - Parsed parameters for the command
+     * @return Result object from the command, or a {"success": false} error object
+     */
+    TSharedPtr<FJsonObject> ExecuteCommandJson(const TSharedPtr<IUnrealMCPCommand>& Command, const TSharedPtr<FJsonObject>& Parameters);
+    
     /**
      * Check if a command is registered
      * @param CommandName - Name of the command to check
@@ -45,6 +87,13 @@ public:
      */
     bool IsCommandRegistered(const FString& CommandName) const;
     
+    /**
+     * Get the declared thread affinity of a command
+     * @param CommandName - Name of the command
+     * @return The command's affinity, or GameThread if it is not registered
+     */
+    EMCPCommandThreadAffinity GetCommandThreadAffinity(const FString& CommandName) const;
+    
     /**
      * Get all registered command names
      * @return Array of registered command names
@@ -71,14 +120,53 @@ public:
 
 private:
     /** Private constructor for singleton pattern */
-    FUnrealMCPCommandRegistry() = default;
+    FUnrealMCPCommandRegistry();
+    
+    /** Immutable set of registered commands; never modified once published */
+    struct FCommandSnapshot
+    {
+        TMap<FName, TSharedPtr<IUnrealMCPCommand>> Commands;
+    };
     
-    /** Map of command names to command instances */
-    TMap<FString, TSharedPtr<IUnrealMCPCommand>> RegisteredCommands;
+    /** Snapshot used by readers */
+    std::atomic<const FCommandSnapshot*> CurrentSnapshot;
     
-    /** Critical section for thread safety */
+    /** Every published snapshot, kept alive for readers that may still hold an older one */
+    TArray<TUniquePtr<FCommandSnapshot>> Snapshots;
+    
+    /** Changes collected by an open batch, not yet published; guarded by RegistryLock */
+    TUniquePtr<FCommandSnapshot> PendingSnapshot;
+    
+    /** Number of open BeginBatch calls; guarded by RegistryLock */
+    int32 BatchDepth;
+    
+    /** Serializes writers; readers never take it */
     mutable FCriticalSection RegistryLock;
     
+    /** @return The current snapshot */
+    const FCommandSnapshot& GetSnapshot() const { return *CurrentSnapshot.load(std::memory_order_acquire); }
+    
+    /**
+     * Make a new snapshot visible to readers
+     * Must be called with RegistryLock held
+     */
+    void PublishSnapshot(TUniquePtr<FCommandSnapshot> NewSnapshot);
+    
+    /**
+     * Get the snapshot a writer modifies: the open batch's, or a fresh copy of the current one
+     * Must be called with RegistryLock held, and followed by CommitWrite
+     */
+    FCommandSnapshot& BeginWrite();
+    
+    /**
+     * Publish the snapshot returned by BeginWrite, unless a batch is collecting changes
+     * Must be called with RegistryLock held
+     */
+    void CommitWrite();
+    
+    /** @return The newest commands, including changes held by an open batch; RegistryLock must be held */
+    const FCommandSnapshot& GetLatestSnapshot() const { return PendingSnapshot.IsValid() ? *PendingSnapshot : GetSnapshot(); }
+    
     /**
      * Create error response JSON
      * @param ErrorMessage - Error message
@@ -86,6 +174,13 @@ private:
      */
     FString CreateErrorResponse(const FString& ErrorMessage) const;
     
+    /**
+     * Create error response object
+     * @param ErrorMessage - Error message
+     * @return JSON error response object
+     */
+    TSharedPtr<FJsonObject> CreateErrorObject(const FString& ErrorMessage) const;
+    
     /**
      * Create success response JSON for registry operations
      * @param Message - Success message
@@ -2,8 +2,18 @@
 
 #include "CoreMinimal.h"
 #include "MCPOperationContext.h"
+#include "UObject/ObjectSaveContext.h"
+#include "Async/Future.h"
 #include "MCPBatchOperationHandler.generated.h"
 
+class FJsonObject;
+
+/** Runs one batch operation and returns its {"status", "result"/"error"} response envelope */
+typedef TFunction<TSharedRef<FJsonObject>(const FString&, const TSharedPtr<FJsonObject>&)> FMCPBatchCommandExecutor;
+
+/** Queues work for the game thread; the future is set to true once the work ran, or to false if it was dropped */
+typedef TFunction<TFuture<bool>(TFunction<void()>)> FMCPBatchGameThreadRunner;
+
 /**
  * Structure representing a single operation in a batch
  */
@@ -36,6 +46,9 @@ struct UNREALMCP_API FMCPBatchOperation
     UPROPERTY(BlueprintReadOnly)
     bool bContinueOnFailure;
 
+    /** Parameters already parsed by the caller; when set, Parameters is not parsed again */
+    TSharedPtr<FJsonObject> ParsedParameters;
+
     FMCPBatchOperation()
         : OperationId(TEXT(""))
         , OperationType(TEXT(""))
@@ -85,12 +98,24 @@ struct UNREALMCP_API FMCPBatchOperationResult
     UPROPERTY(BlueprintReadOnly)
     float ExecutionTime;
 
+    /** Dependency wave the operation ran in, starting at 0 */
+    UPROPERTY(BlueprintReadOnly)
+    int32 Wave;
+
+    /** Packages the operation marked dirty, in the order they were first dirtied */
+    UPROPERTY(BlueprintReadOnly)
+    TArray<FName> DirtiedPackages;
+
+    /** Result object returned by the command; null if the operation failed */
+    TSharedPtr<FJsonObject> ResultJson;
+
     FMCPBatchOperationResult()
         : Operation()
         , bSuccess(false)
         , ResultData(TEXT(""))
         , OperationContext(nullptr)
         , ExecutionTime(0.0f)
+        , Wave(0)
     {
     }
 };
@@ -98,6 +123,27 @@ struct UNREALMCP_API FMCPBatchOperationResult
 /**
  * Handler for executing multiple MCP operations in batch with error aggregation
  * Provides dependency management, error handling, and rollback capabilities
+ *
+ * Operations run in topological waves: a wave holds every pending operation whose
+ * dependencies have all finished. Within a wave, operations whose command is
+ * declared thread-safe run concurrently on the thread pool (up to
+ * MaxParallelOperations) while the remaining operations run on the game thread.
+ *
+ * ExecuteBatch may be called from any thread. Off the game thread, the calling
+ * thread schedules the waves and works through pool operations itself, and each
+ * wave's game-thread operations reach the game thread as one work item through the
+ * game-thread runner, so the editor keeps ticking between waves. On the game
+ * thread everything runs inline, and game-thread tasks are processed while waiting
+ * for the pool so an operation that hops to the game thread can still finish.
+ *
+ * The whole batch is recorded as a single editor transaction, so it appears as
+ * one undo step. The transaction stays open between waves; edits made in the
+ * editor while a batch runs off the game thread land in it as well.
+ * ExecuteBatchWithRollback undoes that transaction when any operation fails and
+ * reverts the packages the batch dirtied: assets created by the batch are deleted
+ * and packages that were clean before are marked clean again. FAssetDirtySet flushes
+ * are suspended while the batch runs, and a rollback drops the saves the batch queued,
+ * so rolled-back changes never reach disk.
  */
 UCLASS(BlueprintType)
 class UNREALMCP_API UMCPBatchOperationHandler : public UObject
@@ -123,7 +169,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MCP Batch Operations")
     bool ExecuteBatch();
 
-    /** Execute operations with rollback capability */
+    /** Execute operations, undoing the whole batch if any operation fails */
     UFUNCTION(BlueprintCallable, Category = "MCP Batch Operations")
     bool ExecuteBatchWithRollback();
 
@@ -163,6 +209,32 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MCP Batch Operations")
     void SetMaxParallelOperations(int32 MaxParallel);
 
+    /**
+     * Replace the functions that run individual operations
+     * By default operations go straight to FUnrealMCPCommandRegistry.
+     * @param InGameThreadExecutor - Runs operations that need the game thread; called on the game thread
+     * @param InAnyThreadExecutor - Runs operations whose command is thread-safe; called on pool threads
+     */
+    void SetCommandExecutors(FMCPBatchCommandExecutor InGameThreadExecutor, FMCPBatchCommandExecutor InAnyThreadExecutor);
+
+    /**
+     * Replace the function that hands work to the game thread when the batch runs elsewhere
+     * By default work is posted as a game-thread task.
+     */
+    void SetGameThreadRunner(FMCPBatchGameThreadRunner InGameThreadRunner);
+
+    /** Compile and save what the batch modified before ExecuteBatch returns, after any rollback */
+    void SetFlushAssetsOnCompletion(bool bFlush) { bFlushAssetsOnCompletion = bFlush; }
+
+    /** @return Number of dependency waves the last execution ran */
+    int32 GetWaveCount() const { return WaveCount; }
+
+    /** @return True if the last execution was rolled back */
+    bool WasRolledBack() const { return bRolledBack; }
+
+    /** Create the batch response as a JSON object, including each operation's result object */
+    TSharedPtr<FJsonObject> CreateBatchResponseJson() const;
+
 protected:
     /** Overall batch operation context */
     UPROPERTY(BlueprintReadOnly, Category = "Batch Context")
@@ -192,20 +264,129 @@ private:
     /** Sort operations by priority and dependencies */
     void SortOperationsByPriorityAndDependencies();
 
-    /** Check if an operation's dependencies are satisfied */
+    /** Check if an operation's dependencies all finished successfully */
     bool AreDependenciesSatisfied(const FMCPBatchOperation& Operation) const;
 
-    /** Execute a single operation */
-    FMCPBatchOperationResult ExecuteSingleOperation(const FMCPBatchOperation& Operation);
+    /** Check if an operation's dependencies have all finished, successfully or not */
+    bool AreDependenciesFinished(const FMCPBatchOperation& Operation) const;
+
+    /** An operation that finished, kept as plain data until its result is built on the game thread */
+    struct FFinishedOperation
+    {
+        FMCPBatchOperation Operation;
+
+        /** Response envelope; null if the operation was skipped */
+        TSharedPtr<FJsonObject> Envelope;
+
+        /** True if the operation was skipped because a dependency failed */
+        bool bDependencyFailed = false;
+
+        TArray<FName> DirtiedPackages;
+        double ExecutionSeconds = 0.0;
+        int32 Wave = 0;
+    };
+
+    /** Run the batch from the current thread, rolling it back on failure if asked */
+    bool ExecuteBatchInternal(bool bRollbackOnFailure);
+
+    /** Start work on the game thread: inline when already there, otherwise through the game-thread runner */
+    TFuture<bool> StartOnGameThread(TFunction<void()> Work) const;
+
+    /** Run work on the game thread and wait for it @return False if the work was dropped without running */
+    bool RunOnGameThread(TFunction<void()> Work) const;
+
+    /** Sort the operations, start watching packages and open the batch transaction */
+    void BeginBatchOnGameThread();
+
+    /** Close the batch transaction, build the results, roll back if asked and flush if configured */
+    void EndBatchOnGameThread(bool bOverallSuccess, bool bRollback);
 
-    /** Rollback executed operations in reverse order */
+    /**
+     * Run one dependency wave
+     * @param Wave - Operations whose dependencies have all succeeded, highest priority first
+     * @param WaveIndex - Index of the wave, recorded on each operation
+     * @return Finished operations in the same order as Wave
+     */
+    TArray<FFinishedOperation> ExecuteWave(const TArray<FMCPBatchOperation>& Wave, int32 WaveIndex);
+
+    /** Turn an operation's response envelope into a result with its own operation context */
+    FMCPBatchOperationResult MakeOperationResult(const FMCPBatchOperation& Operation, const TSharedPtr<FJsonObject>& Envelope, double ExecutionSeconds, int32 WaveIndex);
+
+    /** Undo the batch transaction and revert the packages dirtied by the batch */
     void RollbackOperations();
 
-    /** Validate operation dependencies */
-    bool ValidateDependencies() const;
+    /** Record a package dirtied while the batch runs, attributing it to the running game-thread operation */
+    void OnPackageMarkedDirty(UPackage* Package, bool bWasDirty);
+
+    /** Note packages saved while the batch runs; their on-disk state no longer matches the pre-batch state */
+    void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
 
-    /** Get operations that can be executed in parallel */
+    /**
+     * Validate operation dependencies
+     * @param OutError - Why validation failed
+     * @return True if ids are unique, every dependency is in the batch and there are no cycles
+     */
+    bool ValidateDependencies(FString& OutError) const;
+
+    /** Get the pending operations whose dependencies have all finished, i.e. the next wave */
     TArray<FMCPBatchOperation> GetExecutableOperations() const;
+
+    /** Outcome of every finished operation, keyed by operation id */
+    TMap<FString, bool> OperationOutcomes;
+
+    /** Runs operations that need the game thread */
+    FMCPBatchCommandExecutor GameThreadExecutor;
+
+    /** Runs operations whose command is thread-safe */
+    FMCPBatchCommandExecutor AnyThreadExecutor;
+
+    /** Hands work to the game thread when the batch runs on another thread; unset posts game-thread tasks */
+    FMCPBatchGameThreadRunner GameThreadRunner;
+
+    /** Operations finished by the running batch whose results have not been built yet */
+    TArray<FFinishedOperation> FinishedOperations;
+
+    /** Number of waves run by the last execution */
+    int32 WaveCount;
+
+    /** State of a package before the batch first dirtied it */
+    struct FTrackedPackage
+    {
+        bool bExistedOnDisk = true;
+        bool bWasDirty = false;
+        bool bSavedDuringBatch = false;
+    };
+
+    /** Every package dirtied by the batch */
+    TMap<FName, FTrackedPackage> TrackedPackages;
+
+    /** Packages the asset dirty set was already going to save when the batch started */
+    TSet<FName> PendingSavesBeforeBatch;
+
+    /** Receives packages dirtied by the game-thread operation currently running; null between operations */
+    TArray<FName>* ActiveDirtiedPackages;
+
+    /** Package delegates bound while the batch runs */
+    FDelegateHandle PackageDirtyHandle;
+    FDelegateHandle PackageSavedHandle;
+
+    /** Undo transaction on top of the buffer before the batch started */
+    FGuid PreviousUndoTransactionId;
+
+    /** Whether the batch transaction is open */
+    bool bBatchTransactionOpen;
+
+    /** Whether the batch transaction was recorded in the undo buffer and can be undone */
+    bool bHasBatchTransaction;
+
+    /** Whether to flush the asset dirty set once the batch ends */
+    bool bFlushAssetsOnCompletion;
+
+    /** Whether the last execution was rolled back */
+    bool bRolledBack;
+
+    /** Packages deleted or marked clean by the last rollback */
+    TArray<FName> RevertedPackages;
 };
 
 /**
@@ -220,12 +401,27 @@ public:
     /** Create multiple operations from JSON array */
     static TArray<FMCPBatchOperation> CreateOperationsFromJson(const FString& JsonString);
 
+    /**
+     * Create multiple operations from a parsed {"operations": [...]} object
+     * Each operation's "parameters" may be an object or a JSON string; operations
+     * without an "operationId" are given their index in the array as id.
+     */
+    static TArray<FMCPBatchOperation> CreateOperationsFromJsonObject(const TSharedPtr<FJsonObject>& JsonObject);
+
     /** Validate batch operation parameters */
     static bool ValidateBatchOperation(const FMCPBatchOperation& Operation, FString& OutError);
 
     /** Create dependency graph for operations */
     static TMap<FString, TArray<FString>> CreateDependencyGraph(const TArray<FMCPBatchOperation>& Operations);
 
+    /**
+     * Validate the dependency graph of a batch
+     * @param Operations - Operations in the batch
+     * @param OutError - Why validation failed
+     * @return True if ids are unique, every dependency is in the batch and there are no cycles
+     */
+    static bool ValidateDependencies(const TArray<FMCPBatchOperation>& Operations, FString& OutError);
+
     /** Check for circular dependencies */
     static bool HasCircularDependencies(const TArray<FMCPBatchOperation>& Operations);
 
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "MCPServerConfig.h"
+#include "MCPFrameProtocol.h"
+#include "MCPCommandHandle.h"
+#include <atomic>
+
+class FSocket;
+class FEvent;
+class FJsonObject;
+class FJsonValue;
+class UUnrealMCPBridge;
+
+/**
+ * Runnable serving a single accepted MCP client
+ *
+ * Each connection runs on its own thread so a slow or long-lived client
+ * never blocks other clients from being accepted or served.
+ * The connection owns its socket and destroys it when it is deleted.
+ *
+ * Incoming bytes are reassembled by an FMCPFrameDecoder, so messages may span
+ * any number of reads. Clients start in JSON framing (bare or newline-separated
+ * documents) and can switch to length-prefixed frames with a "handshake" message.
+ *
+ * Requests carrying an "id" are pipelined: the connection keeps reading while
+ * they execute and each response is sent, tagged with the same id, as soon as
+ * it is ready. Commands may stream {"status": "progress"} frames with the same
+ * id ahead of the response. Requests without an id are answered in order, one
+ * at a time, and receive no progress frames.
+ * The connection must be owned by a thread-safe TSharedPtr so late responses
+ * can detect that it has gone away.
+ *
+ * Every command has a deadline (the request's "timeout_ms" or the configured
+ * CommandTimeoutMs) after which the client gets a "timeout" error instead of
+ * waiting forever. Pipelined requests can also be cancelled by id with a
+ * "cancel" message.
+ *
+ * Per-read tracing is compiled out (see UE_LOG_MCP_NETWORK_VERBOSE); instead each
+ * connection logs a traffic summary every NetworkSummaryIntervalSec and on disconnect.
+ */
+class FMCPClientConnection : public FRunnable, public TSharedFromThis<FMCPClientConnection, ESPMode::ThreadSafe>
+{
+public:
+	FMCPClientConnection(UUnrealMCPBridge* InBridge, FSocket* InSocket, int32 InConnectionId, const FMCPServerConfig& InConfig);
+	virtual ~FMCPClientConnection();
+
+	// FRunnable interface
+	virtual bool Init() override;
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	virtual void Exit() override;
+
+	/** @return True once the receive loop has exited and the thread can be reaped */
+	bool IsFinished() const { return bFinished.load(); }
+
+	/** @return Server-assigned identifier of this connection, used in logs */
+	int32 GetConnectionId() const { return ConnectionId; }
+
+private:
+	/** Apply socket options (no-delay, buffer sizes, blocking mode) */
+	void ConfigureSocket();
+
+	/** Hand every complete buffered frame to ProcessFrame; returns false if the stream is corrupt */
+	bool DrainFrames();
+
+	/** Parse a received frame and send the command response back */
+	void ProcessFrame(FUtf8StringView Frame);
+
+	/** Negotiate the framing mode for the rest of the connection */
+	void HandleHandshake(const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonValue>& RequestId);
+
+	/** Cancel an in-flight pipelined request by id and acknowledge the cancel message */
+	void HandleCancel(const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonValue>& RequestId);
+
+	/** Queue a request tagged with an id and return without waiting for its response */
+	void DispatchPipelined(const TSharedPtr<FJsonValue>& RequestId, const FString& CommandType, const TSharedPtr<FJsonObject>& Params, double TimeoutSeconds);
+
+	/** Release a pipeline slot once a tagged response has been sent */
+	void OnPipelinedRequestCompleted(const FString& RequestKey);
+
+	/** Progress frames and the response of one pipelined request, queued in the order they were produced */
+	struct FPipelinedOutbox;
+
+	/** Send every frame queued in a pipelined request's outbox, oldest first */
+	void SendOutbox(FPipelinedOutbox& Outbox, const TSharedPtr<FJsonValue>& RequestId);
+
+	/** Time out every in-flight pipelined request whose deadline has passed */
+	void CheckInFlightDeadlines();
+
+	/** @return Key identifying a request id in InFlightHandles; string "7" and number 7 are different ids */
+	static FString MakeRequestKey(const TSharedPtr<FJsonValue>& RequestId);
+
+	/**
+	 * Serialize a response object as UTF-8 straight into SendBuffer, framed for the current
+	 * framing mode and tagged with the request id if there is one, and send it
+	 */
+	void SendJson(const TSharedRef<FJsonObject>& Response, const TSharedPtr<FJsonValue>& RequestId = nullptr);
+
+	/** Send the frame staged in SendBuffer; must be called with SendLock held */
+	void SendStagedFrame();
+
+	/** Send an error response in the bridge's {"status":"error"} format */
+	void SendError(const FString& ErrorMessage, const TSharedPtr<FJsonValue>& RequestId = nullptr);
+
+	/** Send the whole buffer in chunks of at most SocketBufferSize, retrying partial sends */
+	bool SendAll(const uint8* Data, int32 Length);
+
+	/** Log the traffic counters if there has been activity since the last summary (or always, when closing) */
+	void LogTrafficSummary(bool bClosing);
+
+	UUnrealMCPBridge* Bridge;
+	FSocket* Socket;
+	int32 ConnectionId;
+	FMCPServerConfig Config;
+
+	/** Receive buffer and framing state; responses use the same framing mode */
+	FMCPFrameDecoder Decoder;
+
+	/** Reused staging buffer for outgoing frames, guarded by SendLock; released after an unusually large response */
+	TArray<uint8> SendBuffer;
+
+	/** Serializes sends from the connection thread and pipelined completions */
+	FCriticalSection SendLock;
+
+	/** Number of pipelined requests dispatched but not yet answered */
+	std::atomic<int32> InFlightRequests;
+
+	/** Signalled whenever a pipelined request completes */
+	FEvent* InFlightDrained;
+
+	/** Handles of pipelined requests that have not been answered yet, keyed by MakeRequestKey */
+	TMap<FString, FMCPCommandHandleRef> InFlightHandles;
+
+	/** Guards InFlightHandles; completions remove entries from worker threads */
+	FCriticalSection InFlightLock;
+
+	/** Traffic counters reported by LogTrafficSummary */
+	std::atomic<int64> BytesReceived;
+	std::atomic<int64> FramesReceived;
+	std::atomic<int64> BytesSent;
+	std::atomic<int64> ResponsesSent;
+	std::atomic<int64> SendFailures;
+
+	/** Connection thread only: when the connection started and when the last summary was logged */
+	double ConnectionStartTime;
+	double LastSummaryTime;
+	int64 FramesAtLastSummary;
+
+	std::atomic<bool> bRunning;
+	std::atomic<bool> bFinished;
+};
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class FJsonObject;
+
+/** Callback receiving the response envelope of a command ({"status", "result"/"error"}) */
+typedef TFunction<void(const TSharedRef<FJsonObject>&)> FMCPCommandCompletion;
+
+/** Callback receiving an intermediate progress payload of a running command */
+typedef TFunction<void(const TSharedRef<FJsonObject>&)> FMCPCommandProgress;
+
+/**
+ * Tracks one asynchronous command from submission to response
+ *
+ * A handle guarantees the completion callback runs exactly once, whichever
+ * comes first: the command finishing, its deadline passing, an explicit
+ * cancel, or server shutdown. Cancellation is cooperative: a command that
+ * has not started yet is skipped, and long-running code can poll
+ * IsCurrentCancelled() to stop early. A command that ignores cancellation
+ * still runs to completion, but its late result is discarded.
+ *
+ * A handle may also carry a progress callback. Long-running commands report
+ * partial results through ReportCurrentProgress; reports made after the
+ * response has been delivered, or for a handle without a callback, are dropped.
+ */
+class UNREALMCP_API FMCPCommandHandle
+{
+public:
+    /**
+     * @param InCommandType - Name of the command, used in error messages
+     * @param InTimeoutSeconds - Time allowed from submission to response; zero or less means no deadline
+     * @param InOnComplete - Called once with the response envelope
+     * @param InOnProgress - Optional; called with each progress payload, on the thread that reports it
+     */
+    FMCPCommandHandle(const FString& InCommandType, double InTimeoutSeconds, FMCPCommandCompletion InOnComplete, FMCPCommandProgress InOnProgress = FMCPCommandProgress());
+
+    /** @return Name of the command this handle tracks */
+    const FString& GetCommandType() const { return CommandType; }
+
+    /**
+     * Deliver the response if no other response has been delivered yet
+     * @return True if this call delivered the response
+     */
+    bool Complete(const TSharedRef<FJsonObject>& Response);
+
+    /** @return True once a response has been delivered */
+    bool IsCompleted() const { return bCompleted.load(); }
+
+    /**
+     * Request cancellation and answer with a "cancelled" error
+     * @return True if the command was still pending
+     */
+    bool Cancel();
+
+    /** @return True if cancellation was requested, either explicitly or by the deadline */
+    bool IsCancellationRequested() const { return bCancellationRequested.load(); }
+
+    /**
+     * Enforce the deadline: if it has passed, request cancellation and answer with a "timeout" error
+     * @return True if the command timed out during this call
+     */
+    bool CheckDeadline();
+
+    /** @return Seconds remaining before the deadline, or a negative value if there is no deadline */
+    double GetRemainingSeconds() const;
+
+    /** @return True if the command running on this thread has been cancelled or timed out */
+    static bool IsCurrentCancelled();
+
+    /** @return The handle executing on the current thread, or null; lets fan-out work re-enter the same scope on other threads */
+    static const FMCPCommandHandle* GetCurrent();
+
+    /** @return True if someone is listening to this command's progress */
+    bool WantsProgress() const { return static_cast<bool>(OnProgress) && !IsCompleted(); }
+
+    /**
+     * Pass a progress payload to the progress callback
+     * The payload may be serialized on another thread, so it must not be modified afterwards.
+     * @return True if the payload was delivered
+     */
+    bool ReportProgress(const TSharedRef<FJsonObject>& Progress) const;
+
+    /** @return True if the command running on this thread can report progress; lets callers skip building payloads */
+    static bool WantsCurrentProgress();
+
+    /**
+     * Report progress for the command running on this thread
+     * @return True if the payload was delivered
+     */
+    static bool ReportCurrentProgress(const TSharedRef<FJsonObject>& Progress);
+
+    /** Marks a handle as the one executing on the current thread for the lifetime of the scope */
+    class UNREALMCP_API FExecutionScope
+    {
+    public:
+        explicit FExecutionScope(const FMCPCommandHandle& Handle);
+        ~FExecutionScope();
+
+    private:
+        const FMCPCommandHandle* PreviousHandle;
+    };
+
+private:
+    /** Build a {"status": "error"} envelope with a machine-readable error_type */
+    TSharedRef<FJsonObject> MakeErrorResponse(const FString& ErrorType, const FString& Message) const;
+
+    FString CommandType;
+    double TimeoutSeconds;
+    double Deadline;
+    FMCPCommandCompletion OnComplete;
+    FMCPCommandProgress OnProgress;
+
+    std::atomic<bool> bCompleted;
+    std::atomic<bool> bCancellationRequested;
+};
+
+typedef TSharedRef<FMCPCommandHandle, ESPMode::ThreadSafe> FMCPCommandHandleRef;
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/**
+ * How messages are delimited on an MCP connection
+ */
+enum class EMCPFramingMode : uint8
+{
+    /** Back-to-back JSON documents, optionally separated by whitespace/newlines (legacy default) */
+    Json,
+
+    /** One JSON document per line */
+    NewlineDelimited,
+
+    /** Each message is preceded by a 4-byte big-endian payload length */
+    LengthPrefixed
+};
+
+/**
+ * Outcome of asking the decoder for the next frame
+ */
+enum class EMCPFrameResult : uint8
+{
+    /** A complete frame was returned */
+    Frame,
+
+    /** The buffered bytes do not yet form a complete frame */
+    NeedMoreData,
+
+    /** The stream violates the framing rules; see GetLastError() */
+    Error
+};
+
+/**
+ * Growable per-connection receive buffer that reassembles frames in place
+ *
+ * Socket reads go straight into the buffer through PrepareWrite/CommitWrite
+ * and complete frames are handed out as views into that same storage, so a
+ * payload is never copied between arrival and JSON parsing. Frame scanning
+ * is incremental: bytes already inspected are not rescanned when more data
+ * arrives.
+ */
+class UNREALMCP_API FMCPFrameDecoder
+{
+public:
+    /** Size of the length prefix used by EMCPFramingMode::LengthPrefixed */
+    static constexpr int32 LengthPrefixSize = 4;
+
+    explicit FMCPFrameDecoder(int32 InMaxFrameBytes);
+
+    /** Switch framing mode; only valid on a frame boundary */
+    void SetMode(EMCPFramingMode InMode);
+    EMCPFramingMode GetMode() const { return Mode; }
+
+    /**
+     * Reserve space for an incoming read
+     * @param MinBytes Minimum writable bytes required
+     * @return Pointer to at least MinBytes of writable space; invalidates views returned by NextFrame
+     */
+    uint8* PrepareWrite(int32 MinBytes);
+
+    /**
+     * Mark bytes written into the space returned by PrepareWrite as received
+     * @param BytesWritten Number of bytes actually written
+     */
+    void CommitWrite(int32 BytesWritten);
+
+    /**
+     * Extract the next complete frame
+     * @param OutFrame Receives a view of the frame payload, valid until the next PrepareWrite
+     * @return Frame, NeedMoreData or Error
+     */
+    EMCPFrameResult NextFrame(FUtf8StringView& OutFrame);
+
+    /** Drop all buffered data and scan state (used after a framing error) */
+    void Reset();
+
+    /** @return Description of the last framing error */
+    const FString& GetLastError() const { return LastError; }
+
+    /** @return Number of received bytes not yet returned as frames */
+    int32 GetBufferedBytes() const { return WriteOffset - ReadOffset; }
+
+    /** @return Current allocated capacity of the receive buffer */
+    int32 GetCapacity() const { return Buffer.Num(); }
+
+    /**
+     * Write a length prefix for a payload
+     * @param PayloadBytes Payload size in bytes
+     * @param OutPrefix Receives LengthPrefixSize bytes
+     */
+    static void EncodeLengthPrefix(uint32 PayloadBytes, uint8* OutPrefix);
+
+    /** Convert a framing mode to its protocol name ("json", "newline", "length_prefixed") */
+    static const TCHAR* ModeToString(EMCPFramingMode InMode);
+
+    /**
+     * Parse a protocol framing name
+     * @return True if the name is a known framing mode
+     */
+    static bool ModeFromString(const FString& Name, EMCPFramingMode& OutMode);
+
+private:
+    EMCPFrameResult NextJsonFrame(FUtf8StringView& OutFrame);
+    EMCPFrameResult NextLineFrame(FUtf8StringView& OutFrame);
+    EMCPFrameResult NextLengthPrefixedFrame(FUtf8StringView& OutFrame);
+
+    /** Consume a frame spanning [ReadOffset, FrameEnd) and advance past ConsumedEnd */
+    FUtf8StringView TakeFrame(int32 FrameStart, int32 FrameEnd, int32 ConsumedEnd);
+
+    EMCPFrameResult Fail(const FString& Error);
+
+    TArray<uint8> Buffer;
+    int32 ReadOffset;
+    int32 WriteOffset;
+    int32 MaxFrameBytes;
+    EMCPFramingMode Mode;
+    FString LastError;
+
+    /** Incremental JSON / newline scan state, relative to ReadOffset */
+    int32 ScanOffset;
+    int32 JsonStart;
+    int32 JsonDepth;
+    bool bInString;
+    bool bEscape;
+};
+
+/**
+ * Builds outgoing frames as UTF-8 in a reusable byte buffer
+ *
+ * JSON is written by a UTF8CHAR writer straight into the frame buffer, so a
+ * response exists once, as the bytes that go on the wire, instead of as a TCHAR
+ * FString plus a converted copy plus the framed copy. The length prefix is
+ * patched in after the payload is written and always counts UTF-8 bytes.
+ */
+class UNREALMCP_API FMCPFrameEncoder
+{
+public:
+    /**
+     * Serialize a JSON object as one frame, replacing the contents of OutFrame
+     * OutFrame keeps its allocation, so a per-connection buffer is reused across responses.
+     * @param Payload Object to serialize (condensed, no whitespace)
+     * @param Mode Framing to wrap the payload in
+     * @param OutFrame Receives the framed bytes
+     * @return Size of the payload in bytes, excluding framing
+     */
+    static int32 EncodeJson(const TSharedRef<FJsonObject>& Payload, EMCPFramingMode Mode, TArray<uint8>& OutFrame);
+
+    /**
+     * Frame an already serialized message, replacing the contents of OutFrame
+     * @param Payload Serialized message
+     * @param Mode Framing to wrap the payload in
+     * @param OutFrame Receives the framed bytes
+     * @return Size of the payload in UTF-8 bytes, excluding framing
+     */
+    static int32 EncodeString(FStringView Payload, EMCPFramingMode Mode, TArray<uint8>& OutFrame);
+
+private:
+    /** Reset the buffer and reserve room for the length prefix if the framing needs one */
+    static void BeginFrame(EMCPFramingMode Mode, TArray<uint8>& OutFrame);
+
+    /** Fill in the length prefix or append the delimiter; returns the payload size */
+    static int32 EndFrame(EMCPFramingMode Mode, TArray<uint8>& OutFrame);
+};
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Async/Future.h"
+#include "Misc/ScopeRWLock.h"
+#include "MCPCommandHandle.h"
+#include <atomic>
+
+class FJsonObject;
+
+/** Routes a command to its handler and builds the response envelope; always called on the game thread */
+typedef TFunction<TSharedRef<FJsonObject>(const FString&, const TSharedPtr<FJsonObject>&)> FMCPCommandExecutor;
+
+/**
+ * Snapshot of the game-thread dispatcher counters
+ */
+struct UNREALMCP_API FMCPGameThreadDispatcherStats
+{
+    /** Commands queued but not yet executed */
+    int32 QueueDepth = 0;
+
+    /** Commands executed by the most recent tick that had work */
+    int32 LastDrainedPerTick = 0;
+
+    /** Largest number of commands executed in a single tick */
+    int32 PeakDrainedPerTick = 0;
+
+    /** Commands executed since the dispatcher started */
+    int64 TotalDrained = 0;
+
+    /** Ticks that ran past the frame budget */
+    int64 BudgetOverruns = 0;
+
+    /** Queued commands dropped because they were cancelled or timed out before they started */
+    int64 SkippedCancelled = 0;
+
+    /** Convert to a JSON object for diagnostics responses */
+    TSharedRef<FJsonObject> ToJson() const;
+};
+
+/**
+ * Executes commands from network threads on the game thread in batches
+ *
+ * Producers push commands into a lock-free MPSC queue from any thread. A core
+ * ticker drains the queue once per frame until the frame budget is spent, so a
+ * burst of small commands costs one game-thread hop instead of one task each,
+ * and a long backlog is spread over several frames to keep the editor responsive.
+ * At least one command runs per tick so a single slow command can't starve the queue.
+ */
+class UNREALMCP_API FMCPGameThreadDispatcher
+{
+public:
+    /**
+     * @param InExecutor - Function that executes a command on the game thread
+     * @param InFrameBudgetMs - Time the game thread may spend draining per frame
+     */
+    FMCPGameThreadDispatcher(FMCPCommandExecutor InExecutor, float InFrameBudgetMs);
+    ~FMCPGameThreadDispatcher();
+
+    /** Register the ticker; must be called on the game thread */
+    void Start();
+
+    /**
+     * Stop accepting commands, unregister the ticker and fail everything still queued
+     * Must be called on the game thread
+     */
+    void Shutdown();
+
+    /**
+     * Queue a command for the game thread; safe to call from any thread
+     * Commands cancelled or timed out while queued are skipped.
+     * If the dispatcher is not running, the handle is completed immediately with an error.
+     */
+    void Enqueue(const FMCPCommandHandleRef& Handle, const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Queue a piece of work for the game thread; safe to call from any thread
+     * The work runs in order with queued commands and counts against the same frame budget.
+     * @return Future set to true once the work has run, or to false if the dispatcher shut down first
+     */
+    TFuture<bool> EnqueueWork(TFunction<void()> Work);
+
+    /** @return Current counter values; safe to call from any thread */
+    FMCPGameThreadDispatcherStats GetStats() const;
+
+private:
+    struct FQueuedCommand
+    {
+        TSharedPtr<FMCPCommandHandle, ESPMode::ThreadSafe> Handle;
+        TSharedPtr<FJsonObject> Params;
+
+        /** Set instead of Handle for work queued by EnqueueWork */
+        TFunction<void()> Work;
+        TSharedPtr<TPromise<bool>, ESPMode::ThreadSafe> WorkDone;
+    };
+
+    /** Ticker callback draining the queue within the frame budget */
+    bool Tick(float DeltaTime);
+
+    /** Build the envelope returned for commands that can no longer run */
+    static TSharedRef<FJsonObject> MakeShutdownResponse();
+
+    FMCPCommandExecutor Executor;
+    double FrameBudgetSeconds;
+
+    TQueue<FQueuedCommand, EQueueMode::Mpsc> PendingCommands;
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    /** Guards bAccepting so no producer can enqueue after Shutdown has drained the queue */
+    mutable FRWLock AcceptLock;
+    bool bAccepting;
+
+    std::atomic<int32> QueueDepth;
+    std::atomic<int32> LastDrainedPerTick;
+    std::atomic<int32> PeakDrainedPerTick;
+    std::atomic<int64> TotalDrained;
+    std::atomic<int64> BudgetOverruns;
+    std::atomic<int64> SkippedCancelled;
+};
@@ -371,6 +371,23 @@ private:
 #define UE_LOG_MCP_NETWORK_INFO(Format, ...) \
     UE_LOG(LogMCPNetwork, Log, TEXT("[NET] ") Format, ##__VA_ARGS__)
 
+/**
+ * Per-read and per-frame network tracing. It runs on the receive hot loop, so it is
+ * compiled out entirely unless the module is built with MCP_NETWORK_TRACE_LOGGING=1;
+ * use the wire trace (FMCPWireTrace) to inspect traffic in a normal build.
+ */
+#ifndef MCP_NETWORK_TRACE_LOGGING
+#define MCP_NETWORK_TRACE_LOGGING 0
+#endif
+
+#if MCP_NETWORK_TRACE_LOGGING
+#define UE_LOG_MCP_NETWORK_VERBOSE(Format, ...) \
+    UE_LOG(LogMCPNetwork, Verbose, TEXT("[NET] ") Format, ##__VA_ARGS__)
+#else
+#define UE_LOG_MCP_NETWORK_VERBOSE(Format, ...) \
+    do { } while (0)
+#endif
+
 // Operation logging macros
 #define UE_LOG_MCP_OPERATION_ERROR(Format, ...) \
     UE_LOG(LogMCPOperations, Error, TEXT("[OP] ") Format, ##__VA_ARGS__)
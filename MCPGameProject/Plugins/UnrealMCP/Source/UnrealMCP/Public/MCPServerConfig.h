@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Runtime configuration for the MCP TCP server
+ *
+ * Values are read from the [UnrealMCP.Server] section of the editor ini
+ * (e.g. DefaultEditor.ini) when the server starts. Any key that is missing
+ * keeps the default listed below.
+ *
+ *   [UnrealMCP.Server]
+ *   MaxConnections=16
+ *   AcceptWaitMs=250
+ *   ReadWaitMs=100
+ *   SocketBufferSize=65536
+ *   MaxFrameBytes=67108864
+ *   ReceiveChunkBytes=65536
+ *   MaxPipelinedRequests=64
+ *   GameThreadBudgetMs=4.0
+ *   CommandTimeoutMs=25000
+ *   NetworkSummaryIntervalSec=60
+ *   WireTraceBufferBytes=0
+ *   WireTraceMaxRecordBytes=4096
+ *   DeferAssetCommits=True
+ *   AssetCommitIdleMs=2000
+ */
+struct UNREALMCP_API FMCPServerConfig
+{
+    /** Maximum number of simultaneously connected clients; extra clients are rejected */
+    int32 MaxConnections;
+
+    /** How long the accept loop blocks waiting for a new connection before re-checking shutdown */
+    int32 AcceptWaitMs;
+
+    /** How long a connection blocks waiting for data before re-checking shutdown */
+    int32 ReadWaitMs;
+
+    /** Requested kernel send/receive buffer size for client sockets */
+    int32 SocketBufferSize;
+
+    /** Largest single message a client may send; larger frames close the connection */
+    int32 MaxFrameBytes;
+
+    /** Minimum free space reserved in the receive buffer before each socket read */
+    int32 ReceiveChunkBytes;
+
+    /** Maximum requests with an "id" a single connection may have in flight before reads pause */
+    int32 MaxPipelinedRequests;
+
+    /** Time the game thread may spend draining queued commands per frame; at least one command always runs */
+    float GameThreadBudgetMs;
+
+    /** Default time a command may take before the client gets a "timeout" error; 0 disables the deadline. Requests can override it with "timeout_ms" */
+    int32 CommandTimeoutMs;
+
+    /** How often each connection logs a traffic summary; 0 logs it only on disconnect */
+    int32 NetworkSummaryIntervalSec;
+
+    /** Size of the wire trace ring buffer captured from server start; 0 leaves tracing off (see FMCPWireTrace) */
+    int32 WireTraceBufferBytes;
+
+    /** Payload bytes kept per wire trace record; longer messages are truncated */
+    int32 WireTraceMaxRecordBytes;
+
+    /** Hold back the compiles and saves that mutations ask for and coalesce them per asset (see FAssetDirtySet); False compiles and saves after every mutation */
+    bool bDeferAssetCommits;
+
+    /** Idle time after the last mutation before held-back compiles and saves run on their own; 0 waits for an explicit flush */
+    int32 AssetCommitIdleMs;
+
+    FMCPServerConfig()
+        : MaxConnections(16)
+        , AcceptWaitMs(250)
+        , ReadWaitMs(100)
+        , SocketBufferSize(65536)
+        , MaxFrameBytes(64 * 1024 * 1024)
+        , ReceiveChunkBytes(64 * 1024)
+        , MaxPipelinedRequests(64)
+        , GameThreadBudgetMs(4.0f)
+        , CommandTimeoutMs(25000)
+        , NetworkSummaryIntervalSec(60)
+        , WireTraceBufferBytes(0)
+        , WireTraceMaxRecordBytes(4096)
+        , bDeferAssetCommits(true)
+        , AssetCommitIdleMs(2000)
+    {
+    }
+
+    /**
+     * Load the server configuration from the editor ini
+     * @return Configuration with ini overrides applied on top of the defaults
+     */
+    static FMCPServerConfig Load();
+};
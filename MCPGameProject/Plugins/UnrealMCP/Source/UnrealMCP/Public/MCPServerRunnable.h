@@ -4,11 +4,18 @@
 #include "HAL/Runnable.h"
 #include "Sockets.h"
 #include "Interfaces/IPv4/IPv4Address.h"
+#include "MCPServerConfig.h"
+#include <atomic>
 
 class UUnrealMCPBridge;
+class FMCPClientConnection;
+class FRunnableThread;
 
 /**
  * Runnable class for the MCP server thread
+ *
+ * Accepts clients on the listener socket and hands each one to its own
+ * FMCPClientConnection worker thread, up to FMCPServerConfig::MaxConnections.
  */
 class FMCPServerRunnable : public FRunnable
 {
@@ -23,12 +30,27 @@ public:
 	virtual void Exit() override;
 
 protected:
-	void HandleClientConnection(TSharedPtr<FSocket> ClientSocket);
-	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message);
+	/** Accept one pending client and start its connection thread (or reject it when at capacity) */
+	void AcceptPendingConnection();
+
+	/** Join and delete connection threads whose client has disconnected */
+	void ReapFinishedConnections();
+
+	/** Stop every connection and wait for their threads to exit */
+	void ShutdownAllConnections();
 
 private:
+	/** A client connection together with the thread that runs it */
+	struct FActiveConnection
+	{
+		TSharedPtr<FMCPClientConnection, ESPMode::ThreadSafe> Connection;
+		FRunnableThread* Thread = nullptr;
+	};
+
 	UUnrealMCPBridge* Bridge;
 	TSharedPtr<FSocket> ListenerSocket;
-	TSharedPtr<FSocket> ClientSocket;
-	bool bRunning;
-}; 
+	FMCPServerConfig Config;
+	TArray<FActiveConnection> ActiveConnections;
+	int32 NextConnectionId;
+	std::atomic<bool> bRunning;
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Binary capture of raw MCP traffic for debugging protocol issues
+ *
+ * When enabled, every chunk received from and every frame sent to a client is
+ * copied into a fixed-size in-memory ring buffer; the oldest records are
+ * overwritten once it is full. Nothing is formatted or logged on the hot path,
+ * so tracing can stay on under load. The buffer is written out with DumpToFile,
+ * automatically when the server stops, or with the console command
+ * "UnrealMCP.WireTrace dump [path]".
+ *
+ * Dump format (little-endian):
+ *   File header: "MCPWTRC1", uint64 cycles per second, uint64 dropped records
+ *   Each record: uint64 timestamp (FPlatformTime::Cycles64), uint32 connection id,
+ *                uint8 direction (0 = received, 1 = sent), uint32 original length,
+ *                uint32 captured length, captured bytes
+ */
+class UNREALMCP_API FMCPWireTrace
+{
+public:
+    enum class EDirection : uint8
+    {
+        Received = 0,
+        Sent = 1
+    };
+
+    /** Size of the fixed part of each record */
+    static constexpr int32 RecordHeaderSize = 21;
+
+    /** @return The process-wide trace buffer */
+    static FMCPWireTrace& Get();
+
+    /**
+     * Start capturing, discarding anything captured before
+     * @param CapacityBytes - Size of the ring buffer
+     * @param MaxRecordBytes - Payload bytes kept per record; longer payloads are truncated
+     */
+    void Enable(int32 CapacityBytes, int32 MaxRecordBytes);
+
+    /** Stop capturing; the captured records are kept until the next Enable */
+    void Disable();
+
+    /** @return True while capturing; cheap enough to call before every Record */
+    bool IsEnabled() const { return bEnabled.load(std::memory_order_relaxed); }
+
+    /**
+     * Append a record, overwriting the oldest ones if needed
+     * Safe to call from any thread; does nothing while disabled
+     */
+    void Record(int32 ConnectionId, EDirection Direction, const uint8* Data, int32 Length);
+
+    /**
+     * Write the captured records, oldest first, to a file
+     * @param FilePath - Destination file, overwritten if it exists
+     * @return True if the file was written
+     */
+    bool DumpToFile(const FString& FilePath) const;
+
+    /** @return Default dump location under the project's log directory */
+    static FString GetDefaultDumpPath();
+
+private:
+    FMCPWireTrace();
+
+    /** Copy bytes into the ring starting at Offset, wrapping at the end */
+    void WriteWrapped(int32 Offset, const uint8* Data, int32 Length);
+
+    /** Copy bytes out of the ring starting at Offset, wrapping at the end */
+    void ReadWrapped(int32 Offset, uint8* OutData, int32 Length) const;
+
+    std::atomic<bool> bEnabled;
+
+    /** Guards everything below */
+    mutable FCriticalSection TraceLock;
+
+    TArray<uint8> Buffer;
+    int32 MaxRecordBytes;
+
+    /** Offset of the oldest record */
+    int32 Tail;
+
+    /** Offset the next record is written at */
+    int32 Head;
+
+    /** Bytes currently holding records */
+    int32 UsedBytes;
+
+    /** Records overwritten since Enable */
+    uint64 DroppedRecords;
+};
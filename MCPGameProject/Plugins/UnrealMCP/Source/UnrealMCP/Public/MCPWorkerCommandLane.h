@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPGameThreadDispatcher.h"
+#include "Misc/ScopeRWLock.h"
+#include <atomic>
+
+/**
+ * Runs commands that don't need the game thread on the engine worker pool
+ *
+ * Used for commands whose thread affinity is AnyThread or AssetRegistrySafe,
+ * so discovery queries run concurrently with each other and never wait behind
+ * a blueprint compile or other long game-thread command.
+ * Completions are called on the worker thread that ran the command.
+ */
+class UNREALMCP_API FMCPWorkerCommandLane
+{
+public:
+    /**
+     * @param InExecutor - Function that executes a command; called on worker threads
+     */
+    explicit FMCPWorkerCommandLane(FMCPCommandExecutor InExecutor);
+    ~FMCPWorkerCommandLane();
+
+    /**
+     * Start a command on the worker pool; safe to call from any thread
+     * If the lane has been shut down, the handle is completed immediately with an error
+     */
+    void Enqueue(const FMCPCommandHandleRef& Handle, const TSharedPtr<FJsonObject>& Params);
+
+    /** Stop accepting commands and wait for the ones already running to finish */
+    void Shutdown();
+
+    /** @return Number of commands currently running */
+    int32 GetInFlightCount() const { return InFlightCount.load(); }
+
+private:
+    FMCPCommandExecutor Executor;
+
+    /** Guards bAccepting so Shutdown can't miss a command that is being started */
+    FRWLock AcceptLock;
+    bool bAccepting;
+
+    std::atomic<int32> InFlightCount;
+};
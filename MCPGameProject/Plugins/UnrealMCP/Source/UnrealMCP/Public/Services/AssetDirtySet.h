@@ -0,0 +1,196 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+#include <atomic>
+
+class UBlueprint;
+
+/**
+ * Work still owed to a modified asset
+ */
+enum class EPendingAssetWork : uint8
+{
+    None = 0,
+
+    /** Recompile the blueprint */
+    Compile = 1 << 0,
+
+    /** Save the asset's package */
+    Save = 1 << 1,
+
+    CompileAndSave = Compile | Save
+};
+ENUM_CLASS_FLAGS(EPendingAssetWork);
+
+/**
+ * Outcome of one flush
+ */
+struct UNREALMCP_API FAssetFlushResult
+{
+    /** Paths of the blueprints that were compiled */
+    TArray<FString> Compiled;
+
+    /** Paths of the assets whose packages were saved */
+    TArray<FString> Saved;
+
+    /** Paths of the assets whose packages failed to save */
+    TArray<FString> FailedSaves;
+
+    /** Assets that were deleted or collected before the flush and were skipped */
+    int32 SkippedCount = 0;
+
+    /** Duration of the flush in milliseconds */
+    double DurationMs = 0.0;
+};
+
+/**
+ * Statistics for monitoring the dirty set
+ */
+struct UNREALMCP_API FAssetDirtySetStats
+{
+    /** Assets currently waiting for a flush */
+    int32 PendingCount = 0;
+
+    /** Number of MarkDirty calls */
+    int32 MarkCount = 0;
+
+    /** MarkDirty calls for an asset that was already pending, i.e. compiles and saves saved */
+    int32 CoalescedCount = 0;
+
+    /** Number of flushes that had work to do */
+    int32 FlushCount = 0;
+
+    /** Total compiles and package saves run by flushes */
+    int32 CompileCount = 0;
+    int32 SaveCount = 0;
+
+    /** Duration of the most recent flush in milliseconds */
+    double LastFlushMs = 0.0;
+};
+
+/**
+ * Compiles and saves that mutations have asked for, held back and coalesced
+ *
+ * Services that modify a blueprint or asset call MarkDirty instead of compiling and
+ * saving on the spot. Each asset is compiled and saved at most once per flush, however
+ * many times it was marked, so building a 60-widget HUD costs one compile and one save
+ * instead of 60 of each. A flush runs:
+ *   - when a client sends the flush command
+ *   - at the end of an execute_batch
+ *   - once a client connection closes
+ *   - after no asset has been marked for AssetCommitIdleMs
+ *
+ * Blueprints are compiled before any package is saved. Only packages that are still dirty
+ * are saved, so packages a batch rollback cleaned are left alone. Flushes wait while a
+ * PIE session is running, and while an execute_batch holds them with SuspendFlushes, so
+ * nothing a batch touches reaches disk before the batch knows whether it rolls back.
+ *
+ * With DeferAssetCommits=False in [UnrealMCP.Server], or after SetImmediateMode(true),
+ * MarkDirty compiles and saves right away, as every mutation did before.
+ *
+ * MarkDirty, Flush and the suspension calls are game thread only; RequestFlush and GetStats may be called
+ * from any thread.
+ */
+class UNREALMCP_API FAssetDirtySet
+{
+public:
+    /** @return The shared dirty set */
+    static FAssetDirtySet& Get();
+
+    /** Read the configuration and start the idle debounce ticker */
+    void Initialize();
+
+    /** Stop the ticker and drop anything still pending; called on module shutdown */
+    void Shutdown();
+
+    /**
+     * Record that an asset needs compiling and/or saving
+     * @param Asset - Modified asset; Compile is ignored unless it is a blueprint
+     * @param Work - What the asset needs
+     */
+    void MarkDirty(UObject* Asset, EPendingAssetWork Work = EPendingAssetWork::CompileAndSave);
+
+    /**
+     * Compile a blueprint now if it has a compile pending, for callers that need its
+     * generated class to reflect earlier mutations; its save stays pending
+     */
+    void EnsureCompiled(UBlueprint* Blueprint);
+
+    /** Drop a pending compile for a blueprint that was just compiled by other means */
+    void NoteCompiled(UBlueprint* Blueprint);
+
+    /**
+     * Compile and save everything pending
+     * @return What was compiled and saved
+     */
+    FAssetFlushResult Flush();
+
+    /** Flush on the next game thread tick (any thread) */
+    void RequestFlush();
+
+    /**
+     * Hold back flushes, immediate-mode commits included, until the matching ResumeFlushes
+     * A flush asked for meanwhile is remembered and runs once the last suspension ends.
+     */
+    void SuspendFlushes();
+
+    /** End one SuspendFlushes */
+    void ResumeFlushes();
+
+    /** @return Names of the packages that have a save pending */
+    TSet<FName> GetPendingSavePackages() const;
+
+    /**
+     * Drop the pending saves of assets in the given packages, e.g. because a rollback reverted them
+     * Pending compiles are kept.
+     */
+    void DiscardPendingSaves(const TSet<FName>& PackageNames);
+
+    /** @return true if MarkDirty compiles and saves immediately */
+    bool IsImmediateMode() const { return bImmediateMode.load(std::memory_order_relaxed); }
+
+    /** Switch immediate mode on or off; switching it on flushes what is pending */
+    void SetImmediateMode(bool bImmediate);
+
+    /** @return Pending count, coalescing and flush counters */
+    FAssetDirtySetStats GetStats() const;
+
+private:
+    FAssetDirtySet() = default;
+
+    /** Compile and/or save one asset right away */
+    void CommitNow(UObject* Asset, EPendingAssetWork Work);
+
+    /** @return false if the blueprint failed to compile */
+    static bool CompileBlueprint(UBlueprint* Blueprint);
+
+    /** Debounce and requested flushes */
+    bool Tick(float DeltaTime);
+
+    /** Guards PendingAssets, LastMarkTime and Stats */
+    mutable FCriticalSection Lock;
+
+    /** Asset -> work it still needs, in the order assets were first marked */
+    TMap<TWeakObjectPtr<UObject>, EPendingAssetWork> PendingAssets;
+
+    /** Time of the most recent MarkDirty */
+    double LastMarkTime = 0.0;
+
+    /** Idle time after the last MarkDirty before a flush runs on its own; 0 disables it */
+    double IdleFlushSeconds = 2.0;
+
+    FAssetDirtySetStats Stats;
+
+    std::atomic<bool> bImmediateMode { false };
+    std::atomic<bool> bFlushRequested { false };
+
+    /** True while Flush runs; saving can pump the ticker, and a nested flush is skipped */
+    bool bFlushing = false;
+
+    /** Number of SuspendFlushes calls not yet resumed; game thread only */
+    int32 SuspendCount = 0;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+};
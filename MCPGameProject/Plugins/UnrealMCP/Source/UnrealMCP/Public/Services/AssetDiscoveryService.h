@@ -42,9 +42,30 @@ private:
     FAssetDiscoveryService() = default;
     ~FAssetDiscoveryService() = default;
 
+    /**
+     * Check the negative cache for a lookup that found nothing before
+     * @param OutGeneration - Receives the asset name index generation to pass to RememberMiss
+     * @return true if the lookup is known to fail and nothing was added or renamed since
+     */
+    bool IsKnownMiss(const FString& MissKey, uint64& OutGeneration);
+
+    /** Remember a failed lookup, unless an asset was added or renamed while it ran */
+    void RememberMiss(const FString& MissKey, uint64 Generation);
+
     // Helper methods
     FString BuildGamePath(const FString& Path);
     FString BuildEnginePath(const FString& Path);
     FString BuildCorePath(const FString& Path);
     FString BuildUMGPath(const FString& Path);
+
+    /** Guards the negative cache below */
+    FCriticalSection MissLock;
+
+    /** Lookups that found nothing, oldest first; cleared whenever an asset is added or renamed */
+    TSet<FString> KnownMisses;
+    TArray<FString> MissOrder;
+    uint64 MissGeneration = 0;
+
+    /** Maximum number of remembered misses; the oldest are forgotten first */
+    static constexpr int32 MaxKnownMisses = 256;
 };
\ No newline at end of file
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/TopLevelAssetPath.h"
+#include "Misc/ScopeRWLock.h"
+#include <atomic>
+
+struct FAssetData;
+
+/**
+ * Statistics for monitoring the asset name index
+ */
+struct UNREALMCP_API FAssetNameIndexStats
+{
+    /** Assets currently in the index */
+    int32 IndexedAssets = 0;
+
+    /** Distinct short names in the index */
+    int32 DistinctNames = 0;
+
+    /** Number of lookups served */
+    int32 Lookups = 0;
+
+    /** Number of lookups that found at least one asset */
+    int32 Hits = 0;
+
+    /** Asset registry add, remove and rename events applied since startup */
+    int32 AssetsAdded = 0;
+    int32 AssetsRemoved = 0;
+    int32 AssetsRenamed = 0;
+
+    /** Duration of the initial fill from the asset registry in milliseconds */
+    double InitialBuildMs = 0.0;
+};
+
+/**
+ * One indexed asset
+ */
+struct UNREALMCP_API FAssetNameIndexEntry
+{
+    /** Full object path, e.g. /Game/Blueprints/BP_Door.BP_Door */
+    FSoftObjectPath ObjectPath;
+
+    /** Asset class, e.g. /Script/Engine.Blueprint */
+    FTopLevelAssetPath ClassPath;
+
+    /** Folder the package lives in, e.g. /Game/Blueprints */
+    FName PackagePath;
+
+    /** Short asset name with its original casing */
+    FString AssetName;
+
+    /** Object path as a string, as the Find* helpers report it */
+    FString ObjectPathString;
+};
+
+/**
+ * Short asset name -> object path index over the asset registry
+ *
+ * Filled from the asset registry when the module starts and kept current through the
+ * registry's asset added, removed and renamed events, so name lookups never load a
+ * package and never copy the registry's asset data. Names are FNames and therefore
+ * compared case-insensitively. Several assets may share a short name; lookups can be
+ * narrowed by asset class and by a root folder.
+ *
+ * Lookups are safe on any thread; registry events are applied under a write lock.
+ * While the registry is still doing its initial scan, assets it has not discovered
+ * yet are not in the index either.
+ */
+class UNREALMCP_API FAssetNameIndex
+{
+public:
+    /** @return The shared index */
+    static FAssetNameIndex& Get();
+
+    /** Subscribe to the asset registry and index every asset it knows about (game thread) */
+    void Initialize();
+
+    /** Stop listening to the asset registry and drop the index; called on module shutdown */
+    void Shutdown();
+
+    /**
+     * Find every asset with a short name, ignoring case
+     * @param AssetName - Short asset name, e.g. BP_Door
+     * @param ClassPaths - Asset classes to accept (exact match); empty accepts any class
+     * @param UnderPath - Optional root folder, e.g. /Game; searched recursively
+     * @param OutEntries - Receives the matching assets, exact-case matches first
+     * @return true if at least one asset matched
+     */
+    bool FindByName(const FString& AssetName, TConstArrayView<FTopLevelAssetPath> ClassPaths, const FString& UnderPath, TArray<FAssetNameIndexEntry>& OutEntries) const;
+
+    /**
+     * Find the best asset for a short name: exact-case matches first, then assets in the
+     * preferred folders in the order given, then any other match
+     * @param PreferredFolders - Folders to prefer, e.g. /Game/Blueprints
+     * @return true if an asset matched
+     */
+    bool FindBestByName(const FString& AssetName, TConstArrayView<FTopLevelAssetPath> ClassPaths, const FString& UnderPath, TConstArrayView<FName> PreferredFolders, FAssetNameIndexEntry& OutEntry) const;
+
+    /**
+     * Look up an asset by object or package path (/Game/X.X or /Game/X)
+     * @return true if the asset is in the index
+     */
+    bool FindByPath(const FString& AssetPath, FAssetNameIndexEntry& OutEntry) const;
+
+    /**
+     * Find assets whose short name contains a substring
+     * @param Substring - Text the short name must contain; empty matches every asset
+     * @param SearchCase - Whether the substring match is case-sensitive
+     * @param OutObjectPaths - Receives the object paths of the matches
+     */
+    void FindContaining(const FString& Substring, ESearchCase::Type SearchCase, TConstArrayView<FTopLevelAssetPath> ClassPaths, const FString& UnderPath, TArray<FString>& OutObjectPaths) const;
+
+    /** @return Index size, lookup counters and registry event counts */
+    FAssetNameIndexStats GetStats() const;
+
+    /**
+     * Counter bumped whenever an asset is added or renamed, i.e. whenever a lookup that
+     * found nothing might now succeed; caches of misses compare it to drop stale entries
+     */
+    uint64 GetGeneration() const { return Generation.load(std::memory_order_acquire); }
+
+    /**
+     * Class paths of a class and every loaded class derived from it, for filtering lookups
+     * the way a recursive-classes registry filter would
+     */
+    static TArray<FTopLevelAssetPath> GetClassPathsDerivedFrom(const UClass* BaseClass);
+
+    /** @return Object path for a package or object path: /Game/X becomes /Game/X.X */
+    static FString ToObjectPath(const FString& AssetPath);
+
+private:
+    FAssetNameIndex() = default;
+
+    /** Add or replace one asset (write lock must be held) */
+    void AddAsset(const FAssetData& AssetData);
+
+    /** Remove one asset by object path (write lock must be held) */
+    void RemoveAsset(const FSoftObjectPath& ObjectPath);
+
+    /** @return true if the entry is live (removed slots have a null path) and passes the class and folder filters */
+    static bool Matches(const FAssetNameIndexEntry& Entry, TConstArrayView<FTopLevelAssetPath> ClassPaths, const FString& UnderPath);
+
+    void OnAssetAdded(const FAssetData& AssetData);
+    void OnAssetRemoved(const FAssetData& AssetData);
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    /** Guards everything below */
+    mutable FRWLock IndexLock;
+
+    /** Entry slots; removed entries are recycled through FreeSlots */
+    TArray<FAssetNameIndexEntry> Entries;
+    TArray<int32> FreeSlots;
+
+    /** Short name -> entry slots; FName keys compare case-insensitively */
+    TMap<FName, TArray<int32>> SlotsByName;
+
+    /** Object path -> entry slot */
+    TMap<FSoftObjectPath, int32> SlotsByPath;
+
+    bool bInitialized = false;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+
+    /** Registry event counts and build time; Lookups and Hits are kept in the atomics below */
+    FAssetNameIndexStats Stats;
+
+    /** Lookups run under the read lock, so their counters are atomic */
+    mutable std::atomic<int32> LookupCount { 0 };
+    mutable std::atomic<int32> HitCount { 0 };
+
+    /** See GetGeneration */
+    std::atomic<uint64> Generation { 0 };
+};
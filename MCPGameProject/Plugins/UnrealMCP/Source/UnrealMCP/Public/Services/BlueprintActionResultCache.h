@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectGlobals.h"
+
+class IPlugin;
+
+/**
+ * Cache statistics for the blueprint action result cache
+ */
+struct UNREALMCP_API FBlueprintActionResultCacheStats
+{
+    /** Total number of cache requests */
+    int32 TotalRequests = 0;
+
+    /** Number of cache hits */
+    int32 CacheHits = 0;
+
+    /** Number of cache misses */
+    int32 CacheMisses = 0;
+
+    /** Number of cached results */
+    int32 CachedCount = 0;
+
+    /** Number of invalidated entries */
+    int32 InvalidatedCount = 0;
+
+    /** Number of times the whole cache was flushed (compile, hot reload, plugin load, action database change) */
+    int32 FlushCount = 0;
+
+    /** Cache hit ratio (0.0 to 1.0) */
+    float GetHitRatio() const
+    {
+        return TotalRequests > 0 ? static_cast<float>(CacheHits) / static_cast<float>(TotalRequests) : 0.0f;
+    }
+
+    /** Reset all statistics */
+    void Reset()
+    {
+        TotalRequests = 0;
+        CacheHits = 0;
+        CacheMisses = 0;
+        CachedCount = 0;
+        InvalidatedCount = 0;
+        FlushCount = 0;
+    }
+};
+
+/**
+ * Memoized results of get_actions_for_class, get_actions_for_pin and get_actions_for_class_hierarchy
+ *
+ * Each query rescans the whole action registry, so the serialized JSON result is kept
+ * under a key built from the query kind, the class or pin type, the search filter and
+ * the result limit. The cache is flushed whenever the set of available actions can
+ * change: after a blueprint compile, a hot reload, a plugin mount, or when the action
+ * database updates or removes an entry. Entries are evicted oldest first once the
+ * cache is full.
+ */
+class UNREALMCP_API FBlueprintActionResultCache
+{
+public:
+    /** @return The shared cache */
+    static FBlueprintActionResultCache& Get();
+
+    /**
+     * Build a cache key for a query
+     * @param QueryKind - Which query the result belongs to (e.g. "class", "pin", "hierarchy")
+     * @param Subject - Class name, or pin type and subcategory
+     * @param SearchFilter - Search filter of the query
+     * @param MaxResults - Result limit of the query
+     * @return Key for Find and Store
+     */
+    static FString MakeKey(const TCHAR* QueryKind, const FString& Subject, const FString& SearchFilter, int32 MaxResults);
+
+    /**
+     * Look up a cached result
+     * @param Key - Key from MakeKey
+     * @param OutResult - Receives the cached JSON result on a hit
+     * @return true if the result was cached
+     */
+    bool Find(const FString& Key, FString& OutResult);
+
+    /**
+     * Cache a result for future lookups
+     * @param Key - Key from MakeKey
+     * @param Result - Serialized JSON result
+     */
+    void Store(const FString& Key, const FString& Result);
+
+    /**
+     * Drop every cached result
+     * @param Reason - Logged with the flush
+     */
+    void Invalidate(const TCHAR* Reason);
+
+    /**
+     * Get cache statistics for monitoring
+     * @return Current cache statistics
+     */
+    FBlueprintActionResultCacheStats GetCacheStats() const;
+
+    /**
+     * Reset cache statistics
+     */
+    void ResetCacheStats();
+
+    /** Stop listening for invalidation events; called on module shutdown */
+    void Shutdown();
+
+private:
+    FBlueprintActionResultCache() = default;
+
+    /** Subscribe to the invalidation events that are not bound yet (game thread only) */
+    void RegisterInvalidationHooks();
+
+    void OnBlueprintCompiled();
+    void OnReloadComplete(EReloadCompleteReason Reason);
+    void OnPluginMounted(IPlugin& Plugin);
+    void OnActionDatabaseChanged(UObject* ActionKey);
+
+    /** Maximum number of cached results before the oldest are evicted */
+    static constexpr int32 MaxEntries = 512;
+
+    /** Map of cache keys to serialized results */
+    TMap<FString, FString> CachedResults;
+
+    /** Ring of cache keys in insertion order, for eviction; filled up to MaxEntries, then overwritten oldest first */
+    TArray<FString> InsertionOrder;
+
+    /** Slot of InsertionOrder holding the oldest key once the ring is full */
+    int32 OldestIndex = 0;
+
+    /** Cache statistics for monitoring */
+    mutable FBlueprintActionResultCacheStats CacheStats;
+
+    /** Critical section for thread safety */
+    mutable FCriticalSection CacheLock;
+
+    FDelegateHandle BlueprintCompiledHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle PluginMountedHandle;
+    FDelegateHandle EntryUpdatedHandle;
+    FDelegateHandle EntryRemovedHandle;
+};
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UBlueprintNodeSpawner;
+
+/**
+ * Search statistics for monitoring the action index
+ */
+struct UNREALMCP_API FBlueprintActionSearchIndexStats
+{
+    /** Live actions in the index */
+    int32 IndexedActions = 0;
+
+    /** Distinct trigrams with a posting list */
+    int32 TrigramCount = 0;
+
+    /** Number of full builds since startup */
+    int32 FullBuilds = 0;
+
+    /** Number of action database entries re-indexed incrementally */
+    int32 IncrementalUpdates = 0;
+
+    /** Number of queries served */
+    int32 Queries = 0;
+
+    /** Duration of the last full build in milliseconds */
+    double LastBuildMs = 0.0;
+};
+
+/**
+ * One indexed blueprint action, with the fields search_blueprint_actions reports
+ */
+struct UNREALMCP_API FBlueprintActionSearchEntry
+{
+    FString Title;
+    FString Category;
+    FString Tooltip;
+    FString Keywords;
+    FString NodeType;
+
+    /** Target function and owning class for function-call actions; empty otherwise */
+    FString FunctionName;
+    FString ClassName;
+    bool bIsMathFunction = false;
+};
+
+/**
+ * Inverted trigram index over FBlueprintActionDatabase for keyword search
+ *
+ * Every action is described once (title, category, tooltip, keywords), lowercased
+ * and broken into trigrams. A query only verifies the actions in the shortest
+ * posting list of its trigrams instead of scanning the whole database, and does
+ * not allocate per action. The index is built on first use and kept current
+ * through the action database's entry-updated and entry-removed callbacks:
+ * changed entries are re-indexed on the next query, and the index is rebuilt
+ * from scratch once too many entries have been replaced.
+ *
+ * Building and refreshing touch template nodes and must happen on the game thread.
+ */
+class UNREALMCP_API FBlueprintActionSearchIndex
+{
+public:
+    /** @return The shared index */
+    static FBlueprintActionSearchIndex& Get();
+
+    /**
+     * Find actions whose title, category, tooltip or keywords contain the query (case-insensitive)
+     * Results are ranked: exact title, title prefix, title substring, then matches in the other fields;
+     * ties keep action database order.
+     * @param Query - Text to search for
+     * @param CategoryFilter - Optional text the action's category must contain (case-insensitive)
+     * @param MaxResults - Maximum number of results; the search stops early once the best rank is full
+     * @param OutResults - Receives the matching actions
+     */
+    void Search(const FString& Query, const FString& CategoryFilter, int32 MaxResults, TArray<FBlueprintActionSearchEntry>& OutResults);
+
+    /** Drop the index and build it again from the action database */
+    void Rebuild();
+
+    /** @return Index size and query counters */
+    FBlueprintActionSearchIndexStats GetStats() const;
+
+    /** Stop listening to the action database; called on module shutdown */
+    void Shutdown();
+
+private:
+    FBlueprintActionSearchIndex() = default;
+
+    struct FIndexedAction
+    {
+        FBlueprintActionSearchEntry Entry;
+
+        /** Lowercase title, used for ranking */
+        FString TitleLower;
+
+        /** Lowercase title, category, tooltip and keywords separated by newlines, used for matching */
+        FString SearchTextLower;
+
+        /** Index into Categories */
+        int32 CategoryId = INDEX_NONE;
+
+        /** Action database key the action was registered under */
+        FObjectKey ActionKey;
+
+        TWeakObjectPtr<const UBlueprintNodeSpawner> Spawner;
+
+        /** False once the action has been removed or re-indexed; its postings are left in place */
+        bool bLive = true;
+    };
+
+    /** Build the index if it has never been built and re-index entries changed since the last query */
+    void EnsureUpToDate();
+
+    /** Index the whole action database from scratch (lock must be held) */
+    void BuildIndex();
+
+    /** Describe one spawner and add it to the postings */
+    void IndexSpawner(const FObjectKey& ActionKey, const UBlueprintNodeSpawner* Spawner);
+
+    /** Retire every live action registered under a key */
+    void RemoveActionKey(const FObjectKey& ActionKey);
+
+    /** Append the lowercase form of Text to Out */
+    static void AppendLower(const FString& Text, FString& Out);
+
+    /** Pack three lowercase characters into a posting list key */
+    static uint64 MakeTrigram(TCHAR A, TCHAR B, TCHAR C)
+    {
+        return (static_cast<uint64>(static_cast<uint16>(A)) << 32) | (static_cast<uint64>(static_cast<uint16>(B)) << 16) | static_cast<uint64>(static_cast<uint16>(C));
+    }
+
+    void OnEntryUpdated(UObject* ActionKey);
+    void OnEntryRemoved(UObject* ActionKey);
+
+    /** Guards everything below */
+    mutable FCriticalSection IndexLock;
+
+    TArray<FIndexedAction> Actions;
+
+    /** Trigram -> ids of the actions containing it, in ascending order */
+    TMap<uint64, TArray<int32>> Postings;
+
+    /** Action database key -> ids of its live actions */
+    TMap<FObjectKey, TArray<int32>> ActionsByKey;
+
+    /** Distinct lowercase categories, so category filters are evaluated once per category */
+    TArray<FString> Categories;
+    TMap<FString, int32> CategoryIds;
+
+    /** Keys changed or removed since the last query */
+    TSet<FObjectKey> DirtyKeys;
+
+    /** Retired actions still referenced by postings */
+    int32 RetiredCount = 0;
+
+    bool bBuilt = false;
+    FDelegateHandle EntryUpdatedHandle;
+    FDelegateHandle EntryRemovedHandle;
+
+    FBlueprintActionSearchIndexStats Stats;
+};
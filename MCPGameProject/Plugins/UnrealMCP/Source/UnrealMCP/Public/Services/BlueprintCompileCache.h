@@ -0,0 +1,140 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Blueprint.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+#include <atomic>
+
+class UPackage;
+
+/**
+ * Outcome of a Blueprint's last successful compile
+ */
+struct UNREALMCP_API FBlueprintCompileRecord
+{
+    /** BS_UpToDate or BS_UpToDateWithWarnings */
+    EBlueprintStatus Status = BS_UpToDate;
+
+    /** Warnings reported by that compile */
+    TArray<FString> Warnings;
+
+    /** Duration of that compile in milliseconds; a skipped compile saves about this much */
+    double CompileMs = 0.0;
+};
+
+/**
+ * Statistics for monitoring the compile cache
+ */
+struct UNREALMCP_API FBlueprintCompileCacheStats
+{
+    /** Blueprints with a recorded compile that is still current */
+    int32 TrackedBlueprints = 0;
+
+    /** Number of compile requests checked against the cache */
+    int32 Lookups = 0;
+
+    /** Requests answered from the cache without compiling */
+    int32 Skips = 0;
+
+    /** Records dropped because a Blueprint or one of its dependencies was modified */
+    int32 Invalidations = 0;
+
+    /** Sum of the recorded compile times of the skipped compiles, in milliseconds */
+    double SavedMs = 0.0;
+
+    /** @return Fraction of lookups that skipped the compile */
+    double GetSkipRatio() const { return Lookups > 0 ? static_cast<double>(Skips) / Lookups : 0.0; }
+};
+
+/**
+ * Remembers which Blueprints have not changed since their last successful compile
+ *
+ * Every compile that succeeds is recorded together with the packages it depends on: the
+ * Blueprint's own package, its parent Blueprints and the Blueprints and user defined
+ * structs it references. Any edit made through the editor marks the edited package dirty,
+ * and the engine's package marked dirty event drops the record of every Blueprint that
+ * depends on that package. Undo/redo drops all records, since it can restore objects
+ * without marking them dirty.
+ *
+ * A record is only used while the Blueprint still reports itself up to date and still
+ * has the class the record was made for, so a compile by any other means, or a change
+ * the events missed that dirtied the Blueprint's status, falls back to a real compile.
+ *
+ * Game thread only, except GetStats.
+ */
+class UNREALMCP_API FBlueprintCompileCache
+{
+public:
+    /** @return The shared cache */
+    static FBlueprintCompileCache& Get();
+
+    /** Subscribe to package dirty and undo/redo events */
+    void Initialize();
+
+    /** Unsubscribe and drop every record; called on module shutdown */
+    void Shutdown();
+
+    /**
+     * Look up a Blueprint's last compile
+     * @param Blueprint - Blueprint about to be compiled
+     * @param OutRecord - The recorded outcome, if the compile can be skipped
+     * @return true if nothing the Blueprint depends on changed since that compile
+     */
+    bool FindUpToDate(UBlueprint* Blueprint, FBlueprintCompileRecord& OutRecord);
+
+    /**
+     * Record a compile; failed compiles drop the Blueprint's record instead
+     * @param Blueprint - Blueprint that was just compiled
+     * @param Warnings - Warnings the compile reported
+     * @param CompileMs - Duration of the compile in milliseconds
+     */
+    void RecordCompile(UBlueprint* Blueprint, const TArray<FString>& Warnings, double CompileMs);
+
+    /** Forget a Blueprint's record */
+    void Invalidate(UBlueprint* Blueprint);
+
+    /** @return Record and skip counters */
+    FBlueprintCompileCacheStats GetStats() const;
+
+    /** Reset the lookup, skip and invalidation counters */
+    void ResetStats();
+
+private:
+    FBlueprintCompileCache() = default;
+
+    struct FEntry
+    {
+        FBlueprintCompileRecord Record;
+
+        /** Class the compile produced; a different class means the Blueprint was recompiled elsewhere */
+        TWeakObjectPtr<UClass> GeneratedClass;
+
+        /** Packages whose modification invalidates the record */
+        TArray<TObjectKey<UPackage>, TInlineAllocator<4>> Packages;
+    };
+
+    /** Remove a Blueprint's entry and its reverse index links */
+    void RemoveEntry(TObjectKey<UBlueprint> BlueprintKey);
+
+    /** Drop the records of every Blueprint depending on a package */
+    void OnPackageMarkedDirty(UPackage* Package, bool bWasDirty);
+    void OnUndoRedo();
+
+    /** Blueprint -> its last successful compile */
+    TMap<TObjectKey<UBlueprint>, FEntry> Entries;
+
+    /** Package -> Blueprints whose records depend on it */
+    TMap<TObjectKey<UPackage>, TArray<TObjectKey<UBlueprint>, TInlineAllocator<1>>> Dependents;
+
+    bool bInitialized = false;
+    FDelegateHandle PackageDirtyHandle;
+    FDelegateHandle UndoRedoHandle;
+
+    /** Read by get_cache_stats on any thread, so the counters are atomic */
+    std::atomic<int32> TrackedCount { 0 };
+    std::atomic<int32> LookupCount { 0 };
+    std::atomic<int32> SkipCount { 0 };
+    std::atomic<int32> InvalidationCount { 0 };
+    std::atomic<double> SavedMs { 0.0 };
+};
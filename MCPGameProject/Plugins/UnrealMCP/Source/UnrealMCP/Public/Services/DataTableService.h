@@ -20,6 +20,8 @@ public:
     virtual bool UpdateRowsInDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutUpdatedRows, TArray<FString>& OutFailedRows) override;
     virtual bool DeleteRowsFromDataTable(UDataTable* DataTable, const TArray<FString>& RowNames, TArray<FString>& OutDeletedRows, TArray<FString>& OutFailedRows) override;
     virtual TSharedPtr<FJsonObject> GetDataTableRows(const UDataTable* DataTable, const TArray<FString>& RowNames = TArray<FString>()) override;
+    virtual bool ImportDataTableRows(UDataTable* DataTable, const FDataTableImportParams& Params, FDataTableImportResult& OutResult, FString& OutError) override;
+    virtual bool ExportDataTableRows(const UDataTable* DataTable, const FDataTableExportParams& Params, FDataTableExportResult& OutResult, FString& OutError) override;
     virtual bool GetDataTableRowNames(const UDataTable* DataTable, TArray<FString>& OutRowNames, TArray<FString>& OutFieldNames) override;
     virtual TSharedPtr<FJsonObject> GetDataTablePropertyMap(const UDataTable* DataTable) override;
     virtual bool ValidateRowData(const UDataTable* DataTable, const TSharedPtr<FJsonObject>& RowData, FString& OutError) override;
@@ -32,13 +34,6 @@ private:
      */
     UScriptStruct* FindStruct(const FString& StructName);
     
-    /**
-     * Build GUID to struct name mapping for a struct
-     * @param RowStruct - Target struct
-     * @return Mapping from GUID property names to struct property names
-     */
-    TMap<FString, FString> BuildGuidToStructNameMap(const UScriptStruct* RowStruct);
-    
     /**
      * Transform JSON object from GUID property names to struct property names
      * @param InJson - Input JSON with GUID property names
@@ -97,7 +92,7 @@ private:
     FString GetTriedStructPaths(const FString& StructName) const;
     
     /**
-     * Fill missing fields in JSON object with default values based on struct definition
+     * Fill missing fields in JSON object with the struct's default values, from its cached schema
      * @param RowStruct - The struct definition to use for filling missing fields
      * @param RowData - JSON object to fill with missing fields
      */
@@ -26,6 +26,7 @@ public:
     
     // IEditorService interface implementation
     virtual TArray<AActor*> GetActorsInLevel() override;
+    virtual bool QueryActorsInLevel(const FActorQueryParams& Params, FActorQueryResult& OutResult, FString& OutError) override;
     virtual TArray<AActor*> FindActorsByName(const FString& Pattern) override;
     virtual AActor* SpawnActor(const FActorSpawnParams& Params, FString& OutError) override;
     virtual AActor* SpawnBlueprintActor(const FBlueprintActorSpawnParams& Params, FString& OutError) override;
@@ -52,6 +53,14 @@ private:
      */
     UWorld* GetEditorWorld() const;
     
+    /**
+     * Check an actor against the filters of a query
+     * @param ClassMatches - Memoized class filter results, so each class is checked once per query
+     * @param TagName - Tag filter as an FName, or NAME_None if there is no tag filter
+     * @return true if the actor passes every filter
+     */
+    static bool ActorMatchesQuery(AActor* Actor, const FActorQueryParams& Params, FName TagName, TMap<const UClass*, bool>& ClassMatches);
+    
     /**
      * Spawn actor of specific type
      * @param ActorClass - Class of actor to spawn
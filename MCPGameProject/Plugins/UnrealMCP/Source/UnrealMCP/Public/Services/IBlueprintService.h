@@ -36,6 +36,74 @@ struct UNREALMCP_API FBlueprintCreationParams
     bool IsValid(FString& OutError) const;
 };
 
+/**
+ * Parameters for compiling several Blueprints together
+ */
+struct UNREALMCP_API FBlueprintBatchCompileParams
+{
+    /** Blueprints to compile */
+    TArray<UBlueprint*> Blueprints;
+    
+    /**
+     * Blueprints queued per compilation manager flush; 0 queues them all at once
+     * Smaller waves report results sooner, but dependencies shared across waves are reinstanced once per wave.
+     */
+    int32 WaveSize = 0;
+    
+    /** Compile every Blueprint, even those unchanged since their last successful compile */
+    bool bForce = false;
+};
+
+/**
+ * Outcome of compiling one Blueprint of a batch
+ */
+struct UNREALMCP_API FBlueprintCompileResult
+{
+    /** Asset name and object path of the Blueprint */
+    FString Name;
+    FString Path;
+    
+    /** Status after the compile; BS_Unknown if the Blueprint was never compiled (e.g. the batch was cancelled) */
+    EBlueprintStatus Status = BS_Unknown;
+    
+    /** Compiler messages left on the Blueprint's nodes */
+    TArray<FString> Errors;
+    TArray<FString> Warnings;
+    
+    /** Time from the start of the batch until this Blueprint's wave finished compiling, in milliseconds */
+    double CompletedAtMs = 0.0;
+    
+    /** True if nothing changed since the last successful compile; Status and Warnings are that compile's */
+    bool bSkipped = false;
+    
+    /** @return true if the Blueprint compiled without errors */
+    bool Succeeded() const { return Status == BS_UpToDate || Status == BS_UpToDateWithWarnings; }
+};
+
+/**
+ * Outcome of a batch compile
+ */
+struct UNREALMCP_API FBlueprintBatchCompileResult
+{
+    /** One entry per Blueprint, in the order they were given */
+    TArray<FBlueprintCompileResult> Results;
+    
+    /** Number of compilation manager flushes */
+    int32 WaveCount = 0;
+    
+    /** Blueprints answered from the compile cache without compiling */
+    int32 SkippedCount = 0;
+    
+    /** Time spent compiling and reinstancing, in milliseconds */
+    double CompileMs = 0.0;
+    
+    /** True if the command was cancelled between waves; later Blueprints were not compiled */
+    bool bCancelled = false;
+};
+
+/** Called for each Blueprint of a batch as soon as its wave has been compiled */
+typedef TFunction<void(const FBlueprintCompileResult&)> FOnBlueprintCompiled;
+
 /**
  * Interface for Blueprint service operations
  * Provides abstraction for Blueprint creation, modification, and management
@@ -68,6 +136,14 @@ public:
      */
     virtual bool CompileBlueprint(UBlueprint* Blueprint, FString& OutError) = 0;
     
+    /**
+     * Compile several Blueprints through the compilation manager, so dependencies they share are reinstanced once
+     * @param Params - Blueprints to compile and wave size
+     * @param OutResult - Per-Blueprint status, compiler messages and timings
+     * @param OnCompiled - Optional; called for each Blueprint as soon as its wave has been compiled
+     */
+    virtual void CompileBlueprints(const FBlueprintBatchCompileParams& Params, FBlueprintBatchCompileResult& OutResult, const FOnBlueprintCompiled& OnCompiled = FOnBlueprintCompiled()) = 0;
+    
     /**
      * Find a Blueprint by name
      * @param BlueprintName - Name of the Blueprint to find
@@ -55,6 +55,125 @@ struct UNREALMCP_API FDataTableRowParams
     bool IsValid(const UDataTable* DataTable, FString& OutError) const;
 };
 
+/**
+ * Text formats for bulk row import and export
+ */
+enum class EDataTableRowFormat : uint8
+{
+    /** One JSON object per line: {"row_name": "...", "row_data": {...}} */
+    JsonLines,
+    
+    /** A header record naming the row name column and the fields, then one record per row */
+    Csv
+};
+
+/**
+ * Parameters for importing many rows from JSON lines or CSV
+ */
+struct UNREALMCP_API FDataTableImportParams
+{
+    /** Format of Data or of the file at FilePath */
+    EDataTableRowFormat Format = EDataTableRowFormat::JsonLines;
+    
+    /** Rows as text; ignored if FilePath is set */
+    FString Data;
+    
+    /** File to read the rows from, line by line */
+    FString FilePath;
+    
+    /** Remove every existing row before importing; otherwise rows with an existing name are overwritten */
+    bool bReplace = false;
+    
+    /** Default constructor */
+    FDataTableImportParams() = default;
+    
+    /**
+     * Validate the parameters
+     * @param OutError - Error message if validation fails
+     * @return true if parameters are valid
+     */
+    bool IsValid(FString& OutError) const;
+};
+
+/**
+ * Outcome of a bulk import
+ */
+struct UNREALMCP_API FDataTableImportResult
+{
+    /** Maximum number of row errors kept in Errors; ErrorCount counts them all */
+    static constexpr int32 MaxReportedErrors = 100;
+    
+    /** Rows added or overwritten */
+    int32 ImportedCount = 0;
+    
+    /** Rows that failed to parse or convert, and the first MaxReportedErrors of their errors */
+    int32 ErrorCount = 0;
+    TArray<FString> Errors;
+    
+    /** True if the command was cancelled part way; the rows imported so far stay in the table */
+    bool bCancelled = false;
+    
+    /** Duration of the import in milliseconds */
+    double DurationMs = 0.0;
+    
+    /** @return Imported rows per second */
+    double GetRowsPerSecond() const { return DurationMs > 0.0 ? ImportedCount * 1000.0 / DurationMs : 0.0; }
+};
+
+/**
+ * Parameters for exporting one page of rows, or every row to a file
+ */
+struct UNREALMCP_API FDataTableExportParams
+{
+    /** Default and maximum number of rows per page */
+    static constexpr int32 DefaultLimit = 1000;
+    static constexpr int32 MaxLimit = 50000;
+    
+    /** Format of the exported text */
+    EDataTableRowFormat Format = EDataTableRowFormat::JsonLines;
+    
+    /** Maximum number of rows to export; ignored when writing to a file, which receives every remaining row */
+    int32 Limit = DefaultLimit;
+    
+    /** Cursor returned with the previous page; empty starts at the first row */
+    FString Cursor;
+    
+    /** File to write the rows to instead of returning them */
+    FString FilePath;
+    
+    /** Default constructor */
+    FDataTableExportParams() = default;
+    
+    /**
+     * Validate the parameters
+     * @param OutError - Error message if validation fails
+     * @return true if parameters are valid
+     */
+    bool IsValid(FString& OutError) const;
+};
+
+/**
+ * One exported page of rows
+ */
+struct UNREALMCP_API FDataTableExportResult
+{
+    /** Exported rows as text; empty when they were written to a file */
+    FString Data;
+    
+    /** Rows in this page, and in the whole table */
+    int32 RowCount = 0;
+    int32 TotalRows = 0;
+    
+    /** Cursor for the next page; empty if this was the last page */
+    FString NextCursor;
+    
+    /** Duration of the export in milliseconds */
+    double DurationMs = 0.0;
+    
+    /** @return Exported rows per second */
+    double GetRowsPerSecond() const { return DurationMs > 0.0 ? RowCount * 1000.0 / DurationMs : 0.0; }
+};
+
 /**
  * Interface for DataTable service operations
  * Provides abstraction for DataTable creation, modification, and management
@@ -116,6 +235,28 @@ public:
      */
     virtual TSharedPtr<FJsonObject> GetDataTableRows(const UDataTable* DataTable, const TArray<FString>& RowNames = TArray<FString>()) = 0;
     
+    /**
+     * Import rows from JSON lines or CSV text, one line at a time
+     * The field name mapping is computed once per import and every row is converted in the same buffer.
+     * Fields a row leaves out keep the row struct's defaults.
+     * @param DataTable - Target DataTable
+     * @param Params - Source text or file, format and whether to replace the existing rows
+     * @param OutResult - Imported and failed row counts and timing
+     * @param OutError - Error message if the import could not start, e.g. an unknown CSV column
+     * @return true if the import ran; individual rows may still have failed
+     */
+    virtual bool ImportDataTableRows(UDataTable* DataTable, const FDataTableImportParams& Params, FDataTableImportResult& OutResult, FString& OutError) = 0;
+    
+    /**
+     * Export one page of rows as JSON lines or CSV, or every row from the cursor on to a file
+     * @param DataTable - Source DataTable
+     * @param Params - Format, page size, cursor and optional output file
+     * @param OutResult - The exported text and the cursor for the next page
+     * @param OutError - Error message if the export fails
+     * @return true if the export succeeded
+     */
+    virtual bool ExportDataTableRows(const UDataTable* DataTable, const FDataTableExportParams& Params, FDataTableExportResult& OutResult, FString& OutError) = 0;
+    
     /**
      * Get row names and field names from a DataTable
      * @param DataTable - Target DataTable
@@ -67,6 +67,60 @@ struct UNREALMCP_API FBlueprintActorSpawnParams
     bool IsValid(FString& OutError) const;
 };
 
+/**
+ * Filters and page position for listing the actors of the current level
+ */
+struct UNREALMCP_API FActorQueryParams
+{
+    /** Default and maximum number of actors per page */
+    static constexpr int32 DefaultLimit = 1000;
+    static constexpr int32 MaxLimit = 10000;
+    
+    /** Maximum number of actors to return */
+    int32 Limit = DefaultLimit;
+    
+    /** Cursor returned with the previous page; empty starts at the first actor */
+    FString Cursor;
+    
+    /** Class the actor must be or derive from, e.g. StaticMeshActor or BP_Door (the _C suffix is optional) */
+    FString ClassName;
+    
+    /** Tag the actor must have */
+    FString Tag;
+    
+    /** Outliner folder the actor must be in, without leading or trailing slashes, e.g. Lighting/Interior; subfolders are included */
+    FString FolderPath;
+    
+    /** Wildcard pattern the actor's name or label must match, e.g. *Light* */
+    FString NamePattern;
+    
+    /** Box the actor's location must lie in, if bHasBounds is set */
+    FBox Bounds = FBox(ForceInit);
+    bool bHasBounds = false;
+    
+    /** Default constructor */
+    FActorQueryParams() = default;
+    
+    /**
+     * Validate the parameters
+     * @param OutError - Error message if validation fails
+     * @return true if parameters are valid
+     */
+    bool IsValid(FString& OutError) const;
+};
+
+/**
+ * One page of actors
+ */
+struct UNREALMCP_API FActorQueryResult
+{
+    /** Matching actors, in level order */
+    TArray<AActor*> Actors;
+    
+    /** Cursor for the next page; empty if this was the last page */
+    FString NextCursor;
+};
+
 /**
  * Interface for Editor service operations
  * Provides abstraction for actor manipulation, viewport control, and asset discovery
@@ -82,6 +136,17 @@ public:
      */
     virtual TArray<AActor*> GetActorsInLevel() = 0;
     
+    /**
+     * Get one page of the actors in the current level that pass the filters
+     * Only the actors up to the end of the page are visited, so a page costs the same
+     * however large the level is, as long as the filters match often enough
+     * @param Params - Filters, page size and cursor
+     * @param OutResult - Receives the page and the cursor for the next one
+     * @param OutError - Error message if the query fails
+     * @return true if the query succeeded
+     */
+    virtual bool QueryActorsInLevel(const FActorQueryParams& Params, FActorQueryResult& OutResult, FString& OutError) = 0;
+    
     /**
      * Find actors by name pattern
      * @param Pattern - Name pattern to search for
@@ -114,8 +179,8 @@ public:
     virtual bool DeleteActor(const FString& ActorName, FString& OutError) = 0;
     
     /**
-     * Find an actor by name
-     * @param ActorName - Name of the actor to find
+     * Find an actor by name, or by its outliner label if no actor has that name
+     * @param ActorName - Name or label of the actor to find
      * @return Found actor or nullptr
      */
     virtual AActor* FindActorByName(const FString& ActorName) = 0;
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+#include <atomic>
+
+class AActor;
+class ULevel;
+class UWorld;
+
+/**
+ * Statistics for monitoring the level actor index
+ */
+struct UNREALMCP_API FLevelActorIndexStats
+{
+    /** Worlds with a built index */
+    int32 IndexedWorlds = 0;
+
+    /** Actors in the built indexes */
+    int32 IndexedActors = 0;
+
+    /** Number of lookups served */
+    int32 Lookups = 0;
+
+    /** Number of lookups that found an actor */
+    int32 Hits = 0;
+
+    /** Number of full index builds, including rebuilds after bulk changes */
+    int32 Builds = 0;
+
+    /** Duration of the most recent build in milliseconds */
+    double LastBuildMs = 0.0;
+};
+
+/**
+ * Actor name and label -> actor index for editor worlds
+ *
+ * Each editor world gets its own index, built on the first lookup by walking the world's
+ * actors once and then kept current through the engine's level actor added and deleted
+ * events and the actor label changed event (which also covers renames made from the
+ * editor, since relabeling an actor renames the object to match). Loading or unloading
+ * a level, undo/redo and the engine's actor list changed event mark the world's index
+ * stale, and it is rebuilt on the next lookup. Worlds that are torn down are dropped.
+ *
+ * Actor names are FNames and compare case-insensitively, like the previous linear scans
+ * did. Several actors may share a label, and actors in different levels may even share
+ * a name; lookups return the first live one. Entries are weak, so a destroyed actor is
+ * never returned even if its deleted event was missed.
+ *
+ * Worlds other than editor worlds (PIE, game preview) spawn and destroy actors at
+ * runtime without the editor events, so lookups in them fall back to a linear scan.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FLevelActorIndex
+{
+public:
+    /** @return The shared index */
+    static FLevelActorIndex& Get();
+
+    /** Subscribe to the engine's actor events; deferred until the engine is up */
+    void Initialize();
+
+    /** Unsubscribe and drop every world's index; called on module shutdown */
+    void Shutdown();
+
+    /**
+     * Find an actor by object name
+     * @param World - World to search; nullptr finds nothing
+     * @param ActorName - Object name, e.g. StaticMeshActor_3; compared ignoring case
+     * @return The actor, or nullptr if the world has no actor with this name
+     */
+    AActor* FindByName(UWorld* World, const FString& ActorName);
+
+    /**
+     * Find an actor by the label shown in the outliner
+     * @return The first live actor with this label, or nullptr
+     */
+    AActor* FindByLabel(UWorld* World, const FString& ActorLabel);
+
+    /** @return The actor with this object name, or else the first one with this label */
+    AActor* FindByNameOrLabel(UWorld* World, const FString& NameOrLabel);
+
+    /** Mark a world's index stale so it is rebuilt on the next lookup */
+    void MarkDirty(UWorld* World);
+
+    /** @return World, actor and lookup counters */
+    FLevelActorIndexStats GetStats() const;
+
+private:
+    FLevelActorIndex() = default;
+
+    using FActorList = TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>>;
+
+    /** Name and label an actor was indexed under, so both can be removed when it changes */
+    struct FIndexedKeys
+    {
+        FName Name;
+        FString Label;
+    };
+
+    /** Index of one world */
+    struct FWorldActors
+    {
+        TMap<FName, FActorList> ByName;
+        TMap<FString, FActorList> ByLabel;
+        TMap<TObjectKey<AActor>, FIndexedKeys> KeysByActor;
+        bool bDirty = true;
+    };
+
+    /** @return The up-to-date index of an editor world, or nullptr for any other world */
+    FWorldActors* GetWorldActors(UWorld* World);
+
+    /** Rebuild a world's index from its actors */
+    void Build(UWorld* World, FWorldActors& WorldActors);
+
+    /** Index one actor under its current name and label, replacing any previous keys */
+    void AddActor(FWorldActors& WorldActors, AActor* Actor);
+
+    /** Remove one actor from the keys it was indexed under */
+    void RemoveActor(FWorldActors& WorldActors, const AActor* Actor);
+
+    /** @return The live actor filed under a name, moving actors filed there under an old name */
+    AActor* FindIndexedByName(FWorldActors& WorldActors, FName NameKey);
+
+    /**
+     * Find an actor by name by walking the world's actors
+     * Catches actors an index has not seen renamed.
+     * @param WorldActors - Index to file the found actor in, or nullptr if the world is not indexed
+     */
+    AActor* ScanByName(UWorld* World, const FString& ActorName, FWorldActors* WorldActors);
+
+    /** @return The first live actor in a list */
+    static AActor* FirstLive(const FActorList* Actors);
+
+    /** @return The built index of the world an actor belongs to, or nullptr if that world has none */
+    FWorldActors* FindBuiltWorldActors(const AActor* Actor);
+
+    /** Bind to GEngine; runs at startup or once the engine is initialized */
+    void BindEngineEvents();
+
+    void OnLevelActorAdded(AActor* Actor);
+    void OnLevelActorDeleted(AActor* Actor);
+    void OnActorLabelChanged(AActor* Actor);
+    void OnLevelActorListChanged();
+    void OnLevelChanged(ULevel* Level, UWorld* World);
+    void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+    void OnUndoRedo();
+
+    /** World -> its index */
+    TMap<TObjectKey<UWorld>, TUniquePtr<FWorldActors>> Worlds;
+
+    bool bInitialized = false;
+    FDelegateHandle PostEngineInitHandle;
+    FDelegateHandle ActorAddedHandle;
+    FDelegateHandle ActorDeletedHandle;
+    FDelegateHandle ActorListChangedHandle;
+    FDelegateHandle ActorLabelChangedHandle;
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+    FDelegateHandle WorldCleanupHandle;
+    FDelegateHandle UndoRedoHandle;
+
+    /** Read by get_cache_stats on any thread, so the counters are atomic */
+    std::atomic<int32> IndexedActorCount { 0 };
+    std::atomic<int32> IndexedWorldCount { 0 };
+    std::atomic<int32> LookupCount { 0 };
+    std::atomic<int32> HitCount { 0 };
+    std::atomic<int32> BuildCount { 0 };
+    std::atomic<double> LastBuildMs { 0.0 };
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UEdGraphNode;
+
+/**
+ * Description of one node pin as reported by get_node_pin_info
+ */
+struct UNREALMCP_API FNodePinInfo
+{
+    FString PinType;
+    FString ExpectedType;
+    FString Description;
+    bool bIsRequired = false;
+    bool bIsInput = true;
+
+    /** @return The pin_info object of the get_node_pin_info response */
+    TSharedRef<FJsonObject> ToJson() const;
+};
+
+/**
+ * Pins of one node, with every accepted pin name resolved ahead of time
+ */
+struct UNREALMCP_API FNodePinSet
+{
+    /** Name the node is known under in the catalog, or its template title */
+    FString NodeKey;
+
+    /** Every accepted pin name, including alternative names, in declaration order */
+    TArray<FString> PinNames;
+
+    TArray<FNodePinInfo> Pins;
+
+    /** Normalized pin name -> index into Pins */
+    TMap<FString, int32> PinsByKey;
+
+    /** True if the pins were derived from a node template in the action database */
+    bool bFromTemplate = false;
+
+    /**
+     * Find a pin by name, ignoring case and spaces
+     * @return The pin, or nullptr if the node has no such pin
+     */
+    const FNodePinInfo* FindPin(const FString& PinName) const;
+
+    /** Register a pin name for the pin at PinIndex */
+    void AddPinName(const FString& PinName, int32 PinIndex);
+};
+
+/**
+ * Pin descriptions for get_node_pin_info
+ *
+ * Well-known nodes are described by static tables that are turned into lookup maps
+ * once, on first use, with node and pin names normalized (lowercase, no spaces) ahead
+ * of time. Nodes that are not in the catalog are resolved against the node templates
+ * of FBlueprintActionDatabase; the pins derived from a template are cached per node
+ * signature (node class plus the member it targets) and per requested name until the
+ * action database changes.
+ *
+ * Catalog lookups are safe on any thread. A node template is only scanned on the game
+ * thread; worker threads are served from the template caches and otherwise hand the
+ * scan to the game thread.
+ */
+class UNREALMCP_API FNodePinCatalog
+{
+public:
+    /** @return The shared catalog */
+    static FNodePinCatalog& Get();
+
+    /**
+     * Find the pins of a node by name, ignoring case and spaces
+     * @param NodeName - Catalog name or action title of the node
+     * @param bOutTimedOut - Set if a worker thread gave up waiting for the game thread to scan the action database; the node may exist, so the lookup is worth retrying
+     * @return The node's pins, or nullptr if neither the catalog nor the action database knows the node, or the lookup timed out
+     */
+    TSharedPtr<const FNodePinSet> FindNode(const FString& NodeName, bool& bOutTimedOut);
+
+    /** @return Names of the catalog nodes, including alternative names, in declaration order */
+    const TArray<FString>& GetCatalogNodeNames() const { return CatalogNodeNames; }
+
+    /** Drop the pins derived from node templates */
+    void ClearTemplateCache();
+
+    /** Stop listening to the action database; called on module shutdown */
+    void Shutdown();
+
+    /** @return Name with spaces removed and lowercased, the form every lookup key uses */
+    static FString NormalizeName(const FString& Name);
+
+private:
+    FNodePinCatalog();
+
+    /**
+     * Look up a name in the template caches
+     * @param OutPins - Receives the cached pins, or nullptr for a remembered miss
+     * @return true if the name was resolved before
+     */
+    bool FindCachedTemplate(const FString& NormalizedName, TSharedPtr<const FNodePinSet>& OutPins);
+
+    /** Find a node template in the action database whose title or target function matches (game thread only) */
+    TSharedPtr<const FNodePinSet> FindTemplateNode(const FString& NormalizedName);
+
+    /** Describe the visible pins of a template node */
+    static TSharedRef<FNodePinSet> DescribeTemplatePins(const FString& NodeKey, const UEdGraphNode* TemplateNode);
+
+    void OnActionDatabaseChanged(UObject* ActionKey);
+
+    /** Normalized node name -> catalog node, built once */
+    TMap<FString, TSharedPtr<const FNodePinSet>> CatalogNodes;
+    TArray<FString> CatalogNodeNames;
+
+    /** Guards the template caches below */
+    FCriticalSection TemplateLock;
+
+    /** Node signature -> pins derived from its template */
+    TMap<FGuid, TSharedPtr<const FNodePinSet>> TemplatePinsBySignature;
+
+    /** Normalized node name -> pins derived from a template */
+    TMap<FString, TSharedPtr<const FNodePinSet>> TemplatePinsByName;
+
+    /** Normalized names no template matched, so repeated misses do not rescan the database */
+    TSet<FString> TemplateMisses;
+
+    /** Maximum number of remembered misses before they are forgotten */
+    static constexpr int32 MaxTemplateMisses = 256;
+
+    /** How long a worker thread waits for the game thread to resolve an uncached node */
+    static constexpr int32 TemplateLookupTimeoutMs = 2000;
+
+    FDelegateHandle EntryUpdatedHandle;
+    FDelegateHandle EntryRemovedHandle;
+};
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
+#include <atomic>
+
+struct FAssetData;
+
+/**
+ * Kinds of objects kept in the resolution cache; each kind has its own table and counters
+ */
+enum class EResolvedObjectKind : uint8
+{
+    Blueprint,
+    WidgetBlueprint,
+    Struct,
+    DataTable,
+    Class,
+
+    Count
+};
+
+/**
+ * Cache statistics for one kind of resolved object
+ */
+struct UNREALMCP_API FObjectResolutionKindStats
+{
+    /** Total number of cache requests */
+    int32 TotalRequests = 0;
+
+    /** Number of cache hits */
+    int32 CacheHits = 0;
+
+    /** Number of cache misses */
+    int32 CacheMisses = 0;
+
+    /** Number of cached objects */
+    int32 CachedCount = 0;
+
+    /** Number of entries found stale (older generation or object gone) */
+    int32 InvalidatedCount = 0;
+
+    /** Cache hit ratio (0.0 to 1.0) */
+    float GetHitRatio() const
+    {
+        return TotalRequests > 0 ? static_cast<float>(CacheHits) / static_cast<float>(TotalRequests) : 0.0f;
+    }
+
+    /** Reset all statistics */
+    void Reset()
+    {
+        TotalRequests = 0;
+        CacheHits = 0;
+        CacheMisses = 0;
+        CachedCount = 0;
+        InvalidatedCount = 0;
+    }
+};
+
+/**
+ * Statistics for the whole resolution cache
+ */
+struct UNREALMCP_API FObjectResolutionCacheStats
+{
+    /** Per-kind counters, indexed by EResolvedObjectKind */
+    FObjectResolutionKindStats Kinds[static_cast<int32>(EResolvedObjectKind::Count)];
+
+    /** Current generation; entries stamped with an older one are stale */
+    uint64 Generation = 0;
+
+    /** @return Counters summed over every kind */
+    FObjectResolutionKindStats GetTotals() const;
+};
+
+/**
+ * Shared cache of name -> object resolutions for blueprints, widget blueprints, structs,
+ * DataTables and classes
+ *
+ * Entries hold a TWeakObjectPtr stamped with a global generation counter. The counter
+ * is bumped when an asset is deleted or renamed and after a hot reload or package
+ * reload, which makes every older entry stale at once; an entry whose object was
+ * garbage collected is stale as well. Modifying or compiling an object does not change
+ * its identity, so it leaves the entry valid.
+ *
+ * Each kind has a fixed-size open-addressing table probed by a 64-bit hash of the
+ * lowercased name. A slot also holds the name itself, as an FName, which is compared
+ * before a hit is returned, so two names with the same hash never share an entry.
+ * Slots are guarded by sequence counters: reads take no lock and retry if a writer
+ * updated the slot concurrently, while writers (on a miss) serialize on a lock. A table
+ * that fills up is cleared.
+ */
+class UNREALMCP_API FObjectResolutionCache
+{
+public:
+    /** @return The shared cache */
+    static FObjectResolutionCache& Get();
+
+    /** Subscribe to the events that bump the generation (game thread) */
+    void Initialize();
+
+    /** Unsubscribe and drop every entry; called on module shutdown */
+    void Shutdown();
+
+    /**
+     * Look up a previously resolved object
+     * Safe on any thread. Off the game thread the weak pointer is resolved under a GC guard;
+     * keeping the returned object alive afterwards is up to the caller.
+     * @param Kind - Kind of object, selecting the table
+     * @param Key - Name or path the object was resolved from; compared ignoring case
+     * @return The object, or nullptr if it is not cached or the entry is stale
+     */
+    UObject* Find(EResolvedObjectKind Kind, const FString& Key);
+
+    template <typename T>
+    T* Find(EResolvedObjectKind Kind, const FString& Key)
+    {
+        return Cast<T>(Find(Kind, Key));
+    }
+
+    /**
+     * Remember the object a name resolved to
+     * @param Object - Resolved object; nullptr is ignored
+     */
+    void Store(EResolvedObjectKind Kind, const FString& Key, UObject* Object);
+
+    /** Make every entry stale */
+    void Invalidate(const TCHAR* Reason);
+
+    /** @return The current generation */
+    uint64 GetGeneration() const { return Generation.load(std::memory_order_acquire); }
+
+    /** @return Per-kind counters and the current generation */
+    FObjectResolutionCacheStats GetStats() const;
+
+    /** Reset the hit and miss counters */
+    void ResetStats();
+
+    /** @return Lowercase name of a kind, as reported by get_cache_stats */
+    static const TCHAR* GetKindName(EResolvedObjectKind Kind);
+
+private:
+    FObjectResolutionCache() = default;
+
+    /** One cache slot; every field is atomic so lock-free readers never see a torn value */
+    struct FSlot
+    {
+        /** Odd while a writer is updating the slot */
+        std::atomic<uint32> Sequence { 0 };
+
+        /** Hash of the key; 0 marks an empty slot */
+        std::atomic<uint64> KeyHash { 0 };
+
+        /** The key as an FName's comparison index and number, compared on a hash match */
+        std::atomic<uint64> KeyNameBits { 0 };
+
+        std::atomic<uint64> Generation { 0 };
+
+        /** The TWeakObjectPtr's index and serial number */
+        std::atomic<uint64> WeakObjectBits { 0 };
+    };
+
+    /** Number of slots per kind; a power of two */
+    static constexpr int32 SlotsPerKind = 512;
+
+    /** Linear probes before a lookup gives up */
+    static constexpr int32 MaxProbes = 16;
+
+    /** Occupied slots at which a table is cleared instead of growing */
+    static constexpr int32 MaxOccupiedSlots = SlotsPerKind / 2;
+
+    /** Per-kind table and counters */
+    struct FKindTable
+    {
+        FSlot Slots[SlotsPerKind];
+        std::atomic<int32> OccupiedSlots { 0 };
+        std::atomic<int32> TotalRequests { 0 };
+        std::atomic<int32> CacheHits { 0 };
+        std::atomic<int32> InvalidatedCount { 0 };
+    };
+
+    /** @return Hash of the lowercased key, never 0 */
+    static uint64 HashKey(const FString& Key);
+
+    /**
+     * Pack a key's FName identity into one word; FNames compare ignoring case, like the key hash
+     * @param FindType - FNAME_Find on lookups, so a key that was never stored does not grow the name table
+     * @param OutBits - Receives the packed name
+     * @return false if the key has no FName (never stored, or too long to be one)
+     */
+    static bool PackKeyName(const FString& Key, EFindName FindType, uint64& OutBits);
+
+    static uint64 PackWeakObject(const TWeakObjectPtr<UObject>& WeakObject);
+    static TWeakObjectPtr<UObject> UnpackWeakObject(uint64 Bits);
+
+    /** Empty every slot of a table (write lock must be held) */
+    void ClearTable(FKindTable& Table);
+
+    void OnAssetRemoved(const FAssetData& AssetData);
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    void OnReloadComplete(EReloadCompleteReason Reason);
+    void OnPackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event);
+
+    FKindTable Tables[static_cast<int32>(EResolvedObjectKind::Count)];
+
+    /** See GetGeneration; starts at 1 so zero-filled slots are never current */
+    std::atomic<uint64> Generation { 1 };
+
+    /** Serializes writers */
+    FCriticalSection WriteLock;
+
+    bool bInitialized = false;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle PackageReloadedHandle;
+};
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "UObject/ObjectKey.h"
+#include <atomic>
+
+class UScriptStruct;
+
+/**
+ * One field of a struct schema
+ */
+struct UNREALMCP_API FStructSchemaField
+{
+    /** Reflected property; only valid while the schema is current */
+    FProperty* Property = nullptr;
+
+    /** Name shown in the editor; user defined struct fields carry a number and GUID suffix in their internal name */
+    FString AuthoredName;
+    FString InternalName;
+
+    /** Type as create_struct names it, e.g. "Integer", "String[]" or "Vector" */
+    FString TypeName;
+
+    /** Tooltip of the field, if any */
+    FString Tooltip;
+
+    /** The struct's default value of the field, as JSON; shared, so never modify it */
+    TSharedPtr<FJsonValue> DefaultValue;
+};
+
+/**
+ * Reflection data of one struct, walked once and then reused
+ */
+struct UNREALMCP_API FStructSchema
+{
+    /** Fields in declaration order */
+    TArray<FStructSchemaField> Fields;
+
+    /** Internal name -> authored name, the mapping DataTable row JSON is translated through */
+    TMap<FString, FString> AuthoredNameByInternalName;
+
+    /** @return The field with this authored or internal name, ignoring case; nullptr if there is none */
+    const FStructSchemaField* FindField(const FString& Name) const
+    {
+        const int32* Index = FieldIndexByName.Find(Name);
+        return Index ? &Fields[*Index] : nullptr;
+    }
+
+private:
+    friend class FStructSchemaCache;
+
+    /** Authored and internal names -> index in Fields; FString keys hash and compare ignoring case */
+    TMap<FString, int32> FieldIndexByName;
+};
+
+/**
+ * Statistics for monitoring the struct schema cache
+ */
+struct UNREALMCP_API FStructSchemaCacheStats
+{
+    /** Structs with a current schema */
+    int32 CachedStructs = 0;
+
+    /** Schema requests, and those that had to walk the struct */
+    int32 Lookups = 0;
+    int32 Builds = 0;
+
+    /** Schemas dropped because their struct changed */
+    int32 Invalidations = 0;
+
+    /** @return Fraction of lookups answered without walking the struct */
+    double GetHitRatio() const { return Lookups > 0 ? static_cast<double>(Lookups - Builds) / Lookups : 0.0; }
+};
+
+/**
+ * Caches the field list, name mappings, defaults and type names of each struct the
+ * DataTable and struct commands work with, so a row is validated and translated
+ * through hash lookups instead of a reflection walk per call
+ *
+ * Native structs never change while the editor runs. User defined structs are
+ * recompiled in place when edited: the structure editor's change notifications drop
+ * the edited struct's schema and, since one may nest another, those of every other
+ * user defined struct too. A schema is also rebuilt if its struct's property chain or
+ * size no longer match, which catches a recompile the notifications missed.
+ *
+ * Game thread only, except GetStats.
+ */
+class UNREALMCP_API FStructSchemaCache
+{
+public:
+    /** @return The shared cache */
+    static FStructSchemaCache& Get();
+
+    /** Subscribe to user defined struct changes */
+    void Initialize();
+
+    /** Unsubscribe and drop every schema; called on module shutdown */
+    void Shutdown();
+
+    /**
+     * Get a struct's schema, building it on first use
+     * Callers may keep the schema while they work; a later change to the struct builds a new one.
+     * @param Struct - Struct to describe
+     * @return The struct's schema
+     */
+    TSharedRef<const FStructSchema> GetSchema(const UScriptStruct* Struct);
+
+    /** Drop a struct's schema */
+    void Invalidate(const UScriptStruct* Struct);
+
+    /** @return Lookup and build counters */
+    FStructSchemaCacheStats GetStats() const;
+
+    /** Reset the lookup, build and invalidation counters */
+    void ResetStats();
+
+    /**
+     * Describe a property's type the way create_struct accepts it
+     * @param Property - Property to describe
+     * @return Type name, e.g. "Boolean", "Float[]" or the struct name without its F prefix
+     */
+    static FString DescribePropertyType(const FProperty* Property);
+
+private:
+    FStructSchemaCache() = default;
+
+    class FStructChangeListener;
+
+    struct FEntry
+    {
+        TSharedPtr<const FStructSchema> Schema;
+
+        /** Head of the property chain and size the schema was built from; a recompile changes both */
+        const FProperty* PropertyLink = nullptr;
+        int32 StructureSize = 0;
+    };
+
+    /** Walk a struct and build its schema */
+    static TSharedRef<const FStructSchema> BuildSchema(const UScriptStruct* Struct);
+
+    /** Drop every user defined struct's schema, and those of structs that no longer exist */
+    void InvalidateUserDefinedStructs();
+
+    /** Struct -> its schema */
+    TMap<TObjectKey<UScriptStruct>, FEntry> Entries;
+
+    /** Receives user defined struct changes while the cache is initialized */
+    TUniquePtr<FStructChangeListener> ChangeListener;
+
+    /** Read by get_cache_stats on any thread, so the counters are atomic */
+    std::atomic<int32> CachedCount { 0 };
+    std::atomic<int32> LookupCount { 0 };
+    std::atomic<int32> BuildCount { 0 };
+    std::atomic<int32> InvalidationCount { 0 };
+};
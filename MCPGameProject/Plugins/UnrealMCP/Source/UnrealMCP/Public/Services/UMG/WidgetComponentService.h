@@ -98,7 +98,7 @@ private:
     bool AddWidgetToTree(UWidgetBlueprint* WidgetBlueprint, UWidget* Widget, const FVector2D& Position, const FVector2D& Size);
     
     /**
-     * Save the widget blueprint
+     * Mark the widget blueprint modified and queue its compile and save in FAssetDirtySet
      * @param WidgetBlueprint - The widget blueprint to save
      */
     void SaveWidgetBlueprint(UWidgetBlueprint* WidgetBlueprint);
@@ -16,6 +16,8 @@
 
 #include "Commands/BlueprintAction/UnrealMCPBlueprintActionCommandsHandler.h"
 #include "Commands/UnrealMCPCommandRegistry.h"
+#include "MCPGameThreadDispatcher.h"
+#include "MCPWorkerCommandLane.h"
 #include "UnrealMCPBridge.generated.h"
 
 class FMCPServerRunnable;
@@ -45,9 +47,63 @@ public:
 	bool IsRunning() const { return bIsRunning; }
 
 	// Command execution
-	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	/**
+	 * Execute a command and block until it completes or times out
+	 * @param CommandType - Name of the command
+	 * @param Params - Command parameters
+	 * @param TimeoutSeconds - Time allowed for the command; zero or less waits indefinitely
+	 * @return Serialized response envelope, or a "timeout" error envelope
+	 */
+	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, double TimeoutSeconds = 0.0);
+
+	/**
+	 * Execute a command and block until it completes or times out, without serializing the response
+	 * @param CommandType - Name of the command
+	 * @param Params - Command parameters
+	 * @param TimeoutSeconds - Time allowed for the command; zero or less waits indefinitely
+	 * @return Response envelope, or a "timeout" error envelope
+	 */
+	TSharedRef<FJsonObject> ExecuteCommandJson(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, double TimeoutSeconds = 0.0);
+
+	/**
+	 * Queue a command without waiting for it
+	 * Commands are routed by their declared thread affinity: game-thread commands are batched
+	 * by the game-thread dispatcher within its per-frame budget, the rest run on the worker lane.
+	 * The bridge does not enforce the deadline on its own; the caller polls CheckDeadline on the handle.
+	 * @param CommandType - Name of the command
+	 * @param Params - Command parameters
+	 * @param OnComplete - Called exactly once with the response envelope, on the thread that ran, cancelled or timed out the command
+	 * @param TimeoutSeconds - Time allowed for the command; zero or less means no deadline
+	 * @param OnProgress - Optional; called with each progress payload the command reports, before OnComplete
+	 * @return Handle that can cancel the command or enforce its deadline
+	 */
+	FMCPCommandHandleRef ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FMCPCommandCompletion OnComplete, double TimeoutSeconds = 0.0, FMCPCommandProgress OnProgress = FMCPCommandProgress());
+
+	/**
+	 * Route a command to its handler and build the response envelope
+	 * Must be called on the game thread
+	 */
+	TSharedRef<FJsonObject> ExecuteCommandOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+	/**
+	 * Run a registry command that does not require the game thread and build the response envelope
+	 * Called on worker lane threads
+	 */
+	TSharedRef<FJsonObject> ExecuteCommandOnWorkerThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+	/** @return Queue depth, per-tick drain and budget overrun counters of the game-thread dispatcher */
+	FMCPGameThreadDispatcherStats GetGameThreadDispatcherStats() const;
+
+	/** @return Number of commands currently running on the worker lane */
+	int32 GetWorkerLaneInFlight() const;
 
 private:
+	/** Handler for a command that has not moved to the command registry yet */
+	typedef TFunction<TSharedPtr<FJsonObject>(const FString&, const TSharedPtr<FJsonObject>&)> FLegacyCommandHandler;
+
+	/** Populate LegacyCommandRoutes; called once from the constructor */
+	void BuildLegacyCommandRoutes();
+
 	// Server state
 	bool bIsRunning;
 	TSharedPtr<FSocket> ListenerSocket;
@@ -65,4 +121,13 @@ private:
 	TSharedPtr<FUnrealMCPProjectCommands> ProjectCommands;
 	TSharedPtr<FUnrealMCPUMGCommands> UMGCommands;
 	TSharedPtr<FUnrealMCPBlueprintActionCommandsHandler> BlueprintActionCommands;
+
+	// Legacy command name -> handler, read-only after construction
+	TMap<FName, FLegacyCommandHandler> LegacyCommandRoutes;
+
+	// Batches commands from connection threads onto the game thread
+	TSharedPtr<FMCPGameThreadDispatcher> GameThreadDispatcher;
+
+	// Runs thread-safe commands concurrently off the game thread
+	TSharedPtr<FMCPWorkerCommandLane> WorkerLane;
 }; 
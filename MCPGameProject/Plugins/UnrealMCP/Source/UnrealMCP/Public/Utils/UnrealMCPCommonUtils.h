@@ -70,7 +70,7 @@ public:
     // Helper to parse JSON array to FLinearColor (accepts [R,G,B] or [R,G,B,A], assumes 0-1 range)
     static bool ParseLinearColor(const TArray<TSharedPtr<FJsonValue>>& JsonArray, FLinearColor& OutColor);
 
-    // Helper to find an actor by name
+    // Helper to find an actor in the editor world by name, or else by label
     static AActor* FindActorByName(const FString& ActorName);
 
     // Helper to set an FProperty value from a JsonValue
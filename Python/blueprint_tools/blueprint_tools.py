@@ -14,6 +14,7 @@ from utils.blueprints.blueprint_operations import (
     set_component_property as set_component_property_impl,
     set_physics_properties as set_physics_properties_impl,
     compile_blueprint as compile_blueprint_impl,
+    compile_blueprints as compile_blueprints_impl,
     set_blueprint_property as set_blueprint_property_impl,
     set_pawn_properties as set_pawn_properties_impl,
 
@@ -356,20 +357,57 @@ def register_blueprint_tools(mcp: FastMCP):
     @mcp.tool()
     def compile_blueprint(
         ctx: Context,
-        blueprint_name: str
+        blueprint_name: str,
+        force: bool = False
     ) -> Dict[str, Any]:
         """
         Compile a Blueprint.
         
+        A Blueprint that has not changed since its last successful compile is not
+        compiled again; the previous result is returned with "skipped": true.
+        
         Args:
             blueprint_name: Name of the target Blueprint
+            force: Compile even if nothing changed since the last successful compile
             
         Returns:
             Response indicating success or failure with detailed compilation messages
         """
-        result = compile_blueprint_impl(ctx, blueprint_name)
+        result = compile_blueprint_impl(ctx, blueprint_name, force)
         return result
 
+    @mcp.tool()
+    def compile_blueprints(
+        ctx: Context,
+        blueprint_names: List[str] = None,
+        folder: str = None,
+        batch_size: int = None,
+        force: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Compile many Blueprints together, e.g. after changing a struct they use.
+        
+        All Blueprints are compiled in one batch, so classes they share are reinstanced
+        once instead of once per Blueprint.
+        
+        Args:
+            blueprint_names: Names or paths of the Blueprints to compile
+            folder: Folder path or glob; "/Game/Generated" compiles everything under it,
+                    "/Game/UI/*WBP_*" only the matching assets (* also matches across folders)
+            batch_size: Blueprints per batch; 0 or omitted compiles them all in one batch
+            force: Also compile Blueprints unchanged since their last successful compile,
+                   which are otherwise reported as skipped
+            
+        Returns:
+            Dict with per-Blueprint "results" (status, errors, warnings, skipped), "failed",
+            "skipped", "missing" names and "timings"
+            
+        Examples:
+            compile_blueprints(folder="/Game/Generated")
+            compile_blueprints(blueprint_names=["BP_Door", "BP_Window"])
+        """
+        return compile_blueprints_impl(ctx, blueprint_names, folder, batch_size, force)
+
     @mcp.tool()
     def set_blueprint_property(
         ctx: Context,
@@ -11,7 +11,9 @@ from utils.datatable.datatable_utils import (
     get_datatable_row_names_impl,
     add_rows_to_datatable_impl,
     update_rows_in_datatable_impl,
-    delete_datatable_rows_impl
+    delete_datatable_rows_impl,
+    import_datatable_rows_impl,
+    export_datatable_rows_impl
 )
 
 def register_datatable_tools(mcp: 'FastMCP'):
@@ -193,4 +195,53 @@ def register_datatable_tools(mcp: 'FastMCP'):
         Returns:
             Dict containing success status and updated DataTable info
         """
-        return delete_datatable_rows_impl(datatable_path, row_names) 
\ No newline at end of file
+        return delete_datatable_rows_impl(datatable_path, row_names)
+    
+    @mcp.tool()
+    def import_datatable_rows(
+        datatable_path: str,
+        data: Optional[str] = None,
+        file_path: Optional[str] = None,
+        format: str = "jsonl",
+        replace: bool = False
+    ) -> Dict[str, Any]:
+        """Import many rows into a DataTable from JSON lines or CSV text.
+        
+        Much faster than add_rows_to_datatable for large batches: rows are streamed
+        line by line and the table is updated once at the end.
+        
+        Args:
+            datatable_path: Path to the target DataTable
+            data: Rows as text; ignored if file_path is given
+            file_path: Absolute path of a file on the editor's machine to read the rows from
+            format: "jsonl" - one {"row_name": ..., "row_data": {...}} object per line,
+                    or "csv" - a header line "---,Field1,Field2,..." then one row per line
+            replace: Remove all existing rows first; otherwise rows with the same name are overwritten
+            
+        Returns:
+            Dict with imported and failed counts, the first 100 row errors, and rows_per_second
+        """
+        return import_datatable_rows_impl(datatable_path, data, file_path, format, replace)
+    
+    @mcp.tool()
+    def export_datatable_rows(
+        datatable_path: str,
+        format: str = "jsonl",
+        limit: int = 1000,
+        cursor: Optional[str] = None,
+        file_path: Optional[str] = None
+    ) -> Dict[str, Any]:
+        """Export DataTable rows as JSON lines or CSV, one page at a time.
+        
+        Args:
+            datatable_path: Path to the source DataTable
+            format: "jsonl" or "csv"
+            limit: Maximum rows per page (1-50000)
+            cursor: next_cursor from the previous page
+            file_path: Write every row from the cursor on to this file instead of returning them
+            
+        Returns:
+            Dict with data, count, total_rows, has_more and next_cursor
+        """
+        return export_datatable_rows_impl(datatable_path, format, limit, cursor, file_path)
+ 
\ No newline at end of file
@@ -5,8 +5,8 @@ Exposes Editor-related tools for Unreal Engine via MCP.
 
 ## Tools
 
-- get_actors_in_level()
-    Get a list of all actors in the current level.
+- get_actors_in_level(limit=None, cursor=None, class_name=None, tag=None, folder=None, name_pattern=None, bounds_min=None, bounds_max=None, fields=None)
+    List the actors in the current level, one page at a time.
 - find_actors_by_name(pattern)
     Find actors by name pattern.
 - spawn_actor(name, type, location=None, rotation=None)
@@ -28,15 +28,15 @@ Exposes Editor-related tools for Unreal Engine via MCP.
 - `take_screenshot(filename, show_ui, resolution)` - Capture screenshots
 
 ### Actor Management
-- **get_actors_in_level()**
+- **get_actors_in_level(limit=None, cursor=None, class_name=None, tag=None, folder=None, name_pattern=None, bounds_min=None, bounds_max=None, fields=None)**
   
-  Get a list of all actors in the current level.
+  List the actors in the current level, one page at a time, optionally filtered by class, tag, outliner folder, name pattern or bounding box.
   
-  Returns: List of actors in the current level with their properties.
+  Returns: The page's actors with the requested fields, "has_more" and, if there are more, "next_cursor".
   
   Example:
-    actors = get_actors_in_level()
-    for actor in actors:
+    page = get_actors_in_level(class_name="PointLight", fields=["name", "location"])
+    for actor in page["actors"]:
         print(actor["name"])
 
 - **find_actors_by_name(pattern)**
@@ -17,7 +17,8 @@ from utils.editor.editor_operations import (
     set_actor_property as set_actor_property_impl,
     set_light_property as set_light_property_impl,
     focus_viewport as focus_viewport_impl,
-    spawn_blueprint_actor as spawn_blueprint_actor_impl
+    spawn_blueprint_actor as spawn_blueprint_actor_impl,
+    flush as flush_impl
 )
 
 # Get logger
@@ -27,20 +28,46 @@ def register_editor_tools(mcp: FastMCP):
     """Register editor tools with the MCP server."""
     
     @mcp.tool()
-    def get_actors_in_level(ctx: Context) -> List[Dict[str, Any]]:
+    def get_actors_in_level(
+        ctx: Context,
+        limit: int = None,
+        cursor: str = None,
+        class_name: str = None,
+        tag: str = None,
+        folder: str = None,
+        name_pattern: str = None,
+        bounds_min: List[float] = None,
+        bounds_max: List[float] = None,
+        fields: List[str] = None
+    ) -> Dict[str, Any]:
         """
-        Get a list of all actors in the current level.
+        List the actors in the current level, one page at a time.
+        
+        Args:
+            limit: Maximum number of actors to return (1-10000, default 1000)
+            cursor: next_cursor from the previous page; omit for the first page
+            class_name: Only actors of this class or a subclass (e.g. "PointLight", "BP_Door")
+            tag: Only actors with this tag
+            folder: Only actors in this outliner folder or its subfolders
+            name_pattern: Only actors whose name or label matches this wildcard pattern
+            bounds_min: [X, Y, Z] minimum corner of a box the actor's location must lie in
+            bounds_max: [X, Y, Z] maximum corner of that box
+            fields: Fields to report per actor: name, label, class, location, rotation, scale, folder, tags
+                    (default: name, class, location, rotation, scale)
         
         Returns:
-            List of actors in the current level with their properties
+            Dict with "actors", "count", "has_more" and, if there are more, "next_cursor"
             
         Examples:
-            actors = get_actors_in_level()
-            # Print names of all actors in level
-            for actor in actors:
+            page = get_actors_in_level(fields=["name"])
+            for actor in page["actors"]:
                 print(actor["name"])
+            
+            # Continue with the next page
+            if page["has_more"]:
+                page = get_actors_in_level(fields=["name"], cursor=page["next_cursor"])
         """
-        return get_actors_in_level_impl(ctx)
+        return get_actors_in_level_impl(ctx, limit, cursor, class_name, tag, folder, name_pattern, bounds_min, bounds_max, fields)
 
     @mcp.tool()
     def find_actors_by_name(ctx: Context, pattern: str) -> List[str]:
@@ -375,4 +402,29 @@ def register_editor_tools(mcp: FastMCP):
         """
         return spawn_blueprint_actor_impl(ctx, blueprint_name, actor_name, location, rotation)
 
+    @mcp.tool()
+    def flush(ctx: Context, immediate_mode: bool = None) -> Dict[str, Any]:
+        """
+        Compile and save every blueprint, widget and data table modified since the last flush.
+        
+        Edits are not compiled and saved one by one. The editor commits them together when a
+        batch ends, when the connection closes or after a short idle period. Call this to
+        commit them now, e.g. before reading a generated class or handing files to another tool.
+        
+        Args:
+            immediate_mode: If True, every later edit is compiled and saved right away;
+                            if False, edits are deferred again
+            
+        Returns:
+            Dict with the "compiled", "saved" and "failed_saves" asset paths and "duration_ms"
+            
+        Examples:
+            # Build a menu, then commit it
+            flush()
+            
+            # Go back to compiling and saving after every edit
+            flush(immediate_mode=True)
+        """
+        return flush_impl(ctx, immediate_mode)
+
     logger.info("Editor tools registered successfully")
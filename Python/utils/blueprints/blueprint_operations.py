@@ -54,13 +54,34 @@ def create_blank_blueprint(
     }
     return send_unreal_command("create_blank_blueprint", params)
 
-def compile_blueprint(ctx: Context, blueprint_name: str) -> Dict[str, Any]:
+def compile_blueprint(ctx: Context, blueprint_name: str, force: bool = False) -> Dict[str, Any]:
     """Implementation for compiling a blueprint."""
     # The C++ side will handle finding the path from the name, 
     # assuming it expects the 'blueprint_name' key.
     params = {"blueprint_name": blueprint_name} 
+    if force:
+        params["force"] = True
     return send_unreal_command("compile_blueprint", params)
 
+def compile_blueprints(
+    ctx: Context,
+    blueprint_names: List[str] = None,
+    folder: str = None,
+    batch_size: int = None,
+    force: bool = False
+) -> Dict[str, Any]:
+    """Implementation for compiling many blueprints in one batch."""
+    params = {}
+    if blueprint_names is not None:
+        params["blueprint_names"] = blueprint_names
+    if folder is not None:
+        params["folder"] = folder
+    if batch_size is not None:
+        params["batch_size"] = batch_size
+    if force:
+        params["force"] = True
+    return send_unreal_command("compile_blueprints", params)
+
 def save_blueprint(ctx: Context, blueprint_path: str) -> Dict[str, Any]:
     """Implementation for saving a blueprint to disk."""
     params = {"blueprint_path": blueprint_path}
@@ -158,4 +158,60 @@ def delete_datatable_rows_impl(
         "datatable_path": datatable_path,
         "row_names": row_names
     }
-    return send_unreal_command("delete_datatable_rows", params) 
\ No newline at end of file
+    return send_unreal_command("delete_datatable_rows", params) 
+
+def import_datatable_rows_impl(
+    datatable_path: str,
+    data: Optional[str] = None,
+    file_path: Optional[str] = None,
+    format: str = "jsonl",
+    replace: bool = False
+) -> Dict[str, Any]:
+    """Import rows into a DataTable from JSON lines or CSV in Unreal Engine.
+    Args:
+        datatable_path: Path to the target DataTable
+        data: Rows as text
+        file_path: File to read the rows from instead
+        format: "jsonl" or "csv"
+        replace: Remove all existing rows first
+    Returns:
+        Dict containing imported and failed counts and timing
+    """
+    params = {
+        "datatable_path": datatable_path,
+        "format": format,
+        "replace": replace
+    }
+    if data is not None:
+        params["data"] = data
+    if file_path:
+        params["file_path"] = file_path
+    return send_unreal_command("import_datatable_rows", params)
+
+def export_datatable_rows_impl(
+    datatable_path: str,
+    format: str = "jsonl",
+    limit: int = 1000,
+    cursor: Optional[str] = None,
+    file_path: Optional[str] = None
+) -> Dict[str, Any]:
+    """Export one page of DataTable rows as JSON lines or CSV in Unreal Engine.
+    Args:
+        datatable_path: Path to the source DataTable
+        format: "jsonl" or "csv"
+        limit: Maximum rows per page
+        cursor: Cursor returned with the previous page
+        file_path: File to write every remaining row to instead
+    Returns:
+        Dict containing the exported rows and the next cursor
+    """
+    params = {
+        "datatable_path": datatable_path,
+        "format": format,
+        "limit": limit
+    }
+    if cursor:
+        params["cursor"] = cursor
+    if file_path:
+        params["file_path"] = file_path
+    return send_unreal_command("export_datatable_rows", params)
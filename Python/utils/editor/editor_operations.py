@@ -201,23 +201,53 @@ def find_actors_by_name(ctx: Context, pattern: str) -> List[Dict[str, Any]]:
     params = {"pattern": pattern}
     return send_unreal_command("find_actors_by_name", params)
 
-def get_actors_in_level(ctx: Context) -> List[Dict[str, Any]]:
-    """Implementation for getting all actors in the current level.
-    
-    Returns a list of dictionaries, each containing details about an actor in the current level.
+def get_actors_in_level(
+    ctx: Context,
+    limit: int = None,
+    cursor: str = None,
+    class_name: str = None,
+    tag: str = None,
+    folder: str = None,
+    name_pattern: str = None,
+    bounds_min: List[float] = None,
+    bounds_max: List[float] = None,
+    fields: List[str] = None
+) -> Dict[str, Any]:
+    """Implementation for listing the actors in the current level, one page at a time.
     
     Returns:
-        List[Dict[str, Any]]: A list of actors with their properties
+        Dict[str, Any]: The page's actors, with has_more and next_cursor for the next page
         
     Examples:
-        # Get all actors in the current level
-        actors = get_actors_in_level()
+        # Get the names and locations of the first 500 point lights
+        page = get_actors_in_level(class_name="PointLight", fields=["name", "location"], limit=500)
         
-        # Print names of all actors
-        for actor in actors:
-            print(actor["name"])
+        # Fetch the next page
+        if page["has_more"]:
+            page = get_actors_in_level(class_name="PointLight", fields=["name", "location"], limit=500, cursor=page["next_cursor"])
     """
-    return send_unreal_command("get_actors_in_level", {})
+    params = {}
+    
+    if limit is not None:
+        params["limit"] = limit
+    if cursor is not None:
+        params["cursor"] = cursor
+    if class_name is not None:
+        params["class"] = class_name
+    if tag is not None:
+        params["tag"] = tag
+    if folder is not None:
+        params["folder"] = folder
+    if name_pattern is not None:
+        params["name_pattern"] = name_pattern
+    if bounds_min is not None:
+        params["bounds_min"] = bounds_min
+    if bounds_max is not None:
+        params["bounds_max"] = bounds_max
+    if fields is not None:
+        params["fields"] = fields
+        
+    return send_unreal_command("get_actors_in_level", params)
 
 def spawn_blueprint_actor(
     ctx: Context,
@@ -291,4 +321,20 @@ def set_light_property(
         "property_value": property_value
     }
     
-    return send_unreal_command("set_light_property", params)
\ No newline at end of file
+    return send_unreal_command("set_light_property", params)
+
+def flush(ctx: Context, immediate_mode: bool = None) -> Dict[str, Any]:
+    """Implementation for compiling and saving the assets whose commit was deferred.
+    
+    Args:
+        immediate_mode: If given, True makes later mutations compile and save right away
+                        and False defers them again
+        
+    Returns:
+        Dict with the "compiled", "saved" and "failed_saves" asset paths
+    """
+    params = {}
+    if immediate_mode is not None:
+        params["immediate_mode"] = immediate_mode
+    
+    return send_unreal_command("flush", params)